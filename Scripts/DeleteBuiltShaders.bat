@@ -3,5 +3,7 @@ echo This script will delete all prebuilt shaders from ShaderGlass.
 echo,
 pause
 del /q ..\ShaderGlass\Shaders\RetroArch.h
+del /q ..\ShaderGlass\Shaders\RetroArch.manifest
+del /q ..\ShaderGlass\Shaders\RetroArch.pack
 rmdir /s /q ..\ShaderGlass\Shaders\RetroArch
 rmdir /s /q temp
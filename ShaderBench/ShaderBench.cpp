@@ -0,0 +1,292 @@
+/*
+ShaderBench: headless compile benchmark for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+#include "ShaderGC.h"
+#include "HLSL.h"
+#include "TaskPool.h"
+
+using namespace std;
+
+// relative to starting in Scripts directory, same as ShaderGen
+const char* _inputPath = "slang-shaders";
+
+struct PresetResult
+{
+    filesystem::path path;
+    size_t           passes {};
+    double           time {}; // ms
+    bool             warn {false};
+    string           error;
+};
+
+static size_t PeakMemory()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc {};
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return pmc.PeakWorkingSetSize;
+    return 0;
+#else
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    return (size_t)usage.ru_maxrss * 1024;
+#endif
+}
+
+// every .slangp under root, skipping folders marked with .exclude like ShaderGen's "*"
+static vector<filesystem::path> FindPresets(const filesystem::path& root, bool force)
+{
+    vector<filesystem::path> presets;
+    for(auto& p : filesystem::recursive_directory_iterator(root))
+    {
+        if(p.path().extension() != ".slangp")
+            continue;
+
+        auto isExcluded  = false;
+        auto excludePath = p.path().parent_path();
+        do
+        {
+            isExcluded |= filesystem::exists(excludePath / ".exclude");
+            excludePath = excludePath.parent_path();
+        } while(!isExcluded && !excludePath.empty());
+
+        if(force || !isExcluded)
+            presets.push_back(p.path().lexically_normal());
+    }
+    sort(presets.begin(), presets.end());
+    return presets;
+}
+
+// times ShaderCache::FindCachedShader over synthetic caches of growing size, with and without the index
+static int LookupBench()
+{
+    const size_t sizes[] = {1000, 10000, 100000};
+    const size_t lookups = 5000;
+
+    cout << "Looking up " << lookups << " sources (half of them cached) per cache size" << endl;
+    cout << setw(10) << "Entries" << setw(16) << "Indexed (us)" << setw(16) << "Scan (us)" << endl;
+
+    mt19937 generator(1);
+    for(const auto size : sizes)
+    {
+        vector<string>           sources;
+        vector<vector<uint32_t>> hashes;
+        ShaderCache              cache;
+        sources.reserve(size * 2);
+        hashes.reserve(size);
+        cache.m_cachedShaders.reserve(size);
+        for(size_t i = 0; i < size * 2; i++)
+            sources.push_back("// synthetic pass " + to_string(i) + "\nfloat4 main(float4 pos : SV_Position) : SV_Target { return pos; }\n");
+        for(size_t i = 0; i < size; i++)
+        {
+            hashes.push_back(ShaderCache::CalculateHash(sources[i]));
+            cache.m_cachedShaders.emplace_back(hashes.back().data(), nullptr, 0);
+        }
+
+        // same queries for both runs, a miss is any source past size
+        vector<size_t> queries(lookups);
+        for(auto& q : queries)
+            q = generator() % sources.size();
+
+        double times[2] {};
+        for(int indexed = 0; indexed < 2; indexed++)
+        {
+            // until BuildIndex is called FindCachedShader scans every entry
+            if(indexed)
+                cache.BuildIndex();
+
+            const auto start = chrono::steady_clock::now();
+            for(const auto q : queries)
+            {
+                const auto found = cache.FindCachedShader(sources[q]);
+                if(found != (q < size ? &cache.m_cachedShaders[q] : nullptr))
+                {
+                    cout << "Wrong lookup result for source " << q << " in cache of " << size << endl;
+                    return 1;
+                }
+            }
+            times[indexed] = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / lookups;
+        }
+
+        cout << fixed << setprecision(3) << setw(10) << size << setw(16) << times[1] << setw(16) << times[0] << endl;
+    }
+    return 0;
+}
+
+static void Usage()
+{
+    cout << "ShaderBench [-threads n] [-fxc] [-force] [-trace file] [root]" << endl;
+    cout << "ShaderBench -lookup" << endl;
+    cout << "  -threads n  workers compiling presets, default all cores" << endl;
+    cout << "  -fxc        compile DXBC with FXC instead of a stub (Windows only)" << endl;
+    cout << "  -force      include folders marked with .exclude" << endl;
+    cout << "  -trace file append per-stage timings of every preset as JSON lines" << endl;
+    cout << "  root        slang-shaders checkout, default " << _inputPath << endl;
+    cout << "  -lookup     time cached shader lookups against synthetic caches instead" << endl;
+}
+
+int main(int argc, char* argv[])
+{
+    filesystem::path root(_inputPath);
+    filesystem::path tracePath;
+    unsigned         threads = 0;
+    bool             fxc     = false;
+    bool             force   = false;
+
+    for(int i = 1; i < argc; i++)
+    {
+        string input(argv[i]);
+        if(input == "-threads" && i < argc - 1)
+            threads = (unsigned)atoi(argv[++i]);
+        else if(input == "-fxc")
+            fxc = true;
+        else if(input == "-force")
+            force = true;
+        else if(input == "-trace" && i < argc - 1)
+            tracePath = argv[++i];
+        else if(input == "-lookup")
+            return LookupBench();
+        else if(input.starts_with("-"))
+        {
+            Usage();
+            return -1;
+        }
+        else
+            root = input;
+    }
+
+    if(!filesystem::exists(root))
+    {
+        cout << "Cannot find " << root << endl;
+        return -1;
+    }
+
+    // front end only unless asked for FXC, bytecode is never used
+    if(!fxc)
+    {
+        HLSL::SetCompiler([](const char*, size_t, const char*, bool, ostream&, bool&) { return vector<uint8_t> {'D', 'X', 'B', 'C'}; });
+    }
+
+    const auto presets = FindPresets(root, force);
+    cout << "Compiling " << presets.size() << " presets from " << root.string() << " on " << TaskPool::Threads(threads) << " threads, "
+         << (fxc ? "FXC" : "stub") << " DXBC stage" << endl;
+
+    ofstream traceStream;
+    if(!tracePath.empty())
+        traceStream.open(tracePath, ios::app);
+
+    const ShaderCache     cache;
+    vector<PresetResult>  results(presets.size());
+    map<string, double>   stageTimes;
+    map<string, unsigned> counters;
+    mutex                 totalsMutex;
+    const auto            start = chrono::steady_clock::now();
+
+    // presets are spread over workers, passes of each preset compile on its worker
+    TaskPool::Run(presets.size(), threads, [&](size_t i) {
+        auto& result = results[i];
+        result.path  = presets[i];
+
+        CompileTrace  trace;
+        ostringstream log;
+        const auto    presetStart = chrono::steady_clock::now();
+        try
+        {
+            auto def      = ShaderGC::CompilePreset(result.path, log, result.warn, cache, 1, nullptr, &trace);
+            result.passes = def->ShaderDefs.size();
+            def->MakeDynamic();
+            delete def;
+        }
+        catch(std::exception& ex)
+        {
+            result.error = ex.what();
+            replace(result.error.begin(), result.error.end(), '\n', ' ');
+        }
+        result.time = chrono::duration<double, milli>(chrono::steady_clock::now() - presetStart).count();
+
+        lock_guard<mutex> lock(totalsMutex);
+        for(const auto& e : trace.Events())
+        {
+            if(e.name != "import")
+                stageTimes[e.name] += e.duration / 1000.0;
+        }
+        for(const auto& c : trace.Counters())
+            counters[c.first] += c.second;
+        if(traceStream.is_open())
+            trace.WriteJsonLines(traceStream, result.path.generic_string());
+    });
+
+    const auto wallTime = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    size_t totalPasses = 0, failures = 0, warnings = 0;
+    double presetTime  = 0;
+    cout << fixed << setprecision(1);
+    for(const auto& r : results)
+    {
+        cout << (r.error.size() ? "ERROR " : (r.warn ? "WARN  " : "OK    ")) << setw(9) << r.time << " ms " << setw(3) << r.passes << " passes  " << r.path.generic_string();
+        if(r.error.size())
+            cout << "  " << r.error;
+        cout << endl;
+
+        totalPasses += r.passes;
+        presetTime += r.time;
+        failures += r.error.size() ? 1 : 0;
+        warnings += r.warn ? 1 : 0;
+    }
+
+    cout << endl;
+    cout << "Presets:     " << results.size() << " (" << failures << " failed, " << warnings << " with warnings)" << endl;
+    cout << "Passes:      " << totalPasses << endl;
+    cout << "Wall time:   " << wallTime << " ms" << endl;
+    cout << "Preset time: " << presetTime << " ms (sum over workers)" << endl;
+    if(wallTime > 0)
+    {
+        cout << "Throughput:  " << results.size() * 1000.0 / wallTime << " presets/s, " << totalPasses * 1000.0 / wallTime << " passes/s" << endl;
+    }
+    cout << "Peak memory: " << PeakMemory() / (1024 * 1024) << " MB" << endl;
+
+    cout << endl << "Stage time (ms, sum over workers)" << endl;
+    for(const auto& s : stageTimes)
+    {
+        cout << "  " << left << setw(14) << s.first << right << setw(12) << s.second;
+        if(presetTime > 0)
+            cout << setw(7) << s.second * 100.0 / presetTime << "%";
+        cout << endl;
+    }
+    if(counters.size())
+    {
+        cout << endl << "Counters" << endl;
+        for(const auto& c : counters)
+            cout << "  " << left << setw(14) << c.first << right << setw(12) << c.second << endl;
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,140 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "CompileTrace.h"
+
+#include "json.hpp"
+
+using namespace std;
+using namespace nlohmann;
+
+CompileTrace::Scope::Scope(CompileTrace* trace, const char* name, int pass, int stage) :
+    m_trace {trace}, m_name {name}, m_pass {pass}, m_stage {stage}, m_exceptions {std::uncaught_exceptions()}, m_start {chrono::steady_clock::now()}
+{ }
+
+CompileTrace::Scope::~Scope()
+{
+    if(!m_trace)
+        return;
+
+    // unwinding from an exception thrown inside the block
+    const char* result = std::uncaught_exceptions() > m_exceptions ? "error" : m_result;
+    m_trace->Add(m_name, m_pass, m_stage, m_start, result ? result : string(), m_retries);
+}
+
+CompileTrace::CompileTrace() : m_origin {chrono::steady_clock::now()} { }
+
+void CompileTrace::Add(const std::string& name, int pass, int stage, chrono::steady_clock::time_point start, const std::string& result, unsigned retries)
+{
+    const auto end = chrono::steady_clock::now();
+
+    lock_guard<mutex> lock(m_mutex);
+    auto              thread = m_threads.emplace(this_thread::get_id(), (unsigned)m_threads.size()).first->second;
+
+    Event e;
+    e.name     = name;
+    e.pass     = pass;
+    e.stage    = stage;
+    e.start    = chrono::duration<double, micro>(start - m_origin).count();
+    e.duration = chrono::duration<double, micro>(end - start).count();
+    e.thread   = thread;
+    e.result   = result;
+    e.retries  = retries;
+    m_events.push_back(std::move(e));
+
+    if(!result.empty())
+        m_counters[name + "-" + result]++;
+    if(retries)
+        m_counters[name + "-retries"] += retries;
+}
+
+void CompileTrace::Count(const std::string& counter, unsigned n)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_counters[counter] += n;
+}
+
+std::vector<CompileTrace::Event> CompileTrace::Events() const
+{
+    vector<Event> events;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        events = m_events;
+    }
+    std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.start < b.start; });
+    return events;
+}
+
+std::map<std::string, unsigned> CompileTrace::Counters() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_counters;
+}
+
+static json EventArgs(const CompileTrace::Event& e)
+{
+    json args = json::object();
+    if(e.pass >= 0)
+        args["pass"] = e.pass;
+    if(e.stage >= 0)
+        args["stage"] = e.stage ? "fragment" : "vertex";
+    if(!e.result.empty())
+        args["result"] = e.result;
+    if(e.retries)
+        args["retries"] = e.retries;
+    return args;
+}
+
+void CompileTrace::WriteJsonLines(std::ostream& out, const std::string& label) const
+{
+    double total = 0;
+    for(const auto& e : Events())
+    {
+        json line      = EventArgs(e);
+        line["label"]  = label;
+        line["name"]   = e.name;
+        line["start"]  = e.start;
+        line["dur"]    = e.duration;
+        line["thread"] = e.thread;
+        out << line.dump() << endl;
+
+        total = max(total, e.start + e.duration);
+    }
+
+    json summary        = json::object();
+    summary["label"]    = label;
+    summary["name"]     = "summary";
+    summary["dur"]      = total;
+    summary["counters"] = Counters();
+    out << summary.dump() << endl;
+}
+
+void CompileTrace::WriteChromeTrace(std::ostream& out) const
+{
+    json events = json::array();
+    for(const auto& e : Events())
+    {
+        json event;
+        event["name"] = e.name;
+        event["cat"]  = "shadergc";
+        event["ph"]   = "X";
+        event["ts"]   = e.start;
+        event["dur"]  = e.duration;
+        event["pid"]  = 1;
+        event["tid"]  = e.thread;
+        event["args"] = EventArgs(e);
+        events.push_back(std::move(event));
+    }
+
+    json trace;
+    trace["traceEvents"]     = std::move(events);
+    trace["displayTimeUnit"] = "ms";
+    trace["otherData"]       = Counters();
+    out << trace.dump(1) << endl;
+}
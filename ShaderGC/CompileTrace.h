@@ -0,0 +1,80 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+// timings of every stage of an import (file loading, glslang, SPIRV-Cross, FXC, cache
+// lookups) per pass and shader stage, written as JSON lines or Chrome trace so compile
+// times can be compared between runs; events may be recorded from TaskPool workers
+class CompileTrace
+{
+public:
+    struct Event
+    {
+        std::string name;
+        int         pass;     // -1 when not tied to a pass
+        int         stage;    // -1 none, 0 vertex, 1 fragment
+        double      start;    // us since trace was created
+        double      duration; // us
+        unsigned    thread;   // small index in order threads were first seen
+        std::string result;   // hit/miss for cache lookups, error when stage threw
+        unsigned    retries;  // FXC recompiles (X3511 unroll fix-up)
+    };
+
+    // times the enclosing block, does nothing for a null trace
+    class Scope
+    {
+    public:
+        Scope(CompileTrace* trace, const char* name, int pass = -1, int stage = -1);
+        ~Scope();
+
+        void Result(const char* result)
+        {
+            m_result = result;
+        }
+
+        void Retries(unsigned retries)
+        {
+            m_retries = retries;
+        }
+
+    private:
+        CompileTrace*                         m_trace;
+        const char*                           m_name;
+        int                                   m_pass;
+        int                                   m_stage;
+        int                                   m_exceptions;
+        const char*                           m_result {nullptr};
+        unsigned                              m_retries {0};
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    CompileTrace();
+
+    // events are also tallied as "<name>-<result>" counters and retries as "<name>-retries"
+    void Add(const std::string& name, int pass, int stage, std::chrono::steady_clock::time_point start, const std::string& result = std::string(), unsigned retries = 0);
+    void Count(const std::string& counter, unsigned n = 1);
+
+    std::vector<Event>              Events() const; // ordered by start time
+    std::map<std::string, unsigned> Counters() const;
+
+    // one object per event followed by a summary object with counters, tagged with label
+    void WriteJsonLines(std::ostream& out, const std::string& label) const;
+    // Trace Event Format for chrome://tracing and Perfetto, counters under otherData
+    void WriteChromeTrace(std::ostream& out) const;
+
+private:
+    std::chrono::steady_clock::time_point          m_origin;
+    mutable std::mutex                             m_mutex;
+    std::vector<Event>                             m_events;
+    std::map<std::string, unsigned>                m_counters;
+    std::unordered_map<std::thread::id, unsigned> m_threads;
+};
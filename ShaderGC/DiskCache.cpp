@@ -0,0 +1,336 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "DiskCache.h"
+#include "ShaderCache.h"
+#include "sha256.h"
+
+#include <atomic>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+using namespace std;
+
+// bump when entry layout or compiler settings change
+static const uint32_t sCacheVersion = 3;
+static const char     sCacheMagic[4] {'S', 'G', 'C', 'C'};
+static const char*    sCompilerOptions = "glslang vk1.0 spv1.0;spirv-cross sm50;fxc vs_5_0/ps_5_0 O3";
+
+static std::atomic<uint32_t> sTempCounter {0};
+
+static void Append(vector<uint8_t>& buffer, const void* data, size_t size)
+{
+    auto bytes = (const uint8_t*)data;
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+static void AppendSection(vector<uint8_t>& buffer, const void* data, size_t size)
+{
+    uint32_t len = (uint32_t)size;
+    Append(buffer, &len, sizeof(len));
+    Append(buffer, data, size);
+}
+
+static bool ReadSection(const vector<uint8_t>& buffer, size_t& pos, size_t end, const uint8_t*& data, size_t& size)
+{
+    uint32_t len;
+    if(pos + sizeof(len) > end)
+        return false;
+    memcpy(&len, buffer.data() + pos, sizeof(len));
+    pos += sizeof(len);
+    if(len > end - pos)
+        return false;
+    data = buffer.data() + pos;
+    size = len;
+    pos += len;
+    return true;
+}
+
+template<class T>
+static bool ReadValue(const vector<uint8_t>& buffer, size_t& pos, size_t end, T& value)
+{
+    if(pos + sizeof(value) > end)
+        return false;
+    memcpy(&value, buffer.data() + pos, sizeof(value));
+    pos += sizeof(value);
+    return true;
+}
+
+static bool ReadString(const vector<uint8_t>& buffer, size_t& pos, size_t end, string& value)
+{
+    const uint8_t* data;
+    size_t         size;
+    if(!ReadSection(buffer, pos, end, data, size))
+        return false;
+    value.assign((const char*)data, size);
+    return true;
+}
+
+static void AppendBuffers(vector<uint8_t>& buffer, const vector<SourceReflectedBuffer>& buffers)
+{
+    uint32_t count = (uint32_t)buffers.size();
+    Append(buffer, &count, sizeof(count));
+    for(const auto& b : buffers)
+    {
+        Append(buffer, &b.binding, sizeof(b.binding));
+        count = (uint32_t)b.members.size();
+        Append(buffer, &count, sizeof(count));
+        for(const auto& m : b.members)
+        {
+            AppendSection(buffer, m.name.data(), m.name.size());
+            Append(buffer, &m.offset, sizeof(m.offset));
+            Append(buffer, &m.size, sizeof(m.size));
+        }
+    }
+}
+
+static bool ReadBuffers(const vector<uint8_t>& buffer, size_t& pos, size_t end, vector<SourceReflectedBuffer>& buffers)
+{
+    uint32_t count;
+    if(!ReadValue(buffer, pos, end, count))
+        return false;
+    for(uint32_t b = 0; b < count; b++)
+    {
+        SourceReflectedBuffer rb;
+        uint32_t              binding, members;
+        if(!ReadValue(buffer, pos, end, binding) || !ReadValue(buffer, pos, end, members))
+            return false;
+        rb.binding = (int)binding;
+        for(uint32_t m = 0; m < members; m++)
+        {
+            SourceReflectedMember rm;
+            uint32_t              offset, size;
+            if(!ReadString(buffer, pos, end, rm.name) || !ReadValue(buffer, pos, end, offset) || !ReadValue(buffer, pos, end, size))
+                return false;
+            rm.offset = (int)offset;
+            rm.size   = (int)size;
+            rb.members.push_back(rm);
+        }
+        buffers.push_back(rb);
+    }
+    return true;
+}
+
+static void AppendReflection(vector<uint8_t>& buffer, const SourceShaderReflection& reflection)
+{
+    AppendBuffers(buffer, reflection.ubos);
+    AppendBuffers(buffer, reflection.pushConstants);
+    uint32_t count = (uint32_t)reflection.textures.size();
+    Append(buffer, &count, sizeof(count));
+    for(const auto& t : reflection.textures)
+    {
+        AppendSection(buffer, t.name.data(), t.name.size());
+        Append(buffer, &t.binding, sizeof(t.binding));
+    }
+    Append(buffer, &reflection.cost, sizeof(reflection.cost));
+}
+
+static bool ReadReflection(const vector<uint8_t>& buffer, size_t& pos, size_t end, SourceShaderReflection& reflection)
+{
+    if(!ReadBuffers(buffer, pos, end, reflection.ubos) || !ReadBuffers(buffer, pos, end, reflection.pushConstants))
+        return false;
+    uint32_t count;
+    if(!ReadValue(buffer, pos, end, count))
+        return false;
+    for(uint32_t t = 0; t < count; t++)
+    {
+        string   name;
+        uint32_t binding;
+        if(!ReadString(buffer, pos, end, name) || !ReadValue(buffer, pos, end, binding))
+            return false;
+        reflection.textures.push_back(SourceShaderSampler(name, (int)binding));
+    }
+    return ReadValue(buffer, pos, end, reflection.cost);
+}
+
+static void Checksum(const uint8_t* data, size_t size, uint8_t* hash)
+{
+    SHA256_CTX ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, data, size);
+    sha256_final(&ctx, hash);
+}
+
+DiskCache::DiskCache(const std::filesystem::path& directory, uintmax_t maxSize) : m_directory {directory}, m_maxSize {maxSize}
+{
+    std::error_code ec;
+    filesystem::create_directories(m_directory, ec);
+}
+
+std::string DiskCache::Key(const std::string& source, bool fragment)
+{
+    ostringstream input;
+    input << sCacheVersion << "\n" << sCompilerOptions << "\n" << (fragment ? "frag" : "vert") << "\n" << source;
+
+    const auto& hash = ShaderCache::CalculateHash(input.str());
+
+    ostringstream key;
+    key << std::hex << std::setfill('0');
+    for(const auto& h : hash)
+        key << std::setw(8) << h;
+    return key.str();
+}
+
+std::filesystem::path DiskCache::EntryPath(const std::string& key) const
+{
+    return m_directory / (key + ".sgcc");
+}
+
+bool DiskCache::Load(const std::string& key, CompiledShaderStage& stage) const
+{
+    const auto path = EntryPath(key);
+
+    vector<uint8_t> buffer;
+    {
+        ifstream infile(path, ios::binary | ios::ate);
+        if(!infile.good())
+            return false;
+        auto size = infile.tellg();
+        if(size <= 0)
+            return false;
+        buffer.resize((size_t)size);
+        infile.seekg(0, ios::beg);
+        infile.read((char*)buffer.data(), size);
+        if(!infile.good())
+            return false;
+    }
+
+    auto discard = [&]() {
+        std::error_code ec;
+        filesystem::remove(path, ec);
+        return false;
+    };
+
+    // header, spirv, hlsl, reflection, bytecode, trailing checksum
+    const size_t headerSize = sizeof(sCacheMagic) + sizeof(sCacheVersion);
+    if(buffer.size() < headerSize + SHA256_BLOCK_SIZE)
+        return discard();
+
+    const size_t end = buffer.size() - SHA256_BLOCK_SIZE;
+    uint8_t      hash[SHA256_BLOCK_SIZE];
+    Checksum(buffer.data(), end, hash);
+    if(memcmp(hash, buffer.data() + end, SHA256_BLOCK_SIZE) != 0)
+        return discard();
+
+    uint32_t version;
+    memcpy(&version, buffer.data() + sizeof(sCacheMagic), sizeof(version));
+    if(memcmp(buffer.data(), sCacheMagic, sizeof(sCacheMagic)) != 0 || version != sCacheVersion)
+        return discard();
+
+    size_t         pos = headerSize;
+    const uint8_t* data;
+    size_t         size;
+
+    if(!ReadSection(buffer, pos, end, data, size) || size % sizeof(uint32_t) != 0)
+        return discard();
+    stage.spirv.resize(size / sizeof(uint32_t));
+    memcpy(stage.spirv.data(), data, size);
+
+    if(!ReadSection(buffer, pos, end, data, size))
+        return discard();
+    stage.hlsl.assign((const char*)data, size);
+
+    if(!ReadReflection(buffer, pos, end, stage.metadata))
+        return discard();
+
+    if(!ReadSection(buffer, pos, end, data, size) || size == 0)
+        return discard();
+    stage.byteCode.assign(data, data + size);
+
+    // mark as recently used for eviction
+    std::error_code ec;
+    filesystem::last_write_time(path, filesystem::file_time_type::clock::now(), ec);
+
+    return true;
+}
+
+void DiskCache::Store(const std::string& key, const CompiledShaderStage& stage) const
+{
+    vector<uint8_t> buffer;
+    Append(buffer, sCacheMagic, sizeof(sCacheMagic));
+    Append(buffer, &sCacheVersion, sizeof(sCacheVersion));
+    AppendSection(buffer, stage.spirv.data(), stage.spirv.size() * sizeof(uint32_t));
+    AppendSection(buffer, stage.hlsl.data(), stage.hlsl.size());
+    AppendReflection(buffer, stage.metadata);
+    AppendSection(buffer, stage.byteCode.data(), stage.byteCode.size());
+
+    uint8_t hash[SHA256_BLOCK_SIZE];
+    Checksum(buffer.data(), buffer.size(), hash);
+    Append(buffer, hash, sizeof(hash));
+
+    // write under a unique name, then move into place
+    const auto path     = EntryPath(key);
+    auto       tempPath = path;
+    tempPath += "." + to_string(sTempCounter++) + ".tmp";
+
+    {
+        ofstream outfile(tempPath, ios::binary | ios::trunc);
+        if(!outfile.good())
+            return;
+        outfile.write((const char*)buffer.data(), buffer.size());
+        outfile.close();
+        if(outfile.fail())
+        {
+            std::error_code ec;
+            filesystem::remove(tempPath, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    filesystem::rename(tempPath, path, ec);
+    if(ec)
+        filesystem::remove(tempPath, ec);
+}
+
+void DiskCache::Trim() const
+{
+    struct Entry
+    {
+        filesystem::path           path;
+        uintmax_t                  size;
+        filesystem::file_time_type time;
+    };
+
+    vector<Entry>   entries;
+    uintmax_t       totalSize = 0;
+    std::error_code ec;
+    for(const auto& f : filesystem::directory_iterator(m_directory, ec))
+    {
+        if(!f.is_regular_file(ec))
+            continue;
+
+        // leftovers of interrupted writes
+        if(f.path().extension() == ".tmp")
+        {
+            filesystem::remove(f.path(), ec);
+            continue;
+        }
+
+        if(f.path().extension() != ".sgcc")
+            continue;
+
+        Entry e {f.path(), f.file_size(ec), f.last_write_time(ec)};
+        totalSize += e.size;
+        entries.push_back(e);
+    }
+
+    if(totalSize <= m_maxSize)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.time < b.time; });
+    for(const auto& e : entries)
+    {
+        if(totalSize <= m_maxSize)
+            break;
+        if(filesystem::remove(e.path, ec))
+            totalSize -= e.size;
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include "SourceDefs.h"
+
+struct CompiledShaderStage
+{
+    std::vector<uint32_t>  spirv;
+    std::string            hlsl;
+    SourceShaderReflection metadata;
+    std::vector<uint8_t>   byteCode;
+    bool                   optimized {true}; // false for preview builds, which are never stored
+    double                 compileTime {};   // ms spent in FXC, 0 when bytecode came from a cache
+};
+
+// content-addressed store of compiled shader stages, one file per stage keyed by
+// hash of preprocessed GLSL and compiler options; files are written to a temporary
+// name and renamed so a crash never leaves a partial entry, and each entry carries
+// a checksum so damaged files are discarded on load
+class DiskCache
+{
+public:
+    DiskCache(const std::filesystem::path& directory, uintmax_t maxSize);
+
+    static std::string Key(const std::string& source, bool fragment);
+
+    bool Load(const std::string& key, CompiledShaderStage& stage) const;
+    void Store(const std::string& key, const CompiledShaderStage& stage) const;
+
+    // evicts least recently used entries until cache fits in maxSize
+    void Trim() const;
+
+private:
+    std::filesystem::path EntryPath(const std::string& key) const;
+
+    std::filesystem::path m_directory;
+    uintmax_t             m_maxSize;
+};
@@ -12,21 +12,29 @@ GNU General Public License v3.0
 #include "include/glslang/Include/glslang_c_interface.h"
 #include "include/glslang/Public/resource_limits_c.h"
 
-#ifdef _DEBUG
-#    pragma comment(lib, "glslangd.lib")
-#    pragma comment(lib, "glslang-default-resource-limitsd.lib")
-#else
-#    pragma comment(lib, "glslang.lib")
-#    pragma comment(lib, "glslang-default-resource-limits.lib")
+#ifdef _MSC_VER
+#    ifdef _DEBUG
+#        pragma comment(lib, "glslangd.lib")
+#        pragma comment(lib, "glslang-default-resource-limitsd.lib")
+#    else
+#        pragma comment(lib, "glslang.lib")
+#        pragma comment(lib, "glslang-default-resource-limits.lib")
+#    endif
 #endif
 
 #include <cstdio>
 #include <cstdint>
+#include <mutex>
+
+// glslang keeps process-wide symbol tables, set them up once before any thread compiles
+static std::once_flag sInitialized;
 
 std::vector<uint32_t> GLSL::GenerateSPIRV(const char* source, bool fragment, std::ostream& log, bool& warn)
 {
     //std::cout << "GenerateSPIRV...";
 
+    std::call_once(sInitialized, []() { glslang_initialize_process(); });
+
     std::vector<uint32_t> bin;
     auto                  stage = fragment ? GLSLANG_STAGE_FRAGMENT : GLSLANG_STAGE_VERTEX;
 
@@ -10,9 +10,19 @@ GNU General Public License v3.0
 #include "HLSL.h"
 
 #include <stdexcept>
+#ifdef _WIN32
 #include <d3dcompiler.h>
+#include <d3d11shader.h>
 
 #pragma comment(lib, "d3dcompiler.lib")
+#endif
+
+static HLSL::Compiler s_compiler;
+
+void HLSL::SetCompiler(Compiler compiler)
+{
+    s_compiler = std::move(compiler);
+}
 
 static inline void ltrim(std::string& s)
 {
@@ -31,13 +41,19 @@ static inline std::string trim(std::string s)
     return s;
 }
 
-std::vector<uint8_t> HLSL::CompileHLSL(const char* source, size_t size, const char* profile, bool unroll, std::ostream& log, bool& warn)
+std::vector<uint8_t> HLSL::CompileHLSL(const char* source, size_t size, const char* profile, bool unroll, bool optimize, std::ostream& log, bool& warn, unsigned* retries)
 {
+    if(s_compiler)
+        return s_compiler(source, size, profile, optimize, log, warn);
+
+#ifndef _WIN32
+    throw std::runtime_error("FXC is not available on this platform");
+#else
     //std::cout << "CompileHLSL...";
 
     ID3DBlob* shaderBlob = nullptr;
     ID3DBlob* errorBlob  = nullptr;
-    UINT      flags      = D3DCOMPILE_OPTIMIZATION_LEVEL3;
+    UINT      flags      = optimize ? D3DCOMPILE_OPTIMIZATION_LEVEL3 : D3DCOMPILE_OPTIMIZATION_LEVEL0;
     HRESULT   hr         = D3DCompile(source, size, NULL, NULL, NULL, "main", profile, flags, 0, &shaderBlob, &errorBlob);
 
     if(FAILED(hr))
@@ -73,7 +89,9 @@ std::vector<uint8_t> HLSL::CompileHLSL(const char* source, size_t size, const ch
                 newSource << line << std::endl;
             }
             const auto& newSourceString = newSource.str();
-            return CompileHLSL(newSourceString.c_str(), newSourceString.size(), profile, false, log, warn);
+            if(retries)
+                (*retries)++;
+            return CompileHLSL(newSourceString.c_str(), newSourceString.size(), profile, false, optimize, log, warn, retries);
         }
 
         throw std::runtime_error(msgString);
@@ -90,4 +108,22 @@ std::vector<uint8_t> HLSL::CompileHLSL(const char* source, size_t size, const ch
     //std::cout << "OK" << std::endl;
 
     return bin;
+#endif
+}
+
+unsigned HLSL::InstructionCount(const std::vector<uint8_t>& byteCode)
+{
+#ifndef _WIN32
+    return 0;
+#else
+    ID3D11ShaderReflection* reflection = nullptr;
+    if(FAILED(D3DReflect(byteCode.data(), byteCode.size(), __uuidof(ID3D11ShaderReflection), (void**)&reflection)))
+        return 0;
+
+    D3D11_SHADER_DESC desc {};
+    reflection->GetDesc(&desc);
+    reflection->Release();
+
+    return desc.InstructionCount;
+#endif
 }
@@ -7,8 +7,23 @@ GNU General Public License v3.0
 
 #pragma once
 
+#include <functional>
+
 class HLSL
 {
 public:
-    static std::vector<uint8_t> CompileHLSL(const char* source, size_t size, const char* profile, bool unroll, std::ostream& log, bool& warn);
+    // stands in for FXC (e.g. a stub on build machines without d3dcompiler), receives
+    // source, size, profile and optimize; an empty function restores FXC
+    using Compiler = std::function<std::vector<uint8_t>(const char*, size_t, const char*, bool, std::ostream&, bool&)>;
+
+    // set before compiling starts, not synchronised with running compiles
+    static void SetCompiler(Compiler compiler);
+
+    // optimize: full (level 3) optimisation, otherwise lowest level for a quick preview build
+    // retries: when given, incremented for every recompile after an X3511 unroll fix-up
+    static std::vector<uint8_t>
+    CompileHLSL(const char* source, size_t size, const char* profile, bool unroll, bool optimize, std::ostream& log, bool& warn, unsigned* retries = nullptr);
+
+    // instruction count reported by bytecode reflection, 0 if unavailable
+    static unsigned InstructionCount(const std::vector<uint8_t>& byteCode);
 };
\ No newline at end of file
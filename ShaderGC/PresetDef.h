@@ -14,11 +14,11 @@ GNU General Public License v3.0
 class PresetDef
 {
 public:
-    PresetDef() : ShaderDefs {}, TextureDefs {}, Overrides {}, Name {}, Category {}, ImportPath {} { }
+    PresetDef() : ShaderDefs {}, TextureDefs {}, Overrides {}, Name {}, Category {}, ImportPath {}, Cost {} { }
 
     virtual void Build() { }
 
-    __declspec(noinline)
+    SHADERGC_NOINLINE
     void OverrideParam(const char* name, float value)
     {
         Overrides.emplace_back(name, value);
@@ -38,4 +38,20 @@ public:
     std::string                Name;
     std::string                Category;
     std::filesystem::path      ImportPath;
-};
\ No newline at end of file
+    float                      Cost; // estimated per output pixel, see ShaderCost
+};
+
+// entry of a generated preset list, which holds no PresetDef objects until a preset is used
+struct PresetInfo
+{
+    const char* name;
+    const char* category;
+    float       cost; // computed by ShaderGen, see ShaderCost
+    PresetDef* (*create)();
+};
+
+template<class T>
+PresetDef* CreatePreset()
+{
+    return new T();
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <span>
+#include <string_view>
+
+// one preset key of a pass or texture, generated presets emit constexpr tables of these
+struct PresetParamInfo
+{
+    const char* key;
+    const char* value;
+};
+
+// preset keys of a pass or texture; a generated table is viewed in place, keys added one by one
+// (imported presets) are copied. The first value set for a key wins, like std::map::insert
+class PresetParamList
+{
+public:
+    void Set(std::span<const PresetParamInfo> table)
+    {
+        m_table = table;
+    }
+
+    void Add(const char* key, const char* value)
+    {
+        m_added.emplace_back(key, value);
+    }
+
+    bool Get(std::string_view key, std::string_view& value) const
+    {
+        for(const auto& p : m_table)
+        {
+            if(key == p.key)
+            {
+                value = p.value;
+                return true;
+            }
+        }
+        for(const auto& p : m_added)
+        {
+            if(key == p.first)
+            {
+                value = p.second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // empty when the key is not set
+    std::string_view operator[](std::string_view key) const
+    {
+        std::string_view value;
+        Get(key, value);
+        return value;
+    }
+
+private:
+    std::span<const PresetParamInfo>                 m_table;
+    std::vector<std::pair<std::string, std::string>> m_added;
+};
@@ -10,23 +10,68 @@ GNU General Public License v3.0
 #include "SPIRV.h"
 
 #include "include/spirv_hlsl.hpp"
-#include "include/spirv_reflect.hpp"
-
-#ifdef _DEBUG
-#    pragma comment(lib, "spirv-cross-cored.lib")
-#    pragma comment(lib, "spirv-cross-hlsld.lib")
-#    pragma comment(lib, "spirv-cross-glsld.lib")
-#    pragma comment(lib, "spirv-cross-reflectd.lib")
-#else
-#    pragma comment(lib, "spirv-cross-core.lib")
-#    pragma comment(lib, "spirv-cross-hlsl.lib")
-#    pragma comment(lib, "spirv-cross-glsl.lib")
-#    pragma comment(lib, "spirv-cross-reflect.lib")
+
+#ifdef _MSC_VER
+#    ifdef _DEBUG
+#        pragma comment(lib, "spirv-cross-cored.lib")
+#        pragma comment(lib, "spirv-cross-hlsld.lib")
+#        pragma comment(lib, "spirv-cross-glsld.lib")
+#    else
+#        pragma comment(lib, "spirv-cross-core.lib")
+#        pragma comment(lib, "spirv-cross-hlsl.lib")
+#        pragma comment(lib, "spirv-cross-glsl.lib")
+#    endif
 #endif
 
 using namespace SPIRV_CROSS_NAMESPACE;
 
-std::pair<std::string, std::string> SPIRV::GenerateHLSL(const std::vector<uint32_t>& bin, bool fragment, std::ostream& log, bool& warn)
+static int GetSize(const SPIRType& type)
+{
+    // float/int/uint scalars and vectors, mat4; arrays get the size of their element like the JSON
+    // reflection used to give them (only the base type name was read)
+    if(type.basetype == SPIRType::Float || type.basetype == SPIRType::Int || type.basetype == SPIRType::UInt)
+    {
+        if(type.columns == 1 && type.vecsize >= 1 && type.vecsize <= 4)
+            return 4 * type.vecsize;
+        if(type.columns == 4 && type.vecsize == 4 && type.basetype == SPIRType::Float)
+            return 64;
+    }
+    throw std::runtime_error("Unknown type");
+}
+
+static SourceReflectedBuffer ReflectBuffer(const Compiler& compiler, const Resource& resource)
+{
+    SourceReflectedBuffer buffer;
+    buffer.binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
+
+    const auto& type = compiler.get_type(resource.base_type_id);
+    for(uint32_t m = 0; m < type.member_types.size(); m++)
+    {
+        SourceReflectedMember member;
+        member.name   = compiler.get_member_name(resource.base_type_id, m);
+        member.offset = compiler.type_struct_member_offset(type, m);
+        member.size   = GetSize(compiler.get_type(type.member_types[m]));
+        buffer.members.push_back(member);
+    }
+    return buffer;
+}
+
+static SourceShaderReflection Reflect(const Compiler& compiler)
+{
+    SourceShaderReflection reflection;
+
+    const auto& resources = compiler.get_shader_resources();
+    for(const auto& ubo : resources.uniform_buffers)
+        reflection.ubos.push_back(ReflectBuffer(compiler, ubo));
+    for(const auto& pc : resources.push_constant_buffers)
+        reflection.pushConstants.push_back(ReflectBuffer(compiler, pc));
+    for(const auto& tx : resources.sampled_images)
+        reflection.textures.push_back(SourceShaderSampler(tx.name, compiler.get_decoration(tx.id, spv::DecorationBinding)));
+
+    return reflection;
+}
+
+std::pair<std::string, SourceShaderReflection> SPIRV::GenerateHLSL(const std::vector<uint32_t>& bin, bool fragment, std::ostream& log, bool& warn)
 {
     //std::cout << "GenerateHLSL...";
 
@@ -34,18 +79,19 @@ std::pair<std::string, std::string> SPIRV::GenerateHLSL(const std::vector<uint32
     {
         CompilerHLSL hlsl(bin);
 
+        // reflect on the same parsed module before HLSL renames anything
+        SourceShaderReflection metadata;
+        if(fragment)
+        {
+            metadata      = Reflect(hlsl);
+            metadata.cost = ShaderCost::Analyze(bin);
+        }
+
         CompilerHLSL::Options options;
         options.shader_model = 50;
         hlsl.set_hlsl_options(options);
         std::string source = hlsl.compile();
 
-        std::string metadata;
-        if(fragment)
-        {
-            CompilerReflection refl(bin);
-            metadata = refl.compile();
-        }
-
         //std::cout << "OK" << std::endl;
 
         return std::make_pair(source, metadata);
@@ -7,8 +7,11 @@ GNU General Public License v3.0
 
 #pragma once
 
+#include "SourceDefs.h"
+
 class SPIRV
 {
 public:
-    static std::pair<std::string, std::string> GenerateHLSL(const std::vector<uint32_t>& bin, bool fragment, std::ostream& log, bool& warn);
+    // HLSL source and, for fragment stage, uniform/texture layout
+    static std::pair<std::string, SourceShaderReflection> GenerateHLSL(const std::vector<uint32_t>& bin, bool fragment, std::ostream& log, bool& warn);
 };
\ No newline at end of file
@@ -10,6 +10,8 @@ GNU General Public License v3.0
 #include "ShaderCache.h"
 #include "sha256.h"
 
+#include <algorithm>
+
 std::vector<uint32_t> ShaderCache::CalculateHash(const std::string& source)
 {
     auto* data = (const uint8_t*)source.data();
@@ -25,14 +27,50 @@ std::vector<uint32_t> ShaderCache::CalculateHash(const std::string& source)
     return buffer;
 }
 
+static inline uint64_t IndexKey(const uint32_t* hash)
+{
+    return (uint64_t)hash[0] | ((uint64_t)hash[1] << 32);
+}
+
+static inline bool HashEquals(const uint32_t* a, const uint32_t* b)
+{
+    return memcmp(a, b, HASH_LEN * sizeof(uint32_t)) == 0;
+}
+
+void ShaderCache::BuildIndex()
+{
+    m_index.clear();
+    m_index.reserve(m_cachedShaders.size());
+    for(size_t i = 0; i < m_cachedShaders.size(); i++)
+    {
+        const auto& cs = m_cachedShaders[i];
+        if(cs.hash != nullptr)
+            m_index.emplace_back(IndexKey(cs.hash), i);
+    }
+    std::sort(m_index.begin(), m_index.end());
+}
+
 const CachedShader* ShaderCache::FindCachedShader(const std::string& source) const
 {
     auto hash = CalculateHash(source);
 
-    for(const auto& cs : m_cachedShaders)
+    if(m_index.empty())
+    {
+        // not indexed, scan everything
+        for(const auto& cs : m_cachedShaders)
+        {
+            if(cs.hash != nullptr && HashEquals(cs.hash, hash.data()))
+                return &cs;
+        }
+        return nullptr;
+    }
+
+    // 64-bit prefix narrows it down to (almost always) one entry, confirm with full hash
+    const auto key = IndexKey(hash.data());
+    for(auto it = std::lower_bound(m_index.begin(), m_index.end(), std::make_pair(key, (size_t)0)); it != m_index.end() && it->first == key; it++)
     {
-        if(cs.hash != nullptr && cs.hash[0] == hash[0] && cs.hash[1] == hash[1] && cs.hash[2] == hash[2] && cs.hash[3] == hash[3] && cs.hash[4] == hash[4] &&
-           cs.hash[5] == hash[5] && cs.hash[6] == hash[6] && cs.hash[7] == hash[7])
+        const auto& cs = m_cachedShaders[it->second];
+        if(HashEquals(cs.hash, hash.data()))
             return &cs;
     }
     return nullptr;
@@ -7,6 +7,9 @@ GNU General Public License v3.0
 
 #pragma once
 
+#include "DiskCache.h"
+#include "StageCache.h"
+
 #define HASH_LEN 8
 
 struct CachedShader
@@ -27,7 +30,15 @@ public:
 
     static std::vector<uint32_t> CalculateHash(const std::string& source);
 
+    // sorts shaders by hash so lookups don't depend on library size, call after filling m_cachedShaders
+    void BuildIndex();
+
     const CachedShader* FindCachedShader(const std::string& source) const;
 
-    std::vector<CachedShader> m_cachedShaders;
+    std::vector<CachedShader>   m_cachedShaders;
+    std::unique_ptr<DiskCache>  m_diskCache;
+    std::unique_ptr<StageCache> m_stageCache;
+
+private:
+    std::vector<std::pair<uint64_t, size_t>> m_index; // first 64 bits of hash, position in m_cachedShaders
 };
\ No newline at end of file
@@ -0,0 +1,355 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "ShaderCost.h"
+#include "ShaderDef.h"
+#include "SourceDefs.h"
+
+#define SPV_ENABLE_UTILITY_CODE
+#include "include/spirv.hpp"
+#include "include/GLSL.std.450.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace std;
+
+// loops bounded by anything but constants (usually a parameter) are assumed to run this many times
+static const float sDefaultTrips = 8.0f;
+static const float sMaxTrips     = 256.0f;
+static const int   sMaxCallDepth = 64;
+
+// transcendental functions run at a fraction of the ALU rate
+static const float sTranscendentalWeight = 4.0f;
+
+// largest area a pass can render relative to the viewport in each direction
+static const float sMaxScale = 8.0f;
+
+namespace
+{
+struct Instruction
+{
+    const uint32_t* words;
+    spv::Op         op;
+    uint32_t        count;
+};
+
+struct FunctionCost
+{
+    float                         alu {0};
+    float                         texture {0};
+    vector<pair<uint32_t, float>> calls; // callee and how many times it runs per invocation
+};
+
+class Module
+{
+public:
+    bool Parse(const vector<uint32_t>& spirv)
+    {
+        if(spirv.size() < 5 || spirv[0] != spv::MagicNumber)
+            return false;
+
+        for(size_t pos = 5; pos < spirv.size();)
+        {
+            const auto count = spirv[pos] >> spv::WordCountShift;
+            if(count == 0 || pos + count > spirv.size())
+                return false;
+
+            const auto op = (spv::Op)(spirv[pos] & spv::OpCodeMask);
+            m_code.push_back({&spirv[pos], op, count});
+
+            bool hasResult, hasResultType;
+            spv::HasResultAndType(op, &hasResult, &hasResultType);
+            if(hasResult && count > (hasResultType ? 2u : 1u))
+            {
+                const auto id = spirv[pos + (hasResultType ? 2 : 1)];
+                m_defs[id]    = m_code.size() - 1;
+                if(hasResultType)
+                    m_types[id] = spirv[pos + 1];
+            }
+            pos += count;
+        }
+        return true;
+    }
+
+    const vector<Instruction>& Code() const
+    {
+        return m_code;
+    }
+
+    const Instruction* Def(uint32_t id) const
+    {
+        const auto def = m_defs.find(id);
+        return def == m_defs.end() ? nullptr : &m_code[def->second];
+    }
+
+    // components of a value, matrices count all their elements
+    float Width(uint32_t id) const
+    {
+        const auto type = m_types.find(id);
+        return type == m_types.end() ? 1.0f : TypeWidth(type->second);
+    }
+
+    float TypeWidth(uint32_t typeId) const
+    {
+        const auto type = Def(typeId);
+        if(type && (type->op == spv::OpTypeVector || type->op == spv::OpTypeMatrix) && type->count > 3)
+            return type->words[3] * TypeWidth(type->words[2]);
+        return 1.0f;
+    }
+
+    bool Constant(uint32_t id, float& value) const
+    {
+        const auto constant = Def(id);
+        if(!constant || constant->op != spv::OpConstant || constant->count < 4)
+            return false;
+
+        const auto type = Def(constant->words[1]);
+        if(type && type->op == spv::OpTypeFloat)
+            memcpy(&value, &constant->words[3], sizeof(value));
+        else if(type && type->op == spv::OpTypeInt && type->count > 3 && type->words[3])
+            value = (float)(int32_t)constant->words[3];
+        else
+            value = (float)constant->words[3];
+        return true;
+    }
+
+    // trip count of the loop whose OpLoopMerge is at header: glslang emits for loops as a load of the counter
+    // compared with the bound right after the header, the counter being set before the loop and stepped by
+    // adding a constant in its continue block
+    float Trips(size_t header) const
+    {
+        const auto merge = m_code[header].words[1];
+
+        const Instruction* compare = nullptr;
+        for(size_t i = header + 1; i < m_code.size() && !compare; i++)
+        {
+            if(m_code[i].op == spv::OpBranchConditional)
+                compare = Def(m_code[i].words[1]);
+            if(m_code[i].op == spv::OpLabel && m_code[i].words[1] == merge)
+                break;
+        }
+        if(!compare || compare->count < 5 || (compare->op < spv::OpINotEqual || compare->op > spv::OpFUnordGreaterThanEqual))
+            return sDefaultTrips;
+
+        float    limit;
+        uint32_t counter;
+        if(Constant(compare->words[4], limit))
+            counter = compare->words[3];
+        else if(Constant(compare->words[3], limit))
+            counter = compare->words[4];
+        else
+            return sDefaultTrips;
+
+        const auto load = Def(counter);
+        if(!load || load->op != spv::OpLoad || load->count < 4)
+            return sDefaultTrips;
+        const auto variable = load->words[3];
+
+        float start = 0.0f;
+        for(size_t i = header; i-- > 0 && m_code[i].op != spv::OpFunction;)
+        {
+            if(m_code[i].op == spv::OpStore && m_code[i].words[1] == variable)
+            {
+                Constant(m_code[i].words[2], start);
+                break;
+            }
+        }
+
+        float step = 1.0f;
+        for(size_t i = header + 1; i < m_code.size() && !(m_code[i].op == spv::OpLabel && m_code[i].words[1] == merge); i++)
+        {
+            if(m_code[i].op != spv::OpStore || m_code[i].words[1] != variable)
+                continue;
+
+            const auto add = Def(m_code[i].words[2]);
+            if(add && add->count > 4 && (add->op == spv::OpIAdd || add->op == spv::OpFAdd || add->op == spv::OpISub || add->op == spv::OpFSub) &&
+               (Constant(add->words[4], step) || Constant(add->words[3], step)))
+            {
+                if(add->op == spv::OpISub || add->op == spv::OpFSub)
+                    step = -step;
+                break;
+            }
+        }
+
+        const auto inclusive = compare->op == spv::OpULessThanEqual || compare->op == spv::OpSLessThanEqual || compare->op == spv::OpUGreaterThanEqual ||
+                               compare->op == spv::OpSGreaterThanEqual || compare->op == spv::OpFOrdLessThanEqual || compare->op == spv::OpFUnordLessThanEqual ||
+                               compare->op == spv::OpFOrdGreaterThanEqual || compare->op == spv::OpFUnordGreaterThanEqual;
+        const auto trips = ceil((limit - start) / step) + (inclusive ? 1.0f : 0.0f);
+        if(!isfinite(trips) || trips < 1.0f)
+            return sDefaultTrips;
+        return min(trips, sMaxTrips);
+    }
+
+private:
+    vector<Instruction>               m_code;
+    unordered_map<uint32_t, size_t>   m_defs;  // result id to its instruction
+    unordered_map<uint32_t, uint32_t> m_types; // result id to its type
+};
+
+bool IsAlu(spv::Op op)
+{
+    return (op >= spv::OpConvertFToU && op <= spv::OpBitcast) || (op >= spv::OpSNegate && op <= spv::OpSMulExtended) ||
+           (op >= spv::OpAny && op <= spv::OpFUnordGreaterThanEqual) || (op >= spv::OpShiftRightLogical && op <= spv::OpBitCount) ||
+           (op >= spv::OpDPdx && op <= spv::OpFwidthCoarse);
+}
+
+bool IsTexture(spv::Op op)
+{
+    return (op >= spv::OpImageSampleImplicitLod && op <= spv::OpImageRead) || (op >= spv::OpImageSparseSampleImplicitLod && op <= spv::OpImageSparseRead);
+}
+
+float AluWeight(const Module& module, const Instruction& in)
+{
+    const auto result = module.Width(in.words[2]);
+    switch(in.op)
+    {
+    case spv::OpDot:
+        return module.Width(in.words[3]);
+    case spv::OpVectorTimesMatrix:
+    case spv::OpMatrixTimesVector:
+    case spv::OpMatrixTimesMatrix:
+        return result * 4.0f;
+    case spv::OpExtInst:
+        if(in.count > 4 && in.words[4] >= GLSLstd450Sin && in.words[4] <= GLSLstd450InverseSqrt)
+            return result * sTranscendentalWeight;
+        return result;
+    default:
+        return result;
+    }
+}
+
+}
+
+StageCost ShaderCost::Analyze(const std::vector<uint32_t>& spirv)
+{
+    StageCost cost;
+    Module    module;
+    if(!module.Parse(spirv))
+        return cost;
+
+    const auto&                           code  = module.Code();
+    uint32_t                              entry = 0;
+    unordered_map<uint32_t, FunctionCost> functions;
+    FunctionCost*                         current = nullptr;
+    vector<pair<uint32_t, float>>         loops; // merge block and trips of loops the current block is in
+    for(size_t i = 0; i < code.size(); i++)
+    {
+        const auto& in = code[i];
+        if(in.op == spv::OpEntryPoint && in.count > 2 && (!entry || in.words[1] == spv::ExecutionModelFragment))
+            entry = in.words[2];
+        else if(in.op == spv::OpVariable && in.count > 3 && in.words[3] == spv::StorageClassUniformConstant)
+        {
+            const auto pointer = module.Def(in.words[1]);
+            auto       type    = pointer && pointer->count > 3 ? module.Def(pointer->words[3]) : nullptr;
+            if(type && type->op == spv::OpTypeArray)
+                type = module.Def(type->words[2]);
+            if(type && type->op == spv::OpTypeSampledImage)
+                cost.samplers++;
+        }
+        else if(in.op == spv::OpFunction && in.count > 2)
+        {
+            current = &functions[in.words[2]];
+            loops.clear();
+        }
+        else if(in.op == spv::OpFunctionEnd)
+            current = nullptr;
+        else if(in.op == spv::OpLabel)
+        {
+            while(loops.size() && loops.back().first == in.words[1])
+                loops.pop_back();
+        }
+        else if(in.op == spv::OpLoopMerge && in.count > 2)
+            loops.emplace_back(in.words[1], module.Trips(i));
+        else if(current && (in.op == spv::OpFunctionCall || in.op == spv::OpExtInst || IsAlu(in.op) || IsTexture(in.op)) && in.count > 3)
+        {
+            float times = 1.0f;
+            for(const auto& l : loops)
+                times *= l.second;
+
+            if(in.op == spv::OpFunctionCall)
+                current->calls.emplace_back(in.words[3], times);
+            else if(IsTexture(in.op))
+                current->texture += times;
+            else
+                current->alu += AluWeight(module, in) * times;
+        }
+    }
+
+    // calls are expanded with the number of times they run, GLSL has no recursion but the depth is capped anyway
+    float                                alu = 0, texture = 0;
+    function<void(uint32_t, float, int)> add = [&](uint32_t id, float times, int depth) {
+        const auto f = functions.find(id);
+        if(f == functions.end() || depth > sMaxCallDepth)
+            return;
+        alu += f->second.alu * times;
+        texture += f->second.texture * times;
+        for(const auto& c : f->second.calls)
+            add(c.first, times * c.second, depth + 1);
+    };
+    add(entry, 1.0f, 0);
+
+    cost.alu     = (uint32_t)min(alu, (float)UINT32_MAX);
+    cost.texture = (uint32_t)min(texture, (float)UINT32_MAX);
+    return cost;
+}
+
+float ShaderCost::ChainCost(size_t count, const std::function<StageCost(size_t pass)>& cost, const std::function<std::string_view(size_t pass, const char*)>& param)
+{
+    // sizes are relative to the viewport
+    float sourceWidth = InputScale, sourceHeight = InputScale, total = 0.0f;
+    for(size_t p = 0; p < count; p++)
+    {
+        const auto axis = [&](const char* typeKey, const char* scaleKey, float source, float reference) {
+            auto type = param(p, typeKey);
+            if(type.empty())
+                type = param(p, "scale_type");
+            auto value = param(p, scaleKey);
+            if(value.empty())
+                value = param(p, "scale");
+            const auto scale = value.empty() ? 1.0f : strtof(string(value).c_str(), nullptr);
+
+            // without a scale type the last pass renders to the viewport and others keep the source size
+            float size;
+            if(type.empty())
+                size = p == count - 1 ? 1.0f : source;
+            else if(type == "viewport")
+                size = scale;
+            else if(type == "absolute")
+                size = scale / reference;
+            else
+                size = source * scale;
+            return clamp(size, 0.0f, sMaxScale);
+        };
+
+        const auto width  = axis("scale_type_x", "scale_x", sourceWidth, ReferenceWidth);
+        const auto height = axis("scale_type_y", "scale_y", sourceHeight, ReferenceHeight);
+        total += cost(p).Total() * width * height;
+        sourceWidth  = width;
+        sourceHeight = height;
+    }
+    return total;
+}
+
+float ShaderCost::ChainCost(const std::vector<ShaderDef>& passes)
+{
+    return ChainCost(passes.size(), [&](size_t p) { return passes[p].Cost; }, [&](size_t p, const char* key) { return passes[p].PresetParams[key]; });
+}
+
+float ShaderCost::ChainCost(const std::vector<SourceShaderDef>& passes)
+{
+    return ChainCost(
+        passes.size(),
+        [&](size_t p) { return passes[p].fragmentMetadata.cost; },
+        [&](size_t p, const char* key) {
+            const auto value = passes[p].presetParams.find(key);
+            return value == passes[p].presetParams.end() ? string_view() : string_view(value->second);
+        });
+}
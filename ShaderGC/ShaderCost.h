@@ -0,0 +1,53 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <functional>
+#include <string_view>
+
+class ShaderDef;
+struct SourceShaderDef;
+
+// static cost of one fragment invocation, counted from SPIR-V with loops unrolled to their bounds
+// and both sides of every branch taken, so it's an upper estimate rather than a measurement
+struct StageCost
+{
+    uint32_t alu {0};      // arithmetic instructions weighted by vector width
+    uint32_t texture {0};  // sample, fetch and gather instructions
+    uint32_t samplers {0}; // textures bound to the stage
+
+    float Total() const
+    {
+        return alu + texture * TextureWeight + samplers * SamplerWeight;
+    }
+
+    static constexpr float TextureWeight = 8.0f; // a filtered fetch costs about as much as this many ALU ops
+    static constexpr float SamplerWeight = 2.0f; // every bound texture adds to cache pressure
+};
+
+// per-output-pixel cost of a preset, sums the cost of each pass weighted by the area it renders relative
+// to the viewport; scale types follow the slangp rules with the original input at a quarter of the viewport
+// in each direction (typical of 240p-480p content on a 1080p screen) and absolute sizes relative to 1080p
+class ShaderCost
+{
+public:
+    // cost of the first fragment entry point, an empty stage when the module can't be parsed
+    static StageCost Analyze(const std::vector<uint32_t>& spirv);
+
+    static float ChainCost(const std::vector<ShaderDef>& passes);
+    static float ChainCost(const std::vector<SourceShaderDef>& passes);
+
+    static constexpr float InputScale      = 0.25f;
+    static constexpr float ReferenceWidth  = 1920.0f;
+    static constexpr float ReferenceHeight = 1080.0f;
+
+private:
+    static float ChainCost(size_t                                                           count,
+                           const std::function<StageCost(size_t pass)>&                     cost,
+                           const std::function<std::string_view(size_t pass, const char*)>& param);
+};
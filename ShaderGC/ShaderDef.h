@@ -7,23 +7,56 @@ GNU General Public License v3.0
 
 #pragma once
 
-struct ShaderParam
-{
-    ShaderParam(const char* name, int buffer, int offset, int size, float minValue, float maxValue, float defaultValue, float stepValue = 0.0f, const char* description = "") :
-        name {name}, buffer {buffer}, offset {offset}, size {size}, minValue {minValue}, maxValue {maxValue}, defaultValue {defaultValue}, currentValue {defaultValue},
-        stepValue {stepValue}, description {description}
-    { }
+#include <array>
 
-    std::string name;
+#include "PresetParamList.h"
+#include "ShaderCost.h"
+
+// keeps the generated Build() bodies small, ShaderBench also builds with GCC/Clang
+#ifdef _MSC_VER
+#define SHADERGC_NOINLINE __declspec(noinline)
+#else
+#define SHADERGC_NOINLINE __attribute__((noinline))
+#endif
+
+// static descriptors of parameters and samplers, generated shaders emit constexpr tables of these
+struct ShaderParamInfo
+{
+    const char* name;
     int         buffer;
-    int         size;
     int         offset;
+    int         size;
     float       minValue;
     float       maxValue;
-    float       currentValue;
     float       defaultValue;
     float       stepValue;
-    std::string description;
+    const char* description;
+};
+
+struct ShaderSamplerInfo
+{
+    const char* name;
+    int         binding;
+};
+
+// names and descriptions view static strings (generated tables, or copies made on import)
+struct ShaderParam
+{
+    ShaderParam(std::string_view name, int buffer, int offset, int size, float minValue, float maxValue, float defaultValue, float stepValue = 0.0f, std::string_view description = "") :
+        name {name}, buffer {buffer}, offset {offset}, size {size}, minValue {minValue}, maxValue {maxValue}, defaultValue {defaultValue}, currentValue {defaultValue},
+        stepValue {stepValue}, description {description}
+    { }
+
+    std::string_view name;
+    int              buffer;
+    int              size;
+    int              offset;
+    float            minValue;
+    float            maxValue;
+    float            currentValue;
+    float            defaultValue;
+    float            stepValue;
+    std::string_view description;
 };
 
 struct ParamOverride
@@ -36,9 +69,9 @@ struct ParamOverride
 
 struct ShaderSampler
 {
-    ShaderSampler(const char* name, int binding) : name {name}, binding {binding} { }
-    std::string name;
-    int         binding;
+    ShaderSampler(std::string_view name, int binding) : name {name}, binding {binding} { }
+    std::string_view name;
+    int              binding;
 };
 
 class ShaderDef
@@ -46,23 +79,36 @@ class ShaderDef
 public:
     ShaderDef() :
         Params {}, Samplers {}, Name {}, VertexSource {}, FragmentSource {}, VertexByteCode {}, FragmentByteCode {}, VertexHash {}, FragmentHash {}, VertexLength {},
-        FragmentLength {}, Format {}, Dynamic {false}
+        FragmentLength {}, Format {}, Dynamic {false}, Cost {}
     { }
 
-    std::vector<ShaderParam>           Params;
-    std::vector<ShaderSampler>         Samplers;
-    std::map<std::string, std::string> PresetParams;
-    std::string                        Name;
-    const char*                        VertexSource;
-    const char*                        FragmentSource;
-    const uint8_t*                     VertexByteCode;
-    const uint8_t*                     FragmentByteCode;
-    const uint32_t*                    VertexHash;
-    const uint32_t*                    FragmentHash;
-    size_t                             VertexLength;
-    size_t                             FragmentLength;
-    char*                              Format;
-    bool                               Dynamic;
+    // the virtual destructor would otherwise rule out moves, which generated presets use to add passes;
+    // imported stages and sources are owned by the shared_ptrs below so copies stay safe after MakeDynamic
+    ShaderDef(const ShaderDef&)            = default;
+    ShaderDef(ShaderDef&&)                 = default;
+    ShaderDef& operator=(const ShaderDef&) = default;
+    ShaderDef& operator=(ShaderDef&&)      = default;
+
+    std::vector<ShaderParam>   Params;
+    std::vector<ShaderSampler> Samplers;
+    PresetParamList            PresetParams;
+    std::string                Name;
+    const char*                VertexSource;
+    const char*                FragmentSource;
+    const uint8_t*             VertexByteCode;
+    const uint8_t*             FragmentByteCode;
+    const uint32_t*            VertexHash;
+    const uint32_t*            FragmentHash;
+    size_t                     VertexLength;
+    size_t                     FragmentLength;
+    char*                      Format;
+    bool                       Dynamic;
+    StageCost                  Cost; // of the fragment stage, for PresetDef cost estimates
+
+    // owners of imported bytecode, which passes with identical stages share
+    std::shared_ptr<const std::vector<uint8_t>> VertexData;
+    std::shared_ptr<const std::vector<uint8_t>> FragmentData;
+    std::shared_ptr<const std::string>          FragmentSourceData; // imported HLSL, kept for parameter specialization
 
     size_t ParamsSize(int buffer)
     {
@@ -78,21 +124,41 @@ public:
         return maxLen;
     }
 
-    __declspec(noinline)
+    SHADERGC_NOINLINE
     void AddParam(const char* name, int buffer, int offset, int size, float minValue, float maxValue, float defaultValue, float stepValue = 0.0f, const char* description = "")
     {
         Params.emplace_back(name, buffer, offset, size, minValue, maxValue, defaultValue, stepValue, description);
     }
 
-    __declspec(noinline)
+    SHADERGC_NOINLINE
     void AddSampler(const char* name, int binding)
     {
         Samplers.emplace_back(name, binding);
     }
 
+    void SetParams(std::span<const ShaderParamInfo> params)
+    {
+        Params.reserve(Params.size() + params.size());
+        for(const auto& p : params)
+            Params.emplace_back(p.name, p.buffer, p.offset, p.size, p.minValue, p.maxValue, p.defaultValue, p.stepValue, p.description);
+    }
+
+    void SetSamplers(std::span<const ShaderSamplerInfo> samplers)
+    {
+        Samplers.reserve(Samplers.size() + samplers.size());
+        for(const auto& s : samplers)
+            Samplers.emplace_back(s.name, s.binding);
+    }
+
     ShaderDef& Param(const char* presetKey, const char* presetValue)
     {
-        PresetParams.insert(std::make_pair(std::string(presetKey), std::string(presetValue)));
+        PresetParams.Add(presetKey, presetValue);
+        return *this;
+    }
+
+    ShaderDef& Param(std::span<const PresetParamInfo> presetParams)
+    {
+        PresetParams.Set(presetParams);
         return *this;
     }
 
@@ -100,9 +166,9 @@ public:
     {
         if(Dynamic)
         {
-            if(VertexByteCode)
+            if(VertexByteCode && !VertexData)
                 free((void*)VertexByteCode);
-            if(FragmentByteCode)
+            if(FragmentByteCode && !FragmentData)
                 free((void*)FragmentByteCode);
         }
     }
@@ -12,72 +12,111 @@ GNU General Public License v3.0
 #include "GLSL.h"
 #include "HLSL.h"
 #include "SPIRV.h"
+#include "TaskPool.h"
 
 #include "json.hpp"
 
+#include <chrono>
+#include <iomanip>
+
 using namespace std;
 using namespace nlohmann;
 
 static char* CopyString(const std::string& s)
 {
     auto copy = new char[s.size() + 1];
-    strcpy_s(copy, s.size() + 1, s.c_str());
+    memcpy(copy, s.c_str(), s.size() + 1);
     return copy;
 }
 
-static uint8_t* CopyVector(const std::vector<uint8_t>& d)
+CompiledShaderStage ShaderGC::CompileStage(
+    const std::string& source, const std::string& diskKey, bool fragment, bool preview, ostream& log, bool& warn, const ShaderCache& cache, int pass, CompileTrace* trace)
 {
-    auto copy = new uint8_t[d.size()];
-    memcpy(copy, d.data(), d.size());
-    return copy;
-}
+    CompiledShaderStage stage;
+
+    // previously compiled stage?
+    if(cache.m_diskCache)
+    {
+        CompileTrace::Scope scope(trace, "disk-cache", pass, fragment);
+        if(cache.m_diskCache->Load(diskKey, stage))
+        {
+            scope.Result("hit");
+            log << "Using cached " << (fragment ? "fragment" : "vertex") << " stage " << diskKey << endl;
+            return stage;
+        }
+        scope.Result("miss");
+    }
 
-ShaderDef ShaderGC::CompileSourceShader(SourceShaderDef& def, ostream& log, bool& warn, const ShaderCache& cache)
-{
     // convert GLSL to SPIRV
-    auto vertexSPIRV   = GLSL::GenerateSPIRV(def.vertexSource.c_str(), false, log, warn);
-    auto fragmentSPIRV = GLSL::GenerateSPIRV(def.fragmentSource.c_str(), true, log, warn);
+    {
+        CompileTrace::Scope scope(trace, "glslang", pass, fragment);
+        stage.spirv = GLSL::GenerateSPIRV(source.c_str(), fragment, log, warn);
+    }
 
     // convert SPIRV to HLSL and reflect
-    auto vertexHLSL   = SPIRV::GenerateHLSL(vertexSPIRV, false, log, warn);
-    auto fragmentHLSL = SPIRV::GenerateHLSL(fragmentSPIRV, true, log, warn);
+    {
+        CompileTrace::Scope scope(trace, "spirv-cross", pass, fragment);
+        auto                hlsl = SPIRV::GenerateHLSL(stage.spirv, fragment, log, warn);
+        stage.hlsl               = hlsl.first;
+        stage.metadata           = hlsl.second;
+    }
 
     // compile HLSL to DXBC
-    std::vector<uint8_t> vertexDXBC, fragmentDXBC;
     if(!cache.empty())
     {
-        auto vertexCached = cache.FindCachedShader(vertexHLSL.first);
-        if(vertexCached != nullptr)
+        CompileTrace::Scope scope(trace, "shader-cache", pass, fragment);
+        auto                cached = cache.FindCachedShader(stage.hlsl);
+        if(cached != nullptr)
         {
-            vertexDXBC.resize(vertexCached->len);
-            memcpy(vertexDXBC.data(), vertexCached->data, vertexCached->len);
+            stage.byteCode.resize(cached->len);
+            memcpy(stage.byteCode.data(), cached->data, cached->len);
         }
+        scope.Result(cached ? "hit" : "miss");
+    }
+    if(stage.byteCode.empty())
+    {
+        CompileTrace::Scope scope(trace, preview ? "fxc-preview" : "fxc", pass, fragment);
+        unsigned            retries = 0;
+        const auto          start   = chrono::steady_clock::now();
+        stage.byteCode = HLSL::CompileHLSL(stage.hlsl.c_str(), (int)stage.hlsl.size(), fragment ? "ps_5_0" : "vs_5_0", true, !preview, log, warn, &retries);
+        stage.compileTime = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        stage.optimized   = !preview;
+        scope.Retries(retries);
+    }
 
-        auto fragmentCached = cache.FindCachedShader(fragmentHLSL.first);
-        if(fragmentCached != nullptr)
-        {
-            fragmentDXBC.resize(fragmentCached->len);
-            memcpy(fragmentDXBC.data(), fragmentCached->data, fragmentCached->len);
-        }
+    // preview builds are replaced by OptimizeStages which stores the final one
+    if(cache.m_diskCache && stage.optimized)
+    {
+        CompileTrace::Scope scope(trace, "disk-store", pass, fragment);
+        cache.m_diskCache->Store(diskKey, stage);
     }
-    if(vertexDXBC.empty())
-        vertexDXBC = HLSL::CompileHLSL(vertexHLSL.first.c_str(), (int)vertexHLSL.first.size(), "vs_5_0", true, log, warn);
-    if(fragmentDXBC.empty())
-        fragmentDXBC = HLSL::CompileHLSL(fragmentHLSL.first.c_str(), (int)fragmentHLSL.first.size(), "ps_5_0", true, log, warn);
 
+    return stage;
+}
+
+ShaderDef ShaderGC::MakeShaderDef(SourceShaderDef&            def,
+                                  const CompiledShaderStage&  vertex,
+                                  const CompiledShaderStage&  fragment,
+                                  const StageCache::ByteCode& vertexByteCode,
+                                  const StageCache::ByteCode& fragmentByteCode)
+{
     // map declared to reflected parameters
     std::vector<SourceShaderSampler> textures;
-    def.params = LookupParams(def.params, textures, fragmentHLSL.second);
+    def.params = LookupParams(def.params, textures, fragment.metadata);
 
     ShaderDef sd;
-    sd.Format           = CopyString(def.format);
-    sd.VertexSource     = nullptr;
-    sd.VertexByteCode   = CopyVector(vertexDXBC);
-    sd.VertexLength     = vertexDXBC.size();
-    sd.FragmentSource   = nullptr;
-    sd.FragmentByteCode = CopyVector(fragmentDXBC);
-    sd.FragmentLength   = fragmentDXBC.size();
-    sd.Name             = def.input.filename().string();
+    sd.Format             = CopyString(def.format);
+    sd.VertexSource       = nullptr;
+    sd.VertexData         = vertexByteCode;
+    sd.VertexByteCode     = vertexByteCode->data();
+    sd.VertexLength       = vertexByteCode->size();
+    sd.FragmentSourceData = std::make_shared<const std::string>(fragment.hlsl);
+    sd.FragmentSource     = sd.FragmentSourceData->c_str();
+    sd.FragmentData       = fragmentByteCode;
+    sd.FragmentByteCode   = fragmentByteCode->data();
+    sd.FragmentLength     = fragmentByteCode->size();
+    sd.Name               = def.input.filename().string();
+    sd.Cost               = fragment.metadata.cost;
 
     for(const auto& p : def.params)
     {
@@ -92,11 +131,154 @@ ShaderDef ShaderGC::CompileSourceShader(SourceShaderDef& def, ostream& log, bool
     return sd;
 }
 
-PresetDef* ShaderGC::CompileShader(std::filesystem::path source, ostream& log, bool& warn, const ShaderCache& cache)
+std::vector<ShaderDef> ShaderGC::CompileSourceShaders(std::vector<SourceShaderDef>&   defs,
+                                                      ostream&                        log,
+                                                      bool&                           warn,
+                                                      const ShaderCache&              cache,
+                                                      SourceCache&                    sources,
+                                                      unsigned                        threads,
+                                                      std::vector<TieredShaderStage>* tiered,
+                                                      CompileTrace*                   trace)
 {
-    SourceShaderDef def(source, SourceShaderInfo());
-    ProcessSourceShader(def, log, warn);
-    auto shaderDef = CompileSourceShader(def, log, warn, cache);
+    // every pass is loaded and every stage compiled as a separate task,
+    // logs and warnings are kept per task and merged in pass order afterwards
+    const auto                  numStages = defs.size() * 2;
+    vector<ostringstream>       passLogs(defs.size());
+    vector<ostringstream>       stageLogs(numStages);
+    vector<char>                warnings(defs.size() + numStages);
+    vector<CompiledShaderStage> stages(numStages);
+    vector<string>              keys(numStages);
+    vector<size_t>              owners(numStages); // stage compiled for this one
+    vector<size_t>              unique;
+
+    auto flushLogs = [&]() {
+        for(size_t i = 0; i < defs.size(); i++)
+        {
+            log << passLogs[i].str();
+            log << stageLogs[i * 2].str();
+            log << stageLogs[i * 2 + 1].str();
+        }
+        for(const auto& w : warnings)
+            if(w)
+                warn = true;
+    };
+
+    try
+    {
+        TaskPool::Run(defs.size(), threads, [&](size_t i) {
+            CompileTrace::Scope scope(trace, "load", (int)i);
+            bool                passWarn = false;
+            ProcessSourceShader(defs[i], passLogs[i], passWarn, &sources);
+            warnings[i] = passWarn;
+        });
+
+        // passes repeated in a preset (stock.slang, chained blurs) compile once
+        TaskPool::Run(numStages, threads, [&](size_t i) {
+            const auto& def      = defs[i / 2];
+            const bool  fragment = (i % 2) == 1;
+            keys[i]              = DiskCache::Key(fragment ? def.fragmentSource : def.vertexSource, fragment);
+        });
+        unordered_map<string_view, size_t> firstStage;
+        for(size_t i = 0; i < numStages; i++)
+        {
+            auto first = firstStage.emplace(keys[i], i);
+            owners[i]  = first.first->second;
+            if(first.second)
+                unique.push_back(i);
+            else
+                stageLogs[i] << "Reusing " << ((i % 2) ? "fragment" : "vertex") << " stage of pass " << owners[i] / 2 << endl;
+        }
+        if(trace)
+            trace->Count("stage-repeat", (unsigned)(numStages - unique.size()));
+
+        TaskPool::Run(unique.size(), threads, [&](size_t u) {
+            const auto  i         = unique[u];
+            const auto& def       = defs[i / 2];
+            const bool  fragment  = (i % 2) == 1;
+            bool        stageWarn = false;
+
+            stages[i] = CompileStage(fragment ? def.fragmentSource : def.vertexSource, keys[i], fragment, tiered != nullptr, stageLogs[i], stageWarn, cache, (int)(i / 2), trace);
+            warnings[defs.size() + i] = stageWarn;
+        });
+    }
+    catch(...)
+    {
+        flushLogs();
+        throw;
+    }
+    flushLogs();
+
+    // one buffer per unique stage, also shared with earlier imports still loaded
+    vector<StageCache::ByteCode> byteCodes(numStages);
+    vector<unsigned>             instructions(numStages);
+    for(const auto i : unique)
+    {
+        auto& stage = stages[i];
+        if(tiered && !stage.optimized)
+            instructions[i] = HLSL::InstructionCount(stage.byteCode);
+
+        // preview builds are never handed to other imports
+        if(cache.m_stageCache && stage.optimized)
+            byteCodes[i] = cache.m_stageCache->Share(keys[i], std::move(stage.byteCode));
+        else
+            byteCodes[i] = make_shared<const vector<uint8_t>>(std::move(stage.byteCode));
+    }
+
+    vector<ShaderDef> shaderDefs;
+    shaderDefs.reserve(defs.size());
+    for(size_t i = 0; i < defs.size(); i++)
+    {
+        CompileTrace::Scope scope(trace, "reflect", (int)i);
+        const auto          vertex   = owners[i * 2];
+        const auto          fragment = owners[i * 2 + 1];
+        shaderDefs.push_back(MakeShaderDef(defs[i], stages[vertex], stages[fragment], byteCodes[vertex], byteCodes[fragment]));
+    }
+
+    if(tiered)
+    {
+        for(const auto i : unique)
+        {
+            if(stages[i].optimized)
+                continue;
+
+            TieredShaderStage ts {};
+            for(size_t j = i; j < numStages; j += 2)
+            {
+                if(owners[j] == i)
+                    ts.shaders.push_back(j / 2);
+            }
+            ts.fragment            = (i % 2) == 1;
+            ts.diskKey             = keys[i];
+            ts.previewTime         = stages[i].compileTime;
+            ts.previewInstructions = instructions[i];
+            ts.stage               = std::move(stages[i]);
+            tiered->push_back(std::move(ts));
+        }
+    }
+
+    return shaderDefs;
+}
+
+PresetDef* ShaderGC::CompileShader(std::filesystem::path           source,
+                                   ostream&                        log,
+                                   bool&                           warn,
+                                   const ShaderCache&              cache,
+                                   unsigned                        threads,
+                                   std::vector<TieredShaderStage>* tiered,
+                                   CompileTrace*                   trace)
+{
+    CompileTrace::Scope     scope(trace, "import");
+    SourceCache             sources;
+    vector<SourceShaderDef> defs;
+    defs.emplace_back(source, SourceShaderInfo());
+    auto shaderDefs = CompileSourceShaders(defs, log, warn, cache, sources, threads, tiered, trace);
+    if(trace)
+    {
+        trace->Count("source-hit", sources.Hits());
+        trace->Count("source-miss", sources.Misses());
+    }
+    if(cache.m_diskCache)
+        cache.m_diskCache->Trim();
 
     // dummy preset
     PresetDef* pdef = new PresetDef();
@@ -109,21 +291,23 @@ PresetDef* ShaderGC::CompileShader(std::filesystem::path source, ostream& log, b
         pdef->Name = std::string("???"); // unicode...
     }
     pdef->Category = "Imported";
-    pdef->ShaderDefs.push_back(shaderDef);
+    pdef->ShaderDefs.push_back(shaderDefs.front());
+    pdef->Cost       = ShaderCost::ChainCost(pdef->ShaderDefs);
     pdef->ImportPath = source;
 
     return pdef;
 }
 
-vector<string> ShaderGC::LoadSource(const filesystem::path& input, bool followIncludes)
+// chain holds files currently being expanded, to catch #include cycles
+void ShaderGC::ExpandSource(const filesystem::path& input, bool followIncludes, SourceCache& sources, vector<string>& chain, vector<string>& lines)
 {
-    vector<string> lines;
+    const auto key = input.string();
+    if(std::find(chain.begin(), chain.end(), key) != chain.end())
+        throw file_error("Circular #include of " + key);
 
-    ifstream infile(input);
-    if(!infile.good())
-        throw file_error("Unable to find " + input.string());
-    string line;
-    while(getline(infile, line))
+    const auto source = sources.Lines(input);
+    chain.push_back(key);
+    for(const auto& line : *source)
     {
         if(followIncludes && line.starts_with("#include"))
         {
@@ -134,24 +318,30 @@ vector<string> ShaderGC::LoadSource(const filesystem::path& input, bool followIn
             filesystem::path includePath(input);
             includePath.remove_filename();
             includePath /= filesystem::path(incFile);
-            const auto& includeLines = LoadSource(includePath.lexically_normal(), true);
-            lines.insert(lines.end(), includeLines.begin(), includeLines.end());
+            ExpandSource(includePath.lexically_normal(), true, sources, chain, lines);
         }
         else
             lines.push_back(line);
     }
-    infile.close();
+    chain.pop_back();
+}
 
+vector<string> ShaderGC::LoadSource(const filesystem::path& input, bool followIncludes, SourceCache* sources)
+{
+    SourceCache    localSources;
+    vector<string> chain;
+    vector<string> lines;
+    ExpandSource(input, followIncludes, sources ? *sources : localSources, chain, lines);
     return lines;
 }
 
-void ShaderGC::ProcessSourceShader(SourceShaderDef& def, ostream& log, bool& warn)
+void ShaderGC::ProcessSourceShader(SourceShaderDef& def, ostream& log, bool& warn, SourceCache* sources)
 {
     ostringstream vertexSource;
     ostringstream fragmentSource;
 
     bool        isVertex = true, isFragment = true;
-    const auto& source    = LoadSource(def.input.lexically_normal(), true);
+    const auto& source    = LoadSource(def.input.lexically_normal(), true, sources);
     bool        inComment = false;
     for(const auto& line : source)
     {
@@ -253,7 +443,7 @@ void ShaderGC::ProcessSourceShader(SourceShaderDef& def, ostream& log, bool& war
     def.params.push_back(SourceShaderParam("FrameCount", 1, 0));
 }
 
-int GetSize(const std::string& mtype)
+static int GetSize(const std::string& mtype)
 {
     if(mtype == "float" || mtype == "uint" || mtype == "int")
     {
@@ -281,38 +471,62 @@ int GetSize(const std::string& mtype)
     }
 }
 
-void AddParams(vector<SourceShaderParam>& actualParams, const vector<SourceShaderParam>& declaredParams, json type, int buffer)
+static SourceReflectedBuffer ParseBuffer(const json& types, const json& resource)
 {
-    auto members = type.at("members");
-    for(json::iterator mi = members.begin(); mi != members.end(); ++mi)
+    SourceReflectedBuffer buffer;
+    buffer.binding = resource.contains("binding") ? (int)resource.at("binding") : 0;
+
+    const auto& members = types.at((string)resource.at("type")).at("members");
+    for(const auto& member : members)
     {
-        auto member  = *mi;
-        auto mname   = (string)member.at("name");
-        auto moffset = (int)member.at("offset");
-        auto mtype   = (string)member.at("type");
+        SourceReflectedMember m;
+        m.name   = (string)member.at("name");
+        m.offset = (int)member.at("offset");
+        m.size   = GetSize((string)member.at("type"));
+        buffer.members.push_back(m);
+    }
+    return buffer;
+}
+
+SourceShaderReflection ShaderGC::ParseReflection(const std::string& metadata)
+{
+    SourceShaderReflection reflection;
 
-        bool paramFound = false;
-        int dpi = 0;
-        for(auto& p : declaredParams)
+    auto j     = json::parse(metadata);
+    auto types = j["types"];
+    for(const auto& ubo : j["ubos"])
+        reflection.ubos.push_back(ParseBuffer(types, ubo));
+    for(const auto& pc : j["push_constants"])
+        reflection.pushConstants.push_back(ParseBuffer(types, pc));
+    for(const auto& tx : j["textures"])
+        reflection.textures.push_back(SourceShaderSampler((string)tx.at("name"), (int)tx.at("binding")));
+
+    return reflection;
+}
+
+static void AddParams(vector<SourceShaderParam>&             actualParams,
+                      const vector<SourceShaderParam>&       declaredParams,
+                      const unordered_map<string_view, int>& declaredIndex,
+                      const SourceReflectedBuffer&           reflected,
+                      int                                    buffer)
+{
+    for(const auto& member : reflected.members)
+    {
+        auto dp = declaredIndex.find(member.name);
+        if(dp != declaredIndex.end())
         {
-            if(p.name == mname)
-            {
-                SourceShaderParam actualParam(p);
-                actualParam.i      = dpi;
-                actualParam.buffer = buffer;
-                actualParam.offset = moffset;
-                actualParam.size   = GetSize(mtype);
-                actualParams.emplace_back(actualParam);
-                paramFound = true;
-            }
-            dpi++;
+            SourceShaderParam actualParam(declaredParams[dp->second]);
+            actualParam.i      = dp->second;
+            actualParam.buffer = buffer;
+            actualParam.offset = member.offset;
+            actualParam.size   = member.size;
+            actualParams.emplace_back(actualParam);
         }
-
-        if(!paramFound)
+        else
         {
             // alias/built-in param?
-            SourceShaderParam newParam(mname, GetSize(mtype), 0);
-            newParam.offset = moffset;
+            SourceShaderParam newParam(member.name, member.size, 0);
+            newParam.offset = member.offset;
             newParam.buffer = buffer;
             newParam.i      = 0;
             actualParams.emplace_back(newParam);
@@ -320,38 +534,25 @@ void AddParams(vector<SourceShaderParam>& actualParams, const vector<SourceShade
     }
 }
 
-std::vector<SourceShaderParam> ShaderGC::LookupParams(const std::vector<SourceShaderParam>& declaredParams, vector<SourceShaderSampler>& textures, const std::string& metadata)
+std::vector<SourceShaderParam>
+ShaderGC::LookupParams(const std::vector<SourceShaderParam>& declaredParams, vector<SourceShaderSampler>& textures, const SourceShaderReflection& metadata)
 {
     vector<SourceShaderParam> actualParams;
 
-    auto j     = json::parse(metadata);
-    auto types = j["types"];
-    auto ubos  = j["ubos"];
-    for(json::iterator it = ubos.begin(); it != ubos.end(); ++it)
-    {
-        auto ubo     = *it;
-        auto typeNo  = ubo.at("type");
-        auto binding = (int)ubo.at("binding");
-        auto type    = types.at((string)typeNo);
-        AddParams(actualParams, declaredParams, type, binding);
-    }
+    // first declaration wins
+    unordered_map<string_view, int> declaredIndex;
+    declaredIndex.reserve(declaredParams.size());
+    for(int dpi = 0; dpi < (int)declaredParams.size(); dpi++)
+        declaredIndex.emplace(declaredParams[dpi].name, dpi);
 
-    auto pcs = j["push_constants"];
-    int  ci  = -1;
-    for(json::iterator it = pcs.begin(); it != pcs.end(); ++it)
-    {
-        auto pc     = *it;
-        auto typeNo = pc.at("type");
-        auto type   = types.at((string)typeNo);
-        AddParams(actualParams, declaredParams, type, ci--);
-    }
+    for(const auto& ubo : metadata.ubos)
+        AddParams(actualParams, declaredParams, declaredIndex, ubo, ubo.binding);
 
-    auto txs = j["textures"];
-    for(json::iterator it = txs.begin(); it != txs.end(); ++it)
-    {
-        auto tx = *it;
-        textures.push_back(SourceShaderSampler((string)tx.at("name"), (int)tx.at("binding")));
-    }
+    int ci = -1;
+    for(const auto& pc : metadata.pushConstants)
+        AddParams(actualParams, declaredParams, declaredIndex, pc, ci--);
+
+    textures.insert(textures.end(), metadata.textures.begin(), metadata.textures.end());
 
     std::sort(actualParams.begin(), actualParams.end(), [](const SourceShaderParam& a, const SourceShaderParam& b) { return a.i < b.i; });
 
@@ -481,13 +682,20 @@ void setPresetParams(SourceTextureDef& def, std::string name, const map<string,
     setPresetParam(name + "_", def, "mipmap", keyValues, seenKeys);
 }
 
-void ShaderGC::ParsePreset(const std::filesystem::path& input, std::map<std::string, std::string>& keyValues, std::map<std::string, std::filesystem::path>& valuePaths)
+// chain holds presets currently being parsed, to catch #reference cycles
+void ShaderGC::ParsePresetFile(const std::filesystem::path&                  input,
+                               std::map<std::string, std::string>&           keyValues,
+                               std::map<std::string, std::filesystem::path>& valuePaths,
+                               SourceCache&                                  sources,
+                               std::vector<std::string>&                     chain)
 {
-    ifstream infile(input.lexically_normal());
-    if(!infile.good())
-        throw file_error("Unable to find " + input.lexically_normal().string());
-    string line;
-    while(getline(infile, line))
+    const auto key = input.lexically_normal().string();
+    if(std::find(chain.begin(), chain.end(), key) != chain.end())
+        throw file_error("Circular #reference of " + key);
+
+    const auto source = sources.Lines(input.lexically_normal());
+    chain.push_back(key);
+    for(const auto& line : *source)
     {
         if(line.starts_with("#reference"))
         {
@@ -498,7 +706,7 @@ void ShaderGC::ParsePreset(const std::filesystem::path& input, std::map<std::str
             filesystem::path includePath(input);
             includePath.remove_filename();
             includePath /= filesystem::path(incFile);
-            ParsePreset(includePath, keyValues, valuePaths);
+            ParsePresetFile(includePath, keyValues, valuePaths, sources, chain);
         }
         else if(line.starts_with("#"))
         {
@@ -511,16 +719,39 @@ void ShaderGC::ParsePreset(const std::filesystem::path& input, std::map<std::str
             valuePaths[kv.first] = input.parent_path();
         }
     }
-    infile.close();
+    chain.pop_back();
 }
 
-PresetDef* ShaderGC::CompilePreset(std::filesystem::path input, ostream& log, bool& warn, const ShaderCache& cache)
+void ShaderGC::ParsePreset(const std::filesystem::path&                  input,
+                           std::map<std::string, std::string>&           keyValues,
+                           std::map<std::string, std::filesystem::path>& valuePaths,
+                           SourceCache*                                  sources)
+{
+    SourceCache    localSources;
+    vector<string> chain;
+    ParsePresetFile(input, keyValues, valuePaths, sources ? *sources : localSources, chain);
+}
+
+PresetDef* ShaderGC::CompilePreset(std::filesystem::path           input,
+                                   ostream&                        log,
+                                   bool&                           warn,
+                                   const ShaderCache&              cache,
+                                   unsigned                        threads,
+                                   std::vector<TieredShaderStage>* tiered,
+                                   CompileTrace*                   trace)
 {
     if(_stricmp(input.extension().string().c_str(), ".slang") == 0)
-        return CompileShader(input, log, warn, cache);
+        return CompileShader(input, log, warn, cache, threads, tiered, trace);
+
+    CompileTrace::Scope scope(trace, "import");
 
+    // every file of this import is read once
+    SourceCache     sources;
     SourcePresetDef sp(input, SourceShaderInfo());
-    ProcessSourcePreset(sp, log, warn);
+    {
+        CompileTrace::Scope presetScope(trace, "preset");
+        ProcessSourcePreset(sp, log, warn, &sources);
+    }
 
     PresetDef* def = new PresetDef();
     try
@@ -533,11 +764,18 @@ PresetDef* ShaderGC::CompilePreset(std::filesystem::path input, ostream& log, bo
     }
     def->Category = "Imported";
 
-    for(auto& s : sp.shaders)
+    auto shaderDefs = CompileSourceShaders(sp.shaders, log, warn, cache, sources, threads, tiered, trace);
+    if(cache.m_diskCache)
+        cache.m_diskCache->Trim();
+    if(trace)
+    {
+        trace->Count("source-hit", sources.Hits());
+        trace->Count("source-miss", sources.Misses());
+    }
+    for(size_t i = 0; i < sp.shaders.size(); i++)
     {
-        ProcessSourceShader(s, log, warn);
-        auto sd = CompileSourceShader(s, log, warn, cache);
-        for(auto& pp : s.presetParams)
+        auto& sd = shaderDefs[i];
+        for(auto& pp : sp.shaders[i].presetParams)
         {
             sd.Param(pp.first.c_str(), pp.second.c_str());
         }
@@ -546,7 +784,8 @@ PresetDef* ShaderGC::CompilePreset(std::filesystem::path input, ostream& log, bo
 
     for(auto& t : sp.textures)
     {
-        auto td = CompileTexture(t.input, log, warn);
+        CompileTrace::Scope textureScope(trace, "texture");
+        auto                td = CompileTexture(t.input, log, warn);
         for(auto& pp : t.presetParams)
         {
             td.Param(pp.first.c_str(), pp.second.c_str());
@@ -559,18 +798,204 @@ PresetDef* ShaderGC::CompilePreset(std::filesystem::path input, ostream& log, bo
         def->OverrideParam(CopyString(o.name), o.def);
     }
 
+    def->Cost       = ShaderCost::ChainCost(def->ShaderDefs);
     def->ImportPath = input;
 
     return def;
 }
 
-void ShaderGC::ProcessSourcePreset(SourcePresetDef& def, std::ostream& log, bool& warn)
+void ShaderGC::OptimizeStages(std::vector<TieredShaderStage>& stages,
+                              std::ostream&                   log,
+                              bool&                           warn,
+                              const ShaderCache&              cache,
+                              unsigned                        threads,
+                              const std::atomic<bool>&        cancel,
+                              CompileTrace*                   trace)
+{
+    vector<ostringstream> stageLogs(stages.size());
+    vector<char>          warnings(stages.size());
+
+    TaskPool::Run(stages.size(), threads, [&](size_t i) {
+        if(cancel)
+            return;
+
+        auto&               ts = stages[i];
+        CompileTrace::Scope scope(trace, "fxc", (int)ts.shaders.front(), ts.fragment);
+        try
+        {
+            bool       stageWarn = false;
+            unsigned   retries   = 0;
+            const auto start     = chrono::steady_clock::now();
+            auto byteCode = HLSL::CompileHLSL(ts.stage.hlsl.c_str(), ts.stage.hlsl.size(), ts.fragment ? "ps_5_0" : "vs_5_0", true, true, stageLogs[i], stageWarn, &retries);
+            scope.Retries(retries);
+
+            ts.stage.compileTime     = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            ts.stage.byteCode        = std::move(byteCode);
+            ts.stage.optimized       = true;
+            ts.optimizedInstructions = HLSL::InstructionCount(ts.stage.byteCode);
+            warnings[i]              = stageWarn;
+
+            if(cache.m_diskCache)
+                cache.m_diskCache->Store(ts.diskKey, ts.stage);
+
+            // buffer handed to ApplyStages, bytecode is no longer needed here
+            if(cache.m_stageCache)
+                ts.byteCode = cache.m_stageCache->Share(ts.diskKey, std::move(ts.stage.byteCode));
+            else
+                ts.byteCode = make_shared<const vector<uint8_t>>(std::move(ts.stage.byteCode));
+        }
+        catch(std::exception& ex)
+        {
+            // keep the preview build
+            scope.Result("error");
+            stageLogs[i] << ex.what() << endl;
+            warnings[i] = true;
+        }
+    });
+
+    double previewTotal = 0, optimizedTotal = 0;
+    log << "Tiered compile report (FXC ms, instructions)" << endl;
+    for(size_t i = 0; i < stages.size(); i++)
+    {
+        const auto& ts = stages[i];
+        log << stageLogs[i].str();
+        log << "Pass " << ts.shaders.front() << (ts.fragment ? " fragment: " : " vertex: ") << "preview " << fixed << setprecision(1) << ts.previewTime << " ms, "
+            << ts.previewInstructions << " instr";
+        if(ts.stage.optimized)
+        {
+            log << "; optimized " << ts.stage.compileTime << " ms, " << ts.optimizedInstructions << " instr" << endl;
+            optimizedTotal += ts.stage.compileTime;
+        }
+        else
+        {
+            log << "; not optimized" << endl;
+        }
+        previewTotal += ts.previewTime;
+        if(warnings[i])
+            warn = true;
+    }
+    log << "Total preview " << previewTotal << " ms, optimized " << optimizedTotal << " ms" << endl;
+}
+
+void ShaderGC::ApplyStages(PresetDef& def, const std::vector<TieredShaderStage>& stages)
+{
+    for(const auto& ts : stages)
+    {
+        if(!ts.stage.optimized || !ts.byteCode)
+            continue;
+
+        for(const auto shader : ts.shaders)
+        {
+            if(shader >= def.ShaderDefs.size())
+                continue;
+
+            // previous buffer is released with its last user
+            auto& sd = def.ShaderDefs[shader];
+            if(ts.fragment)
+            {
+                sd.FragmentData     = ts.byteCode;
+                sd.FragmentByteCode = ts.byteCode->data();
+                sd.FragmentLength   = ts.byteCode->size();
+            }
+            else
+            {
+                sd.VertexData     = ts.byteCode;
+                sd.VertexByteCode = ts.byteCode->data();
+                sd.VertexLength   = ts.byteCode->size();
+            }
+        }
+    }
+}
+
+// parses "float <name> : packoffset(cN.c);" members of cbuffers emitted by SPIRV-Cross
+static bool ParseFloatMember(const std::string& line, std::string& name, int& offset)
+{
+    auto trimLine = trim(line);
+    if(!trimLine.starts_with("float "))
+        return false;
+
+    auto colon = trimLine.find(" : packoffset(c");
+    if(colon == string::npos)
+        return false;
+
+    name = trimLine.substr(6, colon - 6);
+    if(name.find_first_of(" [") != string::npos)
+        return false;
+
+    auto reg = trimLine.c_str() + colon + 15;
+    offset   = atoi(reg) * 16;
+    auto dot = strchr(reg, '.');
+    if(dot != nullptr && dot[1] != '\0')
+    {
+        static const char sComponents[] = "xyzw";
+
+        auto component = strchr(sComponents, dot[1]);
+        if(component == nullptr)
+            return false;
+        offset += (int)(component - sComponents) * 4;
+    }
+    return true;
+}
+
+std::string ShaderGC::SpecializeHLSL(const std::string& hlsl, const std::vector<const ShaderParam*>& frozen)
+{
+    ostringstream output;
+    ostringstream constants;
+    istringstream input(hlsl);
+    string        line;
+    bool          inBuffer = false;
+    int           buffer   = 0;
+
+    constants << scientific << setprecision(9);
+    while(getline(input, line))
+    {
+        if(line.starts_with("cbuffer "))
+        {
+            // UBOs keep their binding as register, push constants get none
+            auto reg = line.find("register(b");
+            buffer   = reg == string::npos ? -1 : atoi(line.c_str() + reg + 10);
+            inBuffer = true;
+        }
+        else if(inBuffer && line.starts_with("};"))
+        {
+            // constants follow the cbuffer so they're visible to all functions
+            output << line << endl;
+            output << constants.str();
+            constants.str("");
+            inBuffer = false;
+            continue;
+        }
+        else if(inBuffer)
+        {
+            string name;
+            int    offset;
+            if(ParseFloatMember(line, name, offset))
+            {
+                for(const auto p : frozen)
+                {
+                    if(p->size == 4 && p->buffer == buffer && p->offset == offset && name.size() > p->name.size() && name.ends_with(p->name) && name[name.size() - p->name.size() - 1] == '_')
+                    {
+                        // member is renamed out of the way, layout stays the same
+                        auto pos = line.find(name);
+                        line.replace(pos, name.size(), name + "_frozen");
+                        constants << "static const float " << name << " = " << p->currentValue << ";" << endl;
+                        break;
+                    }
+                }
+            }
+        }
+        output << line << endl;
+    }
+    return output.str();
+}
+
+void ShaderGC::ProcessSourcePreset(SourcePresetDef& def, std::ostream& log, bool& warn, SourceCache* sources)
 {
     map<string, string>           keyValues;
     map<string, filesystem::path> keyPaths;
     unordered_set<string>         seenKeys;
 
-    ParsePreset(def.input, keyValues, keyPaths);
+    ParsePreset(def.input, keyValues, keyPaths, sources);
 
     auto numShaders = atoi(getValue("shaders", -1, keyValues, seenKeys).c_str());
     for(int i = 0; i < numShaders; i++)
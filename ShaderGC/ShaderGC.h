@@ -10,6 +10,10 @@ GNU General Public License v3.0
 #include "PresetDef.h"
 #include "SourceDefs.h"
 #include "ShaderCache.h"
+#include "SourceCache.h"
+#include "CompileTrace.h"
+
+#include <atomic>
 
 class file_error : public std::runtime_error
 {
@@ -21,22 +25,102 @@ public:
     explicit file_error(const char* _Message) : _Mybase(_Message) { }
 };
 
+// stage built at preview optimisation level by a tiered import, rebuilt by OptimizeStages
+struct TieredShaderStage
+{
+    std::vector<size_t>  shaders; // indices into PresetDef::ShaderDefs sharing this stage
+    bool                 fragment;
+    std::string          diskKey;
+    CompiledShaderStage  stage;
+    StageCache::ByteCode byteCode; // optimised build, shared with other imports
+    double               previewTime;
+    unsigned             previewInstructions;
+    unsigned             optimizedInstructions;
+};
+
 class ShaderGC
 {
 public:
-    static PresetDef* CompilePreset(std::filesystem::path source, std::ostream& log, bool& warn, const ShaderCache& cache);
+    // threads: 1 - compile passes one by one, 0 - use all cores
+    // tiered: when given, stages are built at preview level and listed for OptimizeStages
+    // trace: when given, receives timings of every compile stage and cache lookup
+    static PresetDef* CompilePreset(std::filesystem::path           source,
+                                    std::ostream&                   log,
+                                    bool&                           warn,
+                                    const ShaderCache&              cache,
+                                    unsigned                        threads = 1,
+                                    std::vector<TieredShaderStage>* tiered  = nullptr,
+                                    CompileTrace*                   trace   = nullptr);
+
+    // rebuilds preview stages at full optimisation, stops early when cancelled;
+    // stages that completed have optimized set, comparison report goes to log
+    static void OptimizeStages(std::vector<TieredShaderStage>& stages,
+                               std::ostream&                   log,
+                               bool&                           warn,
+                               const ShaderCache&              cache,
+                               unsigned                        threads,
+                               const std::atomic<bool>&        cancel,
+                               CompileTrace*                   trace = nullptr);
+
+    // replaces bytecode of shader stages with the optimised builds
+    static void ApplyStages(PresetDef& def, const std::vector<TieredShaderStage>& stages);
+
+    // rewrites generated HLSL so the given float parameters become compile-time constants
+    // at their current values; cbuffer layout is left intact
+    static std::string SpecializeHLSL(const std::string& hlsl, const std::vector<const ShaderParam*>& frozen);
     static TextureDef CompileTexture(std::filesystem::path source, std::ostream& log, bool& warn);
 
-    static std::vector<std::string> LoadSource(const std::filesystem::path& input, bool followIncludes);
-    static void                     ProcessSourceShader(SourceShaderDef& def, std::ostream& log, bool& warn);
-    static void                     ProcessSourcePreset(SourcePresetDef& def, std::ostream& log, bool& warn);
+    // sources: shared across an import so files are read once, a private cache is used when null
+    static std::vector<std::string> LoadSource(const std::filesystem::path& input, bool followIncludes, SourceCache* sources = nullptr);
+    static void                     ProcessSourceShader(SourceShaderDef& def, std::ostream& log, bool& warn, SourceCache* sources = nullptr);
+    static void                     ProcessSourcePreset(SourcePresetDef& def, std::ostream& log, bool& warn, SourceCache* sources = nullptr);
 
-    static void ParsePreset(const std::filesystem::path& input, std::map<std::string, std::string>& keyValues, std::map<std::string, std::filesystem::path>& valuePaths);
+    static void ParsePreset(const std::filesystem::path&                  input,
+                            std::map<std::string, std::string>&           keyValues,
+                            std::map<std::string, std::filesystem::path>& valuePaths,
+                            SourceCache*                                  sources = nullptr);
 
     static std::vector<SourceShaderParam>
-    LookupParams(const std::vector<SourceShaderParam>& declaredParams, std::vector<SourceShaderSampler>& textures, const std::string& metadata);
+    LookupParams(const std::vector<SourceShaderParam>& declaredParams, std::vector<SourceShaderSampler>& textures, const SourceShaderReflection& metadata);
+
+    // converts spirv-cross --reflect JSON output
+    static SourceShaderReflection ParseReflection(const std::string& metadata);
 
 private:
-    static ShaderDef  CompileSourceShader(SourceShaderDef& def, std::ostream& log, bool& warn, const ShaderCache& cache);
-    static PresetDef* CompileShader(std::filesystem::path source, std::ostream& log, bool& warn, const ShaderCache& cache);
+    // diskKey: DiskCache::Key of source
+    static CompiledShaderStage CompileStage(const std::string& source,
+                                            const std::string& diskKey,
+                                            bool               fragment,
+                                            bool               preview,
+                                            std::ostream&      log,
+                                            bool&              warn,
+                                            const ShaderCache& cache,
+                                            int                pass,
+                                            CompileTrace*      trace);
+    static ShaderDef              MakeShaderDef(SourceShaderDef&            def,
+                                                const CompiledShaderStage&  vertex,
+                                                const CompiledShaderStage&  fragment,
+                                                const StageCache::ByteCode& vertexByteCode,
+                                                const StageCache::ByteCode& fragmentByteCode);
+    static std::vector<ShaderDef> CompileSourceShaders(std::vector<SourceShaderDef>&   defs,
+                                                       std::ostream&                   log,
+                                                       bool&                           warn,
+                                                       const ShaderCache&              cache,
+                                                       SourceCache&                    sources,
+                                                       unsigned                        threads,
+                                                       std::vector<TieredShaderStage>* tiered,
+                                                       CompileTrace*                   trace);
+    static void ExpandSource(const std::filesystem::path& input, bool followIncludes, SourceCache& sources, std::vector<std::string>& chain, std::vector<std::string>& lines);
+    static void ParsePresetFile(const std::filesystem::path&                  input,
+                                std::map<std::string, std::string>&           keyValues,
+                                std::map<std::string, std::filesystem::path>& valuePaths,
+                                SourceCache&                                  sources,
+                                std::vector<std::string>&                     chain);
+    static PresetDef* CompileShader(std::filesystem::path           source,
+                                    std::ostream&                   log,
+                                    bool&                           warn,
+                                    const ShaderCache&              cache,
+                                    unsigned                        threads,
+                                    std::vector<TieredShaderStage>* tiered,
+                                    CompileTrace*                   trace);
 };
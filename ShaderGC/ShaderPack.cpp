@@ -0,0 +1,295 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "ShaderPack.h"
+#include "ShaderDef.h"
+#include "TextureDef.h"
+#include "ShaderCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// bump when layout changes, older packs are then rejected
+static const uint32_t sPackVersion = 1;
+static const char     sPackMagic[4] {'S', 'G', 'P', 'K'};
+static const size_t   sPackAlignment = 16;
+
+struct PackHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t count;
+    uint32_t namesSize;
+};
+
+ShaderPack::~ShaderPack()
+{
+    Close();
+}
+
+bool ShaderPack::Open(const std::filesystem::path& path)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize {};
+    HANDLE        mapping = NULL;
+    if(GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+        mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if(!mapping)
+        return false;
+
+    // the view keeps the mapping alive
+    m_view = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    m_size = (size_t)fileSize.QuadPart;
+    CloseHandle(mapping);
+#else
+    int file = open(path.c_str(), O_RDONLY);
+    if(file < 0)
+        return false;
+
+    struct stat st {};
+    void*       view = MAP_FAILED;
+    if(fstat(file, &st) == 0 && st.st_size > 0)
+        view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if(view == MAP_FAILED)
+        return false;
+
+    m_view = (const uint8_t*)view;
+    m_size = (size_t)st.st_size;
+#endif
+    if(!m_view)
+        return false;
+
+    // only the header and index are checked, entries are paged in when used
+    PackHeader header;
+    if(m_size < sizeof(header))
+    {
+        Close();
+        return false;
+    }
+    memcpy(&header, m_view, sizeof(header));
+
+    const size_t indexSize = (size_t)header.count * sizeof(IndexEntry);
+    if(memcmp(header.magic, sPackMagic, sizeof(sPackMagic)) != 0 || header.version != sPackVersion || m_size < sizeof(header) + indexSize + header.namesSize)
+    {
+        Close();
+        return false;
+    }
+
+    m_index = (const IndexEntry*)(m_view + sizeof(header));
+    m_count = header.count;
+    for(uint32_t i = 0; i < m_count; i++)
+    {
+        const auto& e = m_index[i];
+        if((uint64_t)e.nameOffset + e.nameLength > header.namesSize || e.offset > m_size || e.size > m_size - e.offset)
+        {
+            Close();
+            return false;
+        }
+    }
+    return true;
+}
+
+void ShaderPack::Close()
+{
+    if(m_view)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(m_view);
+#else
+        munmap((void*)m_view, m_size);
+#endif
+    }
+    m_view  = nullptr;
+    m_size  = 0;
+    m_index = nullptr;
+    m_count = 0;
+}
+
+std::string_view ShaderPack::EntryName(const IndexEntry& entry) const
+{
+    const auto names = (const char*)(m_index + m_count);
+    return std::string_view(names + entry.nameOffset, entry.nameLength);
+}
+
+bool ShaderPack::Find(std::string_view name, const uint8_t*& data, size_t& size) const
+{
+    const auto end = m_index + m_count;
+    const auto it  = lower_bound(m_index, end, name, [this](const IndexEntry& e, std::string_view n) { return EntryName(e) < n; });
+    if(it == end || EntryName(*it) != name)
+        return false;
+
+    data = m_view + it->offset;
+    size = (size_t)it->size;
+    return true;
+}
+
+std::vector<std::string> ShaderPack::Names() const
+{
+    vector<string> names;
+    for(uint32_t i = 0; i < m_count; i++)
+        names.emplace_back(EntryName(m_index[i]));
+    return names;
+}
+
+void ShaderPack::Bind(ShaderDef& def, const char* className) const
+{
+    const string   name(className);
+    const uint8_t* vertexHash;
+    const uint8_t* fragmentHash;
+    size_t         vertexHashSize, fragmentHashSize;
+    if(!Find(name + ".vs", def.VertexByteCode, def.VertexLength) || !Find(name + ".ps", def.FragmentByteCode, def.FragmentLength) ||
+       !Find(name + ".vsh", vertexHash, vertexHashSize) || !Find(name + ".psh", fragmentHash, fragmentHashSize))
+        throw std::runtime_error("Shader " + name + " is missing from shader pack");
+
+    def.VertexHash   = (const uint32_t*)vertexHash;
+    def.FragmentHash = (const uint32_t*)fragmentHash;
+}
+
+void ShaderPack::Bind(TextureDef& def, const char* className) const
+{
+    size_t size;
+    if(!Find(className, def.Data, size))
+        throw std::runtime_error("Texture " + string(className) + " is missing from shader pack");
+
+    def.DataLength = (int)size;
+}
+
+void ShaderPack::AddCachedShaders(std::vector<CachedShader>& cached) const
+{
+    // hashes are read from the index only, bytecode stays unmapped until a shader is used;
+    // shaders sharing a stage share its hash entry, which is added once
+    unordered_set<uint64_t> added;
+    for(uint32_t i = 0; i < m_count; i++)
+    {
+        const auto& name = EntryName(m_index[i]);
+        if((!name.ends_with(".vsh") && !name.ends_with(".psh")) || !added.insert(m_index[i].offset).second)
+            continue;
+
+        const uint8_t* data;
+        size_t         size;
+        if(m_index[i].size >= HASH_LEN * sizeof(uint32_t) && Find(name.substr(0, name.size() - 1), data, size))
+            cached.emplace_back((const uint32_t*)(m_view + m_index[i].offset), data, size);
+    }
+}
+
+size_t ShaderPack::Write(const std::filesystem::path& path, const std::map<std::string, std::vector<uint8_t>>& entries)
+{
+    PackHeader header;
+    memcpy(header.magic, sPackMagic, sizeof(sPackMagic));
+    header.version   = sPackVersion;
+    header.count     = (uint32_t)entries.size();
+    header.namesSize = 0;
+    for(const auto& e : entries)
+        header.namesSize += (uint32_t)e.first.size();
+
+    // std::map keeps entries sorted by name, which Find relies on; entries with the same
+    // content are stored once and their index entries point to the same data
+    vector<IndexEntry>                   index;
+    vector<const vector<uint8_t>*>       stored;
+    unordered_map<string_view, uint64_t> offsets;
+    uint64_t                             offset     = sizeof(header) + entries.size() * sizeof(IndexEntry) + header.namesSize;
+    uint32_t                             nameOffset = 0;
+    size_t                               saved      = 0;
+    for(const auto& e : entries)
+    {
+        const string_view content((const char*)e.second.data(), e.second.size());
+        const auto        existing = offsets.find(content);
+        if(existing != offsets.end())
+        {
+            index.push_back({nameOffset, (uint32_t)e.first.size(), existing->second, e.second.size()});
+            saved += e.second.size();
+        }
+        else
+        {
+            offset = (offset + sPackAlignment - 1) / sPackAlignment * sPackAlignment;
+            index.push_back({nameOffset, (uint32_t)e.first.size(), offset, e.second.size()});
+            offsets.emplace(content, offset);
+            stored.push_back(&e.second);
+            offset += e.second.size();
+        }
+        nameOffset += (uint32_t)e.first.size();
+    }
+
+    // written to a temporary name and renamed so a running ShaderGlass never sees a partial pack
+    auto tempPath = path;
+    tempPath += ".tmp";
+    {
+        ofstream out(tempPath, ios::binary | ios::trunc);
+        out.write((const char*)&header, sizeof(header));
+        out.write((const char*)index.data(), index.size() * sizeof(IndexEntry));
+        for(const auto& e : entries)
+            out.write(e.first.data(), e.first.size());
+
+        for(const auto& data : stored)
+        {
+            const auto         position = (uint64_t)out.tellp();
+            const vector<char> padding(offsets[string_view((const char*)data->data(), data->size())] - position, 0);
+            out.write(padding.data(), padding.size());
+            out.write((const char*)data->data(), data->size());
+        }
+        if(!out.good())
+            throw std::runtime_error("Unable to write shader pack " + tempPath.string());
+    }
+    filesystem::rename(tempPath, path);
+    return saved;
+}
+
+void ShaderPack::Read(const std::filesystem::path& path, std::map<std::string, std::vector<uint8_t>>& entries)
+{
+    ShaderPack pack;
+    if(!pack.Open(path))
+        return;
+
+    for(uint32_t i = 0; i < pack.m_count; i++)
+    {
+        const auto& e    = pack.m_index[i];
+        const auto  data = pack.m_view + e.offset;
+        entries[string(pack.EntryName(e))].assign(data, data + e.size);
+    }
+}
+
+const ShaderPack& ShaderPack::Library()
+{
+    static ShaderPack library;
+    static once_flag  opened;
+    call_once(opened, [] {
+#ifdef _WIN32
+        wchar_t modulePath[MAX_PATH];
+        GetModuleFileNameW(NULL, modulePath, MAX_PATH);
+        library.Open(filesystem::path(modulePath).replace_filename("RetroArch.pack"));
+#else
+        library.Open("RetroArch.pack");
+#endif
+    });
+    return library;
+}
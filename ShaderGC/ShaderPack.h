@@ -0,0 +1,67 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <string_view>
+
+class ShaderDef;
+class TextureDef;
+struct CachedShader;
+
+// indexed binary file with bytecode, hashes and texture data of the built-in library, written
+// by ShaderGen -pack; it is memory-mapped so only entries of presets in use get paged in.
+// layout: header, index sorted by name, names, then entries aligned to 16 bytes
+class ShaderPack
+{
+public:
+    ShaderPack() = default;
+    ~ShaderPack();
+
+    ShaderPack(const ShaderPack&)            = delete;
+    ShaderPack& operator=(const ShaderPack&) = delete;
+
+    // false when the file is missing or damaged, the pack is then empty
+    bool Open(const std::filesystem::path& path);
+    void Close();
+
+    bool IsOpen() const
+    {
+        return m_view != nullptr;
+    }
+
+    bool                     Find(std::string_view name, const uint8_t*& data, size_t& size) const;
+    std::vector<std::string> Names() const;
+
+    // entries of shader className are className.vs/.ps (DXBC) and .vsh/.psh (source hashes)
+    void Bind(ShaderDef& def, const char* className) const;
+    void Bind(TextureDef& def, const char* className) const;
+    void AddCachedShaders(std::vector<CachedShader>& cached) const;
+
+    // entries with the same content are stored once, returns bytes saved that way
+    static size_t Write(const std::filesystem::path& path, const std::map<std::string, std::vector<uint8_t>>& entries);
+    static void   Read(const std::filesystem::path& path, std::map<std::string, std::vector<uint8_t>>& entries);
+
+    // RetroArch.pack next to the executable, mapped on first use
+    static const ShaderPack& Library();
+
+private:
+    struct IndexEntry
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    std::string_view EntryName(const IndexEntry& entry) const;
+
+    const uint8_t*    m_view {nullptr};
+    size_t            m_size {0};
+    const IndexEntry* m_index {nullptr};
+    uint32_t          m_count {0};
+};
@@ -0,0 +1,66 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "SourceCache.h"
+#include "ShaderGC.h"
+
+using namespace std;
+
+static vector<string> SplitLines(const string& content)
+{
+    vector<string> lines;
+    size_t         start = 0;
+    while(start < content.size())
+    {
+        auto end = content.find('\n', start);
+        if(end == string::npos)
+            end = content.size();
+        auto len = end - start;
+        if(len && content[start + len - 1] == '\r')
+            len--;
+        lines.emplace_back(content, start, len);
+        start = end + 1;
+    }
+    return lines;
+}
+
+std::shared_ptr<const std::vector<std::string>> SourceCache::Lines(const std::filesystem::path& input)
+{
+    const auto key = input.string();
+
+    std::error_code ec;
+    const auto      time = filesystem::last_write_time(input, ec);
+    const auto      size = ec ? 0 : filesystem::file_size(input, ec);
+    if(ec)
+        throw file_error("Unable to find " + key);
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto              it = m_entries.find(key);
+        if(it != m_entries.end() && it->second.time == time && it->second.size == size)
+        {
+            m_hits++;
+            return it->second.lines;
+        }
+    }
+    m_misses++;
+
+    // read outside the lock, concurrent misses on the same file are harmless
+    ifstream infile(input, ios::binary);
+    if(!infile.good())
+        throw file_error("Unable to find " + key);
+    string content((istreambuf_iterator<char>(infile)), istreambuf_iterator<char>());
+    infile.close();
+
+    auto lines = make_shared<const vector<string>>(SplitLines(content));
+
+    lock_guard<mutex> lock(m_mutex);
+    m_entries[key] = Entry {time, size, lines};
+    return lines;
+}
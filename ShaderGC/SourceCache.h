@@ -0,0 +1,44 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+// source files read during an import, split into lines; the same #include headers
+// are pulled into many passes so each file is read once, and entries are revalidated
+// against file size and modification time so edits between lookups are picked up
+class SourceCache
+{
+public:
+    std::shared_ptr<const std::vector<std::string>> Lines(const std::filesystem::path& input);
+
+    // lookups served from memory and files read from disk, for compile traces
+    unsigned Hits() const
+    {
+        return m_hits;
+    }
+
+    unsigned Misses() const
+    {
+        return m_misses;
+    }
+
+private:
+    struct Entry
+    {
+        std::filesystem::file_time_type                 time;
+        uintmax_t                                       size;
+        std::shared_ptr<const std::vector<std::string>> lines;
+    };
+
+    std::mutex                             m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    std::atomic<unsigned>                  m_hits {0};
+    std::atomic<unsigned>                  m_misses {0};
+};
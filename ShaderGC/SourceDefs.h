@@ -8,6 +8,7 @@ GNU General Public License v3.0
 #pragma once
 
 #include "framework.h"
+#include "ShaderCost.h"
 
 static inline void ltrim(std::string& s)
 {
@@ -81,6 +82,28 @@ struct SourceShaderSampler
     int         binding;
 };
 
+struct SourceReflectedMember
+{
+    std::string name;
+    int         offset;
+    int         size;
+};
+
+struct SourceReflectedBuffer
+{
+    int                                binding;
+    std::vector<SourceReflectedMember> members;
+};
+
+// uniform and texture layout reflected from fragment SPIR-V, with its static cost
+struct SourceShaderReflection
+{
+    std::vector<SourceReflectedBuffer> ubos;
+    std::vector<SourceReflectedBuffer> pushConstants;
+    std::vector<SourceShaderSampler>   textures;
+    StageCost                          cost;
+};
+
 struct SourcePresetTexture
 {
     SourcePresetTexture(std::string name) : name {name}, source {}, linear {}, wrap {}, mipmap {} { }
@@ -107,13 +130,13 @@ struct SourceShaderDef
 
     std::filesystem::path              input;
     std::string                        vertexSource;
-    std::string                        vertexByteCode;
-    std::string                        vertexMetadata;
+    std::vector<uint8_t>               vertexByteCode;
+    SourceShaderReflection             vertexMetadata;
     std::string                        fragmentSource;
-    std::string                        fragmentByteCode;
-    std::string                        fragmentMetadata;
-    std::string                        vertexHash;
-    std::string                        fragmentHash;
+    std::vector<uint8_t>               fragmentByteCode;
+    SourceShaderReflection             fragmentMetadata;
+    std::vector<uint32_t>              vertexHash;
+    std::vector<uint32_t>              fragmentHash;
     std::vector<SourceShaderParam>     params;
     SourceShaderInfo                   info;
     std::string                        format;
@@ -126,7 +149,6 @@ struct SourceTextureDef
     SourceTextureDef(const std::filesystem::path& input, SourceShaderInfo info) : input {input}, info {info} { }
 
     std::filesystem::path              input;
-    std::string                        data;
     SourceShaderInfo                   info;
     std::map<std::string, std::string> presetParams;
 };
@@ -0,0 +1,35 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "StageCache.h"
+
+using namespace std;
+
+StageCache::ByteCode StageCache::Share(const std::string& key, std::vector<uint8_t>&& byteCode)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    auto& entry = m_entries[key];
+    if(auto existing = entry.lock())
+    {
+        m_reused++;
+        return existing;
+    }
+
+    auto shared = make_shared<const vector<uint8_t>>(std::move(byteCode));
+    entry       = shared;
+
+    // forget buffers whose presets were removed
+    if(m_entries.size() >= m_sweepAt)
+    {
+        erase_if(m_entries, [](const auto& e) { return e.second.expired(); });
+        m_sweepAt = max<size_t>(64, m_entries.size() * 2);
+    }
+    return shared;
+}
@@ -0,0 +1,35 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+// bytecode of stages compiled during a session, shared by every imported pass with the
+// same stage source so repeated passes (stock.slang, chained blurs) and re-imports hold
+// one buffer; entries are only remembered while some ShaderDef still uses them
+class StageCache
+{
+public:
+    using ByteCode = std::shared_ptr<const std::vector<uint8_t>>;
+
+    // buffer already in use for key, or a new one taking byteCode
+    ByteCode Share(const std::string& key, std::vector<uint8_t>&& byteCode);
+
+    // number of times a live buffer was handed out instead of a new one
+    unsigned Reused() const
+    {
+        return m_reused;
+    }
+
+private:
+    std::mutex                                                                 m_mutex;
+    std::unordered_map<std::string, std::weak_ptr<const std::vector<uint8_t>>> m_entries;
+    size_t                                                                     m_sweepAt {64};
+    std::atomic<unsigned>                                                      m_reused {0};
+};
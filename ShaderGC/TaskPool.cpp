@@ -0,0 +1,70 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "TaskPool.h"
+
+#include <atomic>
+#include <thread>
+#include <exception>
+
+unsigned TaskPool::Threads(unsigned requested)
+{
+    if(requested > 0)
+        return requested;
+
+    auto hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? hardware : 1;
+}
+
+void TaskPool::Run(size_t count, unsigned threads, const std::function<void(size_t)>& task)
+{
+    threads = Threads(threads);
+    if(threads > count)
+        threads = (unsigned)count;
+
+    if(threads <= 1)
+    {
+        for(size_t i = 0; i < count; i++)
+            task(i);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(count);
+    std::atomic<size_t>             next {0};
+
+    auto worker = [&]() {
+        size_t i;
+        while((i = next.fetch_add(1)) < count)
+        {
+            try
+            {
+                task(i);
+            }
+            catch(...)
+            {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    // calling thread acts as one of the workers
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for(unsigned t = 1; t < threads; t++)
+        workers.emplace_back(worker);
+    worker();
+    for(auto& w : workers)
+        w.join();
+
+    for(const auto& e : errors)
+    {
+        if(e)
+            std::rethrow_exception(e);
+    }
+}
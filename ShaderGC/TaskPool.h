@@ -0,0 +1,21 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <functional>
+
+class TaskPool
+{
+public:
+    // number of workers to use when 0 (all cores) is requested
+    static unsigned Threads(unsigned requested);
+
+    // runs task(0..count-1) on up to 'threads' workers and waits for all to finish,
+    // first exception (in index order) is rethrown so failures are reported deterministically
+    static void Run(size_t count, unsigned threads, const std::function<void(size_t)>& task);
+};
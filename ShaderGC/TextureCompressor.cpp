@@ -0,0 +1,850 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "TextureCompressor.h"
+#include "TaskPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+// DXGI_FORMAT values, DDS files written here always carry the DX10 extension
+static const uint32_t sFormatBC1 = 71;
+static const uint32_t sFormatBC7 = 98;
+
+// interpolation weights of 4-bit BC7 indices
+static const int sWeights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+namespace
+{
+// zlib stream reader for PNG image data, decoding follows RFC 1951 directly (canonical Huffman
+// codes decoded a bit at a time), which is plenty for build time
+class Inflater
+{
+public:
+    Inflater(const uint8_t* data, size_t size) : m_data {data}, m_size {size} { }
+
+    void Inflate(vector<uint8_t>& out)
+    {
+        if(m_size < 2 || (m_data[0] & 0x0f) != 8 || ((m_data[0] << 8) | m_data[1]) % 31 != 0)
+            throw runtime_error("Not a zlib stream");
+        m_pos = 2;
+
+        int last;
+        do
+        {
+            last      = Bits(1);
+            auto type = Bits(2);
+            if(type == 0)
+                Stored(out);
+            else if(type == 1)
+                Fixed(out);
+            else if(type == 2)
+                Dynamic(out);
+            else
+                throw runtime_error("Invalid deflate block");
+        } while(!last);
+    }
+
+private:
+    struct Huffman
+    {
+        uint16_t count[16];
+        uint16_t symbol[288];
+    };
+
+    int Bits(int n)
+    {
+        while(m_bitCount < n)
+        {
+            if(m_pos >= m_size)
+                throw runtime_error("Truncated deflate stream");
+            m_bitBuffer |= (uint32_t)m_data[m_pos++] << m_bitCount;
+            m_bitCount += 8;
+        }
+        const int value = (int)(m_bitBuffer & ((1u << n) - 1));
+        m_bitBuffer >>= n;
+        m_bitCount -= n;
+        return value;
+    }
+
+    static void Build(Huffman& h, const uint8_t* lengths, int n)
+    {
+        uint16_t offsets[16];
+        memset(h.count, 0, sizeof(h.count));
+        for(int s = 0; s < n; s++)
+            h.count[lengths[s]]++;
+        h.count[0] = 0;
+
+        offsets[1] = 0;
+        for(int len = 1; len < 15; len++)
+            offsets[len + 1] = offsets[len] + h.count[len];
+        for(int s = 0; s < n; s++)
+        {
+            if(lengths[s])
+                h.symbol[offsets[lengths[s]]++] = (uint16_t)s;
+        }
+    }
+
+    int Decode(const Huffman& h)
+    {
+        int code = 0, first = 0, index = 0;
+        for(int len = 1; len < 16; len++)
+        {
+            code |= Bits(1);
+            const int count = h.count[len];
+            if(code - count < first)
+                return h.symbol[index + (code - first)];
+            index += count;
+            first += count;
+            first <<= 1;
+            code <<= 1;
+        }
+        throw runtime_error("Invalid Huffman code");
+    }
+
+    void Stored(vector<uint8_t>& out)
+    {
+        // the bit buffer never holds a whole byte, dropping it aligns to the next byte
+        m_bitBuffer = 0;
+        m_bitCount  = 0;
+        if(m_pos + 4 > m_size)
+            throw runtime_error("Truncated deflate stream");
+
+        const size_t len = m_data[m_pos] | (m_data[m_pos + 1] << 8);
+        if((len ^ 0xffff) != (size_t)(m_data[m_pos + 2] | (m_data[m_pos + 3] << 8)))
+            throw runtime_error("Invalid stored block");
+        m_pos += 4;
+        if(m_pos + len > m_size)
+            throw runtime_error("Truncated deflate stream");
+
+        out.insert(out.end(), m_data + m_pos, m_data + m_pos + len);
+        m_pos += len;
+    }
+
+    void Fixed(vector<uint8_t>& out)
+    {
+        uint8_t lengths[288 + 30];
+        int     s = 0;
+        for(; s < 144; s++)
+            lengths[s] = 8;
+        for(; s < 256; s++)
+            lengths[s] = 9;
+        for(; s < 280; s++)
+            lengths[s] = 7;
+        for(; s < 288 + 30; s++)
+            lengths[s] = s < 288 ? 8 : 5;
+
+        Huffman lengthCodes, distanceCodes;
+        Build(lengthCodes, lengths, 288);
+        Build(distanceCodes, lengths + 288, 30);
+        Codes(out, lengthCodes, distanceCodes);
+    }
+
+    void Dynamic(vector<uint8_t>& out)
+    {
+        static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+        const int lengthCount   = Bits(5) + 257;
+        const int distanceCount = Bits(5) + 1;
+        const int codeCount     = Bits(4) + 4;
+        if(lengthCount > 286 || distanceCount > 30)
+            throw runtime_error("Invalid dynamic block");
+
+        uint8_t lengths[286 + 30] = {};
+        for(int i = 0; i < codeCount; i++)
+            lengths[order[i]] = (uint8_t)Bits(3);
+
+        Huffman codeLengths;
+        Build(codeLengths, lengths, 19);
+
+        memset(lengths, 0, sizeof(lengths));
+        for(int i = 0; i < lengthCount + distanceCount;)
+        {
+            const int symbol = Decode(codeLengths);
+            if(symbol < 16)
+            {
+                lengths[i++] = (uint8_t)symbol;
+                continue;
+            }
+
+            uint8_t value = 0;
+            int     repeat;
+            if(symbol == 16)
+            {
+                if(i == 0)
+                    throw runtime_error("Invalid dynamic block");
+                value  = lengths[i - 1];
+                repeat = 3 + Bits(2);
+            }
+            else if(symbol == 17)
+                repeat = 3 + Bits(3);
+            else
+                repeat = 11 + Bits(7);
+
+            if(i + repeat > lengthCount + distanceCount)
+                throw runtime_error("Invalid dynamic block");
+            while(repeat--)
+                lengths[i++] = value;
+        }
+
+        Huffman lengthCodes, distanceCodes;
+        Build(lengthCodes, lengths, lengthCount);
+        Build(distanceCodes, lengths + lengthCount, distanceCount);
+        Codes(out, lengthCodes, distanceCodes);
+    }
+
+    void Codes(vector<uint8_t>& out, const Huffman& lengthCodes, const Huffman& distanceCodes)
+    {
+        static const uint16_t lengthBase[29]    = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+        static const uint8_t  lengthExtra[29]   = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+        static const uint16_t distanceBase[30]  = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+        static const uint8_t  distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+        for(;;)
+        {
+            int symbol = Decode(lengthCodes);
+            if(symbol < 256)
+            {
+                out.push_back((uint8_t)symbol);
+                continue;
+            }
+            if(symbol == 256)
+                return;
+
+            symbol -= 257;
+            if(symbol >= 29)
+                throw runtime_error("Invalid length code");
+            const size_t length = lengthBase[symbol] + Bits(lengthExtra[symbol]);
+
+            symbol = Decode(distanceCodes);
+            if(symbol >= 30)
+                throw runtime_error("Invalid distance code");
+            const size_t distance = distanceBase[symbol] + Bits(distanceExtra[symbol]);
+            if(distance > out.size())
+                throw runtime_error("Invalid distance");
+
+            // copies may overlap their own output
+            const size_t from = out.size() - distance;
+            for(size_t i = 0; i < length; i++)
+                out.push_back(out[from + i]);
+        }
+    }
+
+    const uint8_t* m_data;
+    size_t         m_size;
+    size_t         m_pos {0};
+    uint32_t       m_bitBuffer {0};
+    int            m_bitCount {0};
+};
+
+uint32_t BigEndian(const uint8_t* p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+void Unfilter(vector<uint8_t>& data, size_t rows, size_t rowBytes, size_t pixelBytes)
+{
+    const vector<uint8_t> zero(rowBytes, 0);
+    for(size_t y = 0; y < rows; y++)
+    {
+        const uint8_t  filter = data[y * (rowBytes + 1)];
+        uint8_t*       row    = &data[y * (rowBytes + 1) + 1];
+        const uint8_t* prior  = y ? &data[(y - 1) * (rowBytes + 1) + 1] : zero.data();
+        for(size_t x = 0; x < rowBytes; x++)
+        {
+            const int a = x >= pixelBytes ? row[x - pixelBytes] : 0;
+            const int b = prior[x];
+            const int c = x >= pixelBytes ? prior[x - pixelBytes] : 0;
+            switch(filter)
+            {
+            case 0:
+                break;
+            case 1:
+                row[x] = (uint8_t)(row[x] + a);
+                break;
+            case 2:
+                row[x] = (uint8_t)(row[x] + b);
+                break;
+            case 3:
+                row[x] = (uint8_t)(row[x] + ((a + b) >> 1));
+                break;
+            case 4: {
+                const int p  = a + b - c;
+                const int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+                row[x]       = (uint8_t)(row[x] + (pa <= pb && pa <= pc ? a : (pb <= pc ? b : c)));
+                break;
+            }
+            default:
+                throw runtime_error("Invalid PNG filter");
+            }
+        }
+    }
+}
+
+// writes up to 128 bits of a BC7 block least significant bit first
+class BlockWriter
+{
+public:
+    BlockWriter(uint8_t* out) : m_out {out}
+    {
+        memset(m_out, 0, 16);
+    }
+
+    void Write(uint32_t value, int bits)
+    {
+        for(int i = 0; i < bits; i++, m_bit++)
+        {
+            if(value & (1u << i))
+                m_out[m_bit >> 3] |= (uint8_t)(1u << (m_bit & 7));
+        }
+    }
+
+private:
+    uint8_t* m_out;
+    int      m_bit {0};
+};
+
+// line through the block's pixels: mean and principal axis from a few power iterations
+template<int N> void PrincipalAxis(const uint8_t* block, float* mean, float* axis)
+{
+    float cov[N][N] = {};
+    for(int c = 0; c < N; c++)
+    {
+        mean[c] = 0;
+        for(int i = 0; i < 16; i++)
+            mean[c] += block[i * 4 + c];
+        mean[c] /= 16.0f;
+    }
+    for(int i = 0; i < 16; i++)
+    {
+        for(int r = 0; r < N; r++)
+        {
+            for(int c = 0; c < N; c++)
+                cov[r][c] += (block[i * 4 + r] - mean[r]) * (block[i * 4 + c] - mean[c]);
+        }
+    }
+
+    for(int c = 0; c < N; c++)
+        axis[c] = 1.0f;
+    for(int iteration = 0; iteration < 8; iteration++)
+    {
+        float next[N] = {};
+        float length  = 0;
+        for(int r = 0; r < N; r++)
+        {
+            for(int c = 0; c < N; c++)
+                next[r] += cov[r][c] * axis[c];
+            length = max(length, fabsf(next[r]));
+        }
+        if(length < 1e-6f)
+        {
+            // flat block, any axis will do
+            for(int c = 0; c < N; c++)
+                axis[c] = 0;
+            return;
+        }
+        for(int c = 0; c < N; c++)
+            axis[c] = next[c] / length;
+    }
+}
+
+template<int N> void Endpoints(const uint8_t* block, float* e0, float* e1)
+{
+    float mean[N], axis[N];
+    PrincipalAxis<N>(block, mean, axis);
+
+    float length = 0;
+    for(int c = 0; c < N; c++)
+        length += axis[c] * axis[c];
+
+    float low = 0, high = 0;
+    if(length > 0)
+    {
+        low  = 1e9f;
+        high = -1e9f;
+        for(int i = 0; i < 16; i++)
+        {
+            float t = 0;
+            for(int c = 0; c < N; c++)
+                t += (block[i * 4 + c] - mean[c]) * axis[c];
+            low  = min(low, t / length);
+            high = max(high, t / length);
+        }
+    }
+    for(int c = 0; c < N; c++)
+    {
+        e0[c] = clamp(mean[c] + axis[c] * low, 0.0f, 255.0f);
+        e1[c] = clamp(mean[c] + axis[c] * high, 0.0f, 255.0f);
+    }
+}
+
+int ColorDistance(const uint8_t* a, const int* b, int channels)
+{
+    int distance = 0;
+    for(int c = 0; c < channels; c++)
+        distance += (a[c] - b[c]) * (a[c] - b[c]);
+    return distance;
+}
+
+// mode 6 candidate: 7-bit endpoints with a p-bit each, palette and best index per pixel
+struct Mode6
+{
+    int      q[2][4];
+    int      p[2];
+    uint8_t  indices[16];
+    uint32_t error;
+};
+
+void EvaluateMode6(const uint8_t* block, const float* e0, const float* e1, int p0, int p1, Mode6& m)
+{
+    const float* e[2] = {e0, e1};
+    m.p[0]            = p0;
+    m.p[1]            = p1;
+
+    int endpoint[2][4];
+    for(int i = 0; i < 2; i++)
+    {
+        for(int c = 0; c < 4; c++)
+        {
+            m.q[i][c]      = clamp((int)lroundf((e[i][c] - m.p[i]) / 2.0f), 0, 127);
+            endpoint[i][c] = (m.q[i][c] << 1) | m.p[i];
+        }
+    }
+
+    int palette[16][4];
+    for(int w = 0; w < 16; w++)
+    {
+        for(int c = 0; c < 4; c++)
+            palette[w][c] = ((64 - sWeights4[w]) * endpoint[0][c] + sWeights4[w] * endpoint[1][c] + 32) >> 6;
+    }
+
+    m.error = 0;
+    for(int i = 0; i < 16; i++)
+    {
+        int best = 0, bestDistance = INT32_MAX;
+        for(int w = 0; w < 16; w++)
+        {
+            const int distance = ColorDistance(block + i * 4, palette[w], 4);
+            if(distance < bestDistance)
+            {
+                best         = w;
+                bestDistance = distance;
+            }
+        }
+        m.indices[i] = (uint8_t)best;
+        m.error += bestDistance;
+    }
+}
+
+// least squares endpoints for the indices of a candidate
+void RefitMode6(const uint8_t* block, const Mode6& m, float* e0, float* e1)
+{
+    float aa = 0, ab = 0, bb = 0, ax[4] = {}, bx[4] = {};
+    for(int i = 0; i < 16; i++)
+    {
+        const float b = sWeights4[m.indices[i]] / 64.0f;
+        const float a = 1.0f - b;
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for(int c = 0; c < 4; c++)
+        {
+            ax[c] += a * block[i * 4 + c];
+            bx[c] += b * block[i * 4 + c];
+        }
+    }
+
+    const float determinant = aa * bb - ab * ab;
+    if(fabsf(determinant) < 1e-6f)
+        return;
+    for(int c = 0; c < 4; c++)
+    {
+        e0[c] = clamp((ax[c] * bb - bx[c] * ab) / determinant, 0.0f, 255.0f);
+        e1[c] = clamp((bx[c] * aa - ax[c] * ab) / determinant, 0.0f, 255.0f);
+    }
+}
+
+void BestMode6(const uint8_t* block, const float* e0, const float* e1, Mode6& best)
+{
+    for(int p = 0; p < 4; p++)
+    {
+        Mode6 m;
+        EvaluateMode6(block, e0, e1, p & 1, p >> 1, m);
+        if(m.error < best.error)
+            best = m;
+    }
+}
+
+uint16_t Pack565(const float* color)
+{
+    const int r = clamp((int)lroundf(color[0] * 31.0f / 255.0f), 0, 31);
+    const int g = clamp((int)lroundf(color[1] * 63.0f / 255.0f), 0, 63);
+    const int b = clamp((int)lroundf(color[2] * 31.0f / 255.0f), 0, 31);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+void Unpack565(uint16_t packed, int* color)
+{
+    const int r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+    color[0]    = (r << 3) | (r >> 2);
+    color[1]    = (g << 2) | (g >> 4);
+    color[2]    = (b << 3) | (b >> 2);
+}
+
+// next mip level, box filtered with the last row/column repeated for odd sizes
+TextureCompressor::Image Downsample(const TextureCompressor::Image& source)
+{
+    TextureCompressor::Image image;
+    image.width  = max(1u, source.width / 2);
+    image.height = max(1u, source.height / 2);
+    image.rgba.resize((size_t)image.width * image.height * 4);
+    for(uint32_t y = 0; y < image.height; y++)
+    {
+        const uint32_t y0 = min(y * 2, source.height - 1), y1 = min(y * 2 + 1, source.height - 1);
+        for(uint32_t x = 0; x < image.width; x++)
+        {
+            const uint32_t x0 = min(x * 2, source.width - 1), x1 = min(x * 2 + 1, source.width - 1);
+            for(int c = 0; c < 4; c++)
+            {
+                const int sum = source.rgba[((size_t)y0 * source.width + x0) * 4 + c] + source.rgba[((size_t)y0 * source.width + x1) * 4 + c] +
+                                source.rgba[((size_t)y1 * source.width + x0) * 4 + c] + source.rgba[((size_t)y1 * source.width + x1) * 4 + c];
+                image.rgba[((size_t)y * image.width + x) * 4 + c] = (uint8_t)((sum + 2) / 4);
+            }
+        }
+    }
+    return image;
+}
+
+// rows of blocks are encoded on up to 'threads' workers
+void AppendBlocks(const TextureCompressor::Image& image, bool bc7, unsigned threads, vector<uint8_t>& out)
+{
+    const uint32_t blocksWide = (image.width + 3) / 4;
+    const uint32_t blocksHigh = (image.height + 3) / 4;
+    const size_t   blockSize  = bc7 ? 16 : 8;
+    const size_t   start      = out.size();
+    out.resize(start + (size_t)blocksWide * blocksHigh * blockSize);
+
+    TaskPool::Run(blocksHigh, threads, [&](size_t by) {
+        uint8_t block[64];
+        size_t  position = start + by * blocksWide * blockSize;
+        for(uint32_t bx = 0; bx < blocksWide; bx++)
+        {
+            // mips smaller than a block repeat their edge pixels
+            for(uint32_t i = 0; i < 16; i++)
+            {
+                const uint32_t x = min(bx * 4 + i % 4, image.width - 1);
+                const uint32_t y = min((uint32_t)by * 4 + i / 4, image.height - 1);
+                memcpy(block + i * 4, &image.rgba[((size_t)y * image.width + x) * 4], 4);
+            }
+            if(bc7)
+                TextureCompressor::EncodeBC7(block, &out[position]);
+            else
+                TextureCompressor::EncodeBC1(block, &out[position]);
+            position += blockSize;
+        }
+    });
+}
+
+void AppendUInt32(vector<uint8_t>& out, uint32_t value)
+{
+    for(int i = 0; i < 4; i++)
+        out.push_back((uint8_t)(value >> (i * 8)));
+}
+} // namespace
+
+bool TextureCompressor::DecodePNG(const std::vector<uint8_t>& png, Image& image)
+{
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    if(png.size() < 8 || memcmp(png.data(), signature, 8) != 0)
+        return false;
+
+    try
+    {
+        uint32_t        width = 0, height = 0;
+        int             depth = 0, colorType = -1;
+        vector<uint8_t> compressed, palette, transparency;
+        for(size_t pos = 8; pos + 12 <= png.size();)
+        {
+            const uint32_t length = BigEndian(&png[pos]);
+            if(length > png.size() - pos - 12)
+                return false;
+
+            const auto     type = string((const char*)&png[pos + 4], 4);
+            const uint8_t* data = &png[pos + 8];
+            if(type == "IHDR" && length >= 13)
+            {
+                width     = BigEndian(data);
+                height    = BigEndian(data + 4);
+                depth     = data[8];
+                colorType = data[9];
+                // compression and filter methods have a single defined value, interlacing isn't supported
+                if(data[10] != 0 || data[11] != 0 || data[12] != 0)
+                    return false;
+            }
+            else if(type == "PLTE")
+                palette.assign(data, data + length);
+            else if(type == "tRNS")
+                transparency.assign(data, data + length);
+            else if(type == "IDAT")
+                compressed.insert(compressed.end(), data, data + length);
+            else if(type == "IEND")
+                break;
+            pos += 12 + length;
+        }
+
+        int channels;
+        switch(colorType)
+        {
+        case 0:
+            channels = 1;
+            break;
+        case 2:
+            channels = 3;
+            break;
+        case 3:
+            channels = 1;
+            break;
+        case 4:
+            channels = 2;
+            break;
+        case 6:
+            channels = 4;
+            break;
+        default:
+            return false;
+        }
+        const bool validDepth = depth == 8 || (depth == 16 && colorType != 3) || ((depth == 1 || depth == 2 || depth == 4) && (colorType == 0 || colorType == 3));
+        if(!validDepth || width == 0 || height == 0 || width > 16384 || height > 16384 || (colorType == 3 && palette.size() < 3))
+            return false;
+
+        const size_t    pixelBits  = (size_t)channels * depth;
+        const size_t    rowBytes   = (width * pixelBits + 7) / 8;
+        const size_t    pixelBytes = max<size_t>(1, pixelBits / 8);
+        vector<uint8_t> raw;
+        raw.reserve(height * (rowBytes + 1));
+        Inflater(compressed.data(), compressed.size()).Inflate(raw);
+        if(raw.size() < height * (rowBytes + 1))
+            return false;
+        Unfilter(raw, height, rowBytes, pixelBytes);
+
+        // samples at full depth (for tRNS keys) and scaled to 8 bits
+        const int  maxSample = (1 << depth) - 1;
+        const auto sample    = [&](const uint8_t* row, uint32_t x, int c) {
+            if(depth == 16)
+                return (row[(x * channels + c) * 2] << 8) | row[(x * channels + c) * 2 + 1];
+            if(depth == 8)
+                return (int)row[x * channels + c];
+            const size_t bit = (size_t)x * depth;
+            return (row[bit / 8] >> (8 - depth - bit % 8)) & maxSample;
+        };
+        const auto scale = [&](int value) { return (uint8_t)(depth == 16 ? value >> 8 : value * 255 / maxSample); };
+        const auto key   = [&](int i) { return (int)((transparency[i * 2] << 8) | transparency[i * 2 + 1]); };
+
+        image.width  = width;
+        image.height = height;
+        image.rgba.resize((size_t)width * height * 4);
+        for(uint32_t y = 0; y < height; y++)
+        {
+            const uint8_t* row = &raw[y * (rowBytes + 1) + 1];
+            uint8_t*       out = &image.rgba[(size_t)y * width * 4];
+            for(uint32_t x = 0; x < width; x++, out += 4)
+            {
+                switch(colorType)
+                {
+                case 0: {
+                    const int gray = sample(row, x, 0);
+                    out[0] = out[1] = out[2] = scale(gray);
+                    out[3]                   = transparency.size() >= 2 && gray == key(0) ? 0 : 255;
+                    break;
+                }
+                case 2: {
+                    const int r = sample(row, x, 0), g = sample(row, x, 1), b = sample(row, x, 2);
+                    out[0]      = scale(r);
+                    out[1]      = scale(g);
+                    out[2]      = scale(b);
+                    out[3]      = transparency.size() >= 6 && r == key(0) && g == key(1) && b == key(2) ? 0 : 255;
+                    break;
+                }
+                case 3: {
+                    const size_t index = (size_t)sample(row, x, 0);
+                    if(index * 3 + 2 >= palette.size())
+                        return false;
+                    out[0] = palette[index * 3];
+                    out[1] = palette[index * 3 + 1];
+                    out[2] = palette[index * 3 + 2];
+                    out[3] = index < transparency.size() ? transparency[index] : 255;
+                    break;
+                }
+                case 4:
+                    out[0] = out[1] = out[2] = scale(sample(row, x, 0));
+                    out[3]                   = scale(sample(row, x, 1));
+                    break;
+                case 6:
+                    for(int c = 0; c < 4; c++)
+                        out[c] = scale(sample(row, x, c));
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+    catch(std::exception&)
+    {
+        return false;
+    }
+}
+
+void TextureCompressor::EncodeBC1(const uint8_t* block, uint8_t* out)
+{
+    float e0[3], e1[3];
+    Endpoints<3>(block, e0, e1);
+
+    // four-color mode needs the first endpoint to be the larger one
+    uint16_t c0 = Pack565(e1), c1 = Pack565(e0);
+    if(c0 < c1)
+        swap(c0, c1);
+
+    int palette[4][3];
+    Unpack565(c0, palette[0]);
+    Unpack565(c1, palette[1]);
+    for(int c = 0; c < 3; c++)
+    {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    uint32_t indices = 0;
+    if(c0 != c1)
+    {
+        for(int i = 0; i < 16; i++)
+        {
+            int best = 0, bestDistance = INT32_MAX;
+            for(int p = 0; p < 4; p++)
+            {
+                const int distance = ColorDistance(block + i * 4, palette[p], 3);
+                if(distance < bestDistance)
+                {
+                    best         = p;
+                    bestDistance = distance;
+                }
+            }
+            indices |= (uint32_t)best << (i * 2);
+        }
+    }
+
+    out[0] = (uint8_t)c0;
+    out[1] = (uint8_t)(c0 >> 8);
+    out[2] = (uint8_t)c1;
+    out[3] = (uint8_t)(c1 >> 8);
+    for(int i = 0; i < 4; i++)
+        out[4 + i] = (uint8_t)(indices >> (i * 8));
+}
+
+void TextureCompressor::EncodeBC7(const uint8_t* block, uint8_t* out)
+{
+    // mode 6 only: one subset with RGBA endpoints and 4-bit indices, which suits smooth
+    // photographic bezels and backgrounds
+    float e0[4], e1[4];
+    Endpoints<4>(block, e0, e1);
+
+    Mode6 best;
+    best.error = UINT32_MAX;
+    BestMode6(block, e0, e1, best);
+    if(best.error)
+    {
+        RefitMode6(block, best, e0, e1);
+        BestMode6(block, e0, e1, best);
+    }
+
+    // the first index is stored without its top bit, so it has to be below 8
+    if(best.indices[0] >= 8)
+    {
+        for(int c = 0; c < 4; c++)
+            swap(best.q[0][c], best.q[1][c]);
+        swap(best.p[0], best.p[1]);
+        for(auto& index : best.indices)
+            index = (uint8_t)(15 - index);
+    }
+
+    BlockWriter writer(out);
+    writer.Write(1 << 6, 7);
+    for(int c = 0; c < 4; c++)
+    {
+        writer.Write(best.q[0][c], 7);
+        writer.Write(best.q[1][c], 7);
+    }
+    writer.Write(best.p[0], 1);
+    writer.Write(best.p[1], 1);
+    writer.Write(best.indices[0], 3);
+    for(int i = 1; i < 16; i++)
+        writer.Write(best.indices[i], 4);
+}
+
+bool TextureCompressor::Compress(const std::filesystem::path& input, std::vector<uint8_t>& dds, std::ostream& log, unsigned threads)
+{
+    auto name = input.filename().string();
+    transform(name.begin(), name.end(), name.begin(), [](char c) { return (char)tolower(c); });
+    if(!name.ends_with(".png") || name.find("lut") != string::npos)
+        return false;
+
+    ifstream              infile(input, ios::binary);
+    const vector<uint8_t> png((istreambuf_iterator<char>(infile)), istreambuf_iterator<char>());
+    Image                 image;
+    if(!DecodePNG(png, image) || image.width < MinSize || image.height < MinSize || image.width % 4 || image.height % 4)
+        return false;
+
+    bool opaque = true;
+    for(size_t i = 3; i < image.rgba.size() && opaque; i += 4)
+        opaque = image.rgba[i] == 255;
+
+    uint32_t mipLevels = 1;
+    while((max(image.width, image.height) >> mipLevels) > 0)
+        mipLevels++;
+
+    // DDS header with DX10 extension, see DDS_HEADER and DDS_HEADER_DXT10
+    const uint32_t format = opaque ? sFormatBC1 : sFormatBC7;
+    dds.clear();
+    dds.insert(dds.end(), {'D', 'D', 'S', ' '});
+    AppendUInt32(dds, 124);
+    AppendUInt32(dds, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x80000); // caps, height, width, pixel format, mip count, linear size
+    AppendUInt32(dds, image.height);
+    AppendUInt32(dds, image.width);
+    AppendUInt32(dds, (image.width / 4) * (image.height / 4) * (opaque ? 8 : 16));
+    AppendUInt32(dds, 0);
+    AppendUInt32(dds, mipLevels);
+    for(int i = 0; i < 11; i++)
+        AppendUInt32(dds, 0);
+    AppendUInt32(dds, 32);
+    AppendUInt32(dds, 0x4); // fourCC
+    dds.insert(dds.end(), {'D', 'X', '1', '0'});
+    for(int i = 0; i < 5; i++)
+        AppendUInt32(dds, 0);
+    AppendUInt32(dds, 0x1000 | 0x400000 | 0x8); // texture, mipmap, complex
+    for(int i = 0; i < 4; i++)
+        AppendUInt32(dds, 0);
+    AppendUInt32(dds, format);
+    AppendUInt32(dds, 3); // 2D
+    AppendUInt32(dds, 0);
+    AppendUInt32(dds, 1);
+    AppendUInt32(dds, 0);
+
+    for(uint32_t level = 0; level < mipLevels; level++)
+    {
+        AppendBlocks(image, !opaque, threads, dds);
+        if(level + 1 < mipLevels)
+            image = Downsample(image);
+    }
+
+    log << "Compressed " << input.string() << " to " << (opaque ? "BC1" : "BC7") << ", " << mipLevels << " mips, " << png.size() << " -> " << dds.size() << " bytes" << endl;
+    return true;
+}
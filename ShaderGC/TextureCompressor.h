@@ -0,0 +1,35 @@
+/*
+ShaderGC: slangp shader compiler for ShaderGlass
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+// build-time block compression of large static textures (bezels, backgrounds) for ShaderGen -compress;
+// PNG is decoded in-tree so this runs anywhere ShaderGen does, then re-encoded as BC1 (opaque) or BC7
+// (with alpha) with a full mip chain and wrapped in DDS, which ShaderGlass uploads without decoding
+class TextureCompressor
+{
+public:
+    struct Image
+    {
+        uint32_t             width {0};
+        uint32_t             height {0};
+        std::vector<uint8_t> rgba;
+    };
+
+    // false for anything but a valid non-interlaced PNG
+    static bool DecodePNG(const std::vector<uint8_t>& png, Image& image);
+
+    // false when the texture should stay as it is: not a PNG, a LUT, too small to gain anything or
+    // not a multiple of the 4x4 block size; blocks are encoded on up to 'threads' workers, 0 for all cores
+    static bool Compress(const std::filesystem::path& input, std::vector<uint8_t>& dds, std::ostream& log, unsigned threads = 1);
+
+    // 4x4 RGBA block in, 8 (BC1) or 16 (BC7 mode 6) bytes out
+    static void EncodeBC1(const uint8_t* block, uint8_t* out);
+    static void EncodeBC7(const uint8_t* block, uint8_t* out);
+
+    static const uint32_t MinSize = 256; // smaller textures are masks, noise or LUTs
+};
@@ -7,20 +7,33 @@ GNU General Public License v3.0
 
 #pragma once
 
+#include "PresetParamList.h"
+
 class TextureDef
 {
 public:
-    TextureDef() : Data {}, DataLength {}, PresetParams {}, Dynamic {false} { }
+    TextureDef() : Data {}, DataLength {}, Dynamic {false}, PresetParams {} { }
+
+    TextureDef(const TextureDef&)            = default;
+    TextureDef(TextureDef&&)                 = default;
+    TextureDef& operator=(const TextureDef&) = default;
+    TextureDef& operator=(TextureDef&&)      = default;
 
-    std::string                        Name;
-    const uint8_t*                     Data;
-    int                                DataLength;
-    bool                               Dynamic;
-    std::map<std::string, std::string> PresetParams;
+    std::string     Name;
+    const uint8_t*  Data;
+    int             DataLength;
+    bool            Dynamic;
+    PresetParamList PresetParams;
 
     TextureDef& Param(const char* presetKey, const char* presetValue)
     {
-        PresetParams.insert(std::make_pair(std::string(presetKey), std::string(presetValue)));
+        PresetParams.Add(presetKey, presetValue);
+        return *this;
+    }
+
+    TextureDef& Param(std::span<const PresetParamInfo> presetParams)
+    {
+        PresetParams.Set(presetParams);
         return *this;
     }
 
@@ -7,6 +7,14 @@
 #include <filesystem>
 #include <map>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <unordered_set>
+#include <unordered_map>
 #include <iostream>
+#include <memory>
+
+#ifndef _WIN32
+#include <strings.h>
+#define _stricmp strcasecmp
+#endif
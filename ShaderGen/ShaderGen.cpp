@@ -12,6 +12,10 @@ GNU General Public License v3.0
 #include "SPIRV.h"
 #include "HLSL.h"
 #include "ShaderCache.h"
+#include "DiskCache.h"
+#include "ShaderPack.h"
+#include "TaskPool.h"
+#include "TextureCompressor.h"
 
 filesystem::path startupPath;
 filesystem::path templatePath;
@@ -20,8 +24,39 @@ filesystem::path tempPath;
 filesystem::path reportPath;
 filesystem::path listPath;
 vector<string>   shaderList;
+bool             shaderListDirty = false;
+SourceCache      sourceCache;
 
-std::string exec(const char* cmd, ofstream& log)
+// key of everything each output was generated from, by path relative to output directory
+filesystem::path    manifestPath;
+map<string, string> manifest;
+
+// templates are parsed once and shared by batch workers
+map<string, unique_ptr<Template>> templates;
+mutex                             templatesMutex;
+
+// entries of the binary pack (-pack), kept from the previous build and written at the end
+filesystem::path             packPath;
+map<string, vector<uint8_t>> packEntries;
+mutex                        packMutex;
+bool                         packDirty = false;
+
+// inputs queued by processFile when building on several threads
+vector<filesystem::path> batchFiles;
+
+// headers shared by ShaderDefs and TextureDefs with the same content, by id with sizes of
+// those generated in this run for the report
+struct SharedOutputs
+{
+    map<string, size_t> sizes;
+    size_t              generated = 0;
+    size_t              saved     = 0;
+};
+SharedOutputs sharedByteCode;
+SharedOutputs sharedTextures;
+mutex         sharedMutex;
+
+std::string exec(const char* cmd, ostream& log)
 {
     std::array<char, 128> buffer;
     std::string           result;
@@ -55,7 +90,7 @@ void saveSource(const filesystem::path& fileName, const string& source)
     outfile.close();
 }
 
-filesystem::path glsl(const filesystem::path& shaderPath, const string& stage, const string& source, ofstream& log, bool& warn)
+filesystem::path glsl(const filesystem::path& shaderPath, const string& stage, const string& source, ostream& log, bool& warn)
 {
     filesystem::path input = tempPath / shaderPath;
     input.replace_extension("." + stage + ".glsl");
@@ -91,78 +126,154 @@ filesystem::path glsl(const filesystem::path& shaderPath, const string& stage, c
     return output;
 }
 
-pair<string, string> spirv(const filesystem::path& input, const std::string& stage, ofstream& log, bool& warn)
+vector<uint32_t> loadSpirv(const filesystem::path& input)
+{
+    ifstream inf(input, ios::binary | ios::ate);
+    auto     size = inf.tellg();
+    inf.seekg(0, ios::beg);
+    vector<uint32_t> buffer;
+    buffer.resize(size / sizeof(uint32_t));
+    inf.read((char*)buffer.data(), size);
+    inf.close();
+    return buffer;
+}
+
+pair<string, SourceShaderReflection> spirv(const filesystem::path& input, const std::string& stage, ostream& log, bool& warn)
 {
     if(_tools)
     {
         stringstream cmd1, cmd2;
         cmd1 << "\"" << toolsPath.string() << _spirvExe << "\" "
              << " --hlsl --shader-model 50 " << input.string() << "";
-        const auto& code = exec(cmd1.str().c_str(), log);
-        std::string metadata;
+        const auto&            code = exec(cmd1.str().c_str(), log);
+        SourceShaderReflection metadata;
         if(stage == "frag")
         {
             cmd2 << "\"" << toolsPath.string() << _spirvExe << "\" " << input.string() << " --reflect";
-            metadata = exec(cmd2.str().c_str(), log);
+            const auto& json = exec(cmd2.str().c_str(), log);
+
+            filesystem::path metaOutput(input);
+            metaOutput.replace_extension(".meta");
+            saveSource(metaOutput, json);
+
+            metadata      = ShaderGC::ParseReflection(json);
+            metadata.cost = ShaderCost::Analyze(loadSpirv(input));
         }
         return make_pair(code, metadata);
     }
     else
     {
-        ifstream inf(input, ios::binary | ios::ate);
-        auto     size = inf.tellg();
-        inf.seekg(0, ios::beg);
-        vector<uint32_t> buffer;
-        buffer.resize(size / sizeof(uint32_t));
-        inf.read((char*)buffer.data(), size);
-        inf.close();
-        return SPIRV::GenerateHLSL(buffer, stage == "frag", log, warn);
+        return SPIRV::GenerateHLSL(loadSpirv(input), stage == "frag", log, warn);
     }
 }
 
-static string byteArrayToString(uint8_t* data, size_t size)
+// formats numbers into a buffer written out in large chunks, much cheaper than
+// going through ostream formatting for every byte of a payload
+class ChunkWriter
+{
+public:
+    ChunkWriter(ostream& out) : m_out {out}
+    {
+        m_buffer.reserve(sChunkSize + 64);
+    }
+
+    ~ChunkWriter()
+    {
+        Flush();
+    }
+
+    void Put(char c)
+    {
+        m_buffer.push_back(c);
+    }
+
+    void Put(const char* text)
+    {
+        m_buffer.insert(m_buffer.end(), text, text + strlen(text));
+    }
+
+    void Number(uint32_t value, int base = 10)
+    {
+        char text[16];
+        auto result = to_chars(text, text + sizeof(text), value, base);
+        m_buffer.insert(m_buffer.end(), text, result.ptr);
+        if(m_buffer.size() >= sChunkSize)
+            Flush();
+    }
+
+    void Flush()
+    {
+        m_out.write(m_buffer.data(), m_buffer.size());
+        m_buffer.clear();
+    }
+
+private:
+    static const size_t sChunkSize = 1 << 16;
+
+    ostream&     m_out;
+    vector<char> m_buffer;
+};
+
+static void writeByteArray(ostream& out, const uint8_t* data, size_t size)
 {
-    ostringstream sbuf;
-    sbuf << "{" << endl;
-    int nl = 0;
-    for(int i = 0; i < size; i++)
+    ChunkWriter writer(out);
+    writer.Put("{\n");
+    for(size_t i = 0; i < size; i++)
     {
-        const auto b = data[i];
-        sbuf << (int)b;
-        if(nl < size - 1)
+        writer.Number(data[i]);
+        if(i < size - 1)
         {
-            sbuf << ",";
-            if(++nl % 6 == 0)
-                sbuf << endl;
+            writer.Put(',');
+            if((i + 1) % 6 == 0)
+                writer.Put('\n');
         }
     }
-    sbuf << endl << "};" << endl;
-
-    return sbuf.str();
+    writer.Put("\n};\n");
 }
 
-static string intArrayToString(uint32_t* data, size_t size)
+static void writeIntArray(ostream& out, const uint32_t* data, size_t size)
 {
-    ostringstream sbuf;
-    sbuf << "{" << std::hex << endl;
-    int nl = 0;
-    for(int i = 0; i < size; i++)
+    ChunkWriter writer(out);
+    writer.Put("{\n");
+    for(size_t i = 0; i < size; i++)
     {
-        const auto b = data[i];
-        sbuf << "0x" << b;
-        if(nl < size - 1)
+        writer.Put("0x");
+        writer.Number(data[i], 16);
+        if(i < size - 1)
         {
-            sbuf << ",";
-            if(++nl % 6 == 0)
-                sbuf << endl;
+            writer.Put(',');
+            if((i + 1) % 6 == 0)
+                writer.Put('\n');
         }
     }
-    sbuf << endl << "};" << endl;
+    writer.Put("\n};\n");
+}
 
-    return sbuf.str();
+// contents of a binary file, 40 values per line
+static void writeFileArray(ostream& out, const filesystem::path& input)
+{
+    ifstream     infile(input, fstream::binary);
+    vector<char> chunk(1 << 16);
+    ChunkWriter  writer(out);
+    size_t       counter = 0;
+
+    writer.Put('{');
+    while(infile.read(chunk.data(), chunk.size()) || infile.gcount())
+    {
+        const auto read = (size_t)infile.gcount();
+        for(size_t i = 0; i < read; i++)
+        {
+            if(counter)
+                writer.Put(',');
+            writer.Number((unsigned char)chunk[i]);
+            if(++counter % 40 == 0)
+                writer.Put('\n');
+        }
+    }
+    writer.Put("};");
 }
 
-pair<string, string> fxc(const filesystem::path& shaderPath, const string& profile, const string& source, ofstream& log, bool& warn)
+pair<vector<uint8_t>, vector<uint32_t>> fxc(const filesystem::path& shaderPath, const string& profile, const string& source, ostream& log, bool& warn)
 {
     filesystem::path input = tempPath / shaderPath;
     input.replace_extension("." + profile + ".hlsl");
@@ -192,10 +303,10 @@ pair<string, string> fxc(const filesystem::path& shaderPath, const string& profi
         if(result.find("warn") != string::npos)
             warn = true;
 
-        fstream      infile(output.string());
-        stringstream outs;
-        string       line;
-        bool         active = false;
+        fstream         infile(output.string());
+        vector<uint8_t> bin;
+        string          line;
+        bool            active = false;
         while(getline(infile, line))
         {
             if(line.starts_with("const BYTE g_main[] ="))
@@ -205,29 +316,32 @@ pair<string, string> fxc(const filesystem::path& shaderPath, const string& profi
             else if(active)
             {
                 if(line.starts_with("};"))
-                {
-                    outs << "};" << endl;
                     break;
+
+                // decimal bytes separated by commas and spaces
+                stringstream values(line);
+                string       value;
+                while(getline(values, value, ','))
+                {
+                    value.erase(remove_if(value.begin(), value.end(), [](char c) { return !isdigit((unsigned char)c); }), value.end());
+                    if(value.size())
+                        bin.push_back((uint8_t)stoi(value));
                 }
-                outs << line << endl;
             }
         }
 
-        return make_pair(outs.str(), "{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};");
+        return make_pair(bin, vector<uint32_t>(32, 0));
     }
     else
     {
-        auto bin = HLSL::CompileHLSL(fullSource.c_str(), fullSource.size(), profile.c_str(), true, log, warn);
-
-        auto str     = byteArrayToString(bin.data(), bin.size());
-        auto hash    = ShaderCache::CalculateHash(source);
-        auto hashStr = intArrayToString(hash.data(), hash.size());
+        auto bin  = HLSL::CompileHLSL(fullSource.c_str(), fullSource.size(), profile.c_str(), true, true, log, warn);
+        auto hash = ShaderCache::CalculateHash(source);
 
         ofstream outf(output);
-        outf << str;
+        writeByteArray(outf, bin.data(), bin.size());
         outf.close();
 
-        return make_pair(str, hashStr);
+        return make_pair(bin, hash);
     }
 }
 
@@ -250,6 +364,326 @@ string splitCode(const string& input)
     return split.str();
 }
 
+string contentKey(const string& content)
+{
+    const auto& hash = ShaderCache::CalculateHash(content);
+
+    ostringstream key;
+    key << std::hex << std::setfill('0');
+    for(const auto& h : hash)
+        key << std::setw(8) << h;
+    return key.str();
+}
+
+const Template& loadTemplate(const string& name)
+{
+    lock_guard<mutex> lock(templatesMutex);
+
+    auto& entry = templates[name];
+    if(!entry)
+    {
+        fstream           infile(templatePath / filesystem::path(name));
+        std::stringstream buffer;
+        buffer << infile.rdbuf();
+        entry = make_unique<Template>(buffer.str());
+    }
+    return *entry;
+}
+
+const string& templateSource(const string& name)
+{
+    return loadTemplate(name).Source();
+}
+
+// .slang with every file it includes, compiler settings and template; also picks up the alias
+// set by the source so presets get it whether or not the shader is rebuilt
+string shaderKey(SourceShaderDef& def)
+{
+    ostringstream content;
+    content << _manifestVersion << "\n" << (_tools ? _fxcPath : "") << "\n" << templateSource(_pack ? "ShaderPack.template" : "Shader.template") << "\n";
+    if(!_pack)
+        content << templateSource("ByteCode.template") << "\n";
+    for(const auto& line : ShaderGC::LoadSource(def.input.lexically_normal(), true, &sourceCache))
+    {
+        const auto& trimLine = trim(line);
+        if(trimLine.starts_with("#pragma name"))
+            def.presetParams["alias"] = trimLine.substr(13);
+        content << line << "\n";
+    }
+    return DiskCache::Key(content.str(), false);
+}
+
+string textureKey(const SourceTextureDef& def)
+{
+    ostringstream content;
+    content << _manifestVersion << "\n" << _compress << "\n" << templateSource(_pack ? "TexturePack.template" : "Texture.template") << "\n";
+    if(!_pack)
+        content << templateSource("TextureData.template") << "\n";
+    content << ifstream(def.input, ios::binary).rdbuf();
+    return contentKey(content.str());
+}
+
+// parsed preset, so changes to presets it references are picked up too
+string presetKey(const SourcePresetDef& def)
+{
+    ostringstream content;
+    content << _manifestVersion << "\n" << templateSource("Preset.template") << "\n" << def.input.generic_string() << "\n";
+    for(const auto& s : def.shaders)
+    {
+        content << s.info.className << "\n";
+        for(const auto& pp : s.presetParams)
+            content << pp.first << "=" << pp.second << "\n";
+    }
+    for(const auto& t : def.textures)
+    {
+        content << t.info.className << "\n";
+        for(const auto& pp : t.presetParams)
+            content << pp.first << "=" << pp.second << "\n";
+    }
+    for(const auto& o : def.overrides)
+        content << o.name << "=" << o.def << "\n";
+    return contentKey(content.str());
+}
+
+// pack entry an output needs, checked along with the manifest so a lost pack gets rebuilt
+string packEntry(const SourceShaderDef& def)
+{
+    return _pack ? def.info.className + "ShaderDef.vs" : string();
+}
+
+string packEntry(const SourceTextureDef& def)
+{
+    return _pack ? def.info.className + "TextureDef" : string();
+}
+
+// outputs are regenerated when missing, forced or generated from different inputs
+// (or not recorded in the manifest at all)
+bool isStale(const SourceShaderInfo& info, const string& key, const string& packEntry = string())
+{
+    if(_force || !filesystem::exists(info.outputPath))
+        return true;
+
+    if(packEntry.size() && !packEntries.contains(packEntry))
+        return true;
+
+    const auto& entry = manifest.find(info.relativePath.string());
+    return entry == manifest.end() || entry->second != key;
+}
+
+void recordOutput(const SourceShaderInfo& info, const string& key)
+{
+    manifest[info.relativePath.string()] = key;
+}
+
+void loadManifest()
+{
+    manifestPath = listPath;
+    manifestPath.replace_extension(".manifest");
+
+    ifstream infile(manifestPath);
+    string   line;
+    while(getline(infile, line))
+    {
+        const auto split = line.find(' ');
+        if(split != string::npos)
+            manifest[line.substr(split + 1)] = line.substr(0, split);
+    }
+}
+
+void saveManifest()
+{
+    vector<string> lines;
+    for(const auto& m : manifest)
+        lines.push_back(m.second + " " + m.first);
+    saveSource(manifestPath, lines);
+}
+
+void addPackEntry(const string& name, const uint8_t* data, size_t size)
+{
+    lock_guard<mutex> lock(packMutex);
+    packEntries[name].assign(data, data + size);
+    packDirty = true;
+}
+
+void loadPack()
+{
+    packPath = listPath;
+    packPath.replace_extension(".pack");
+    ShaderPack::Read(packPath, packEntries);
+}
+
+void savePack(ostream& reportStream)
+{
+    if(packDirty)
+    {
+        const auto saved = ShaderPack::Write(packPath, packEntries);
+        std::cout << "Generated pack " << packPath.string() << endl;
+        std::cout << "Pack: " << saved << " bytes saved by sharing" << endl;
+        reportStream << "Pack: " << saved << " bytes saved by sharing" << endl;
+    }
+}
+
+// stages are named after their bytecode and source hash, so ShaderDefs compiling to the same
+// stage share one header (and one cache entry); the template is included so a changed
+// ByteCode.template gives new names and ShaderDefs pick them up
+string byteCodeId(const vector<uint8_t>& byteCode, const vector<uint32_t>& hash)
+{
+    string content(templateSource("ByteCode.template"));
+    content.append((const char*)hash.data(), hash.size() * sizeof(uint32_t));
+    content.append((const char*)byteCode.data(), byteCode.size());
+    return contentKey(content).substr(0, 32);
+}
+
+filesystem::path byteCodeRelativePath(const string& id)
+{
+    return filesystem::path(string(_libName) + "\\ByteCode\\" + id + ".h");
+}
+
+// shared header relative to the ShaderDef or TextureDef including it
+string sharedInclude(const SourceShaderInfo& info, const filesystem::path& sharedPath)
+{
+    const auto& relativePath = info.relativePath.string();
+    string      include;
+    for(auto depth = count(relativePath.begin(), relativePath.end(), '\\'); depth > 0; depth--)
+        include += "..\\";
+    return include + sharedPath.string();
+}
+
+// true the first time id is seen in this run, otherwise its size counts as saved
+bool claimShared(SharedOutputs& shared, const string& id, size_t size)
+{
+    lock_guard<mutex> lock(sharedMutex);
+    shared.generated++;
+    if(shared.sizes.emplace(id, size).second)
+        return true;
+
+    shared.saved += size;
+    return false;
+}
+
+void reportShared(ostream& reportStream, const char* name, const SharedOutputs& shared)
+{
+    if(shared.generated == 0)
+        return;
+
+    ostringstream report;
+    report << name << ": " << shared.generated << " generated, " << shared.sizes.size() << " unique, " << shared.saved << " bytes saved by sharing";
+    std::cout << report.str() << endl;
+    reportStream << report.str() << endl;
+}
+
+// ids of the shared stages a generated ShaderDef includes, read back so unchanged ShaderDefs
+// still get their cache entries
+vector<string> byteCodeIds(const SourceShaderInfo& info)
+{
+    vector<string> ids;
+    ifstream       infile(info.outputPath);
+    string         line;
+    while(getline(infile, line) && !line.starts_with("namespace"))
+    {
+        const auto end = line.rfind(".h\"");
+        if(line.starts_with("#include \"") && line.find("ByteCode") != string::npos && end != string::npos)
+        {
+            const auto start = line.find_last_of("\\/", end);
+            ids.push_back(line.substr(start + 1, end - start - 1));
+        }
+    }
+    return ids;
+}
+
+// fragment cost of a ShaderDef, read back from its header when it wasn't rebuilt in this run
+StageCost shaderCost(const SourceShaderInfo& info)
+{
+    StageCost cost;
+    ifstream  infile(info.outputPath);
+    string    line;
+    while(getline(infile, line))
+    {
+        const auto pos = line.find("sCost {");
+        if(pos != string::npos)
+        {
+            istringstream values(line.substr(pos + 7));
+            char          comma;
+            values >> cost.alu >> comma >> cost.texture >> comma >> cost.samplers;
+            break;
+        }
+    }
+    return cost;
+}
+
+// writes the shared header of a stage once per run, an existing one already has this content
+void writeByteCode(const string& id, const vector<uint8_t>& byteCode, const vector<uint32_t>& hash)
+{
+    if(!claimShared(sharedByteCode, id, byteCode.size() + hash.size() * sizeof(uint32_t)))
+        return;
+
+    const auto& path = filesystem::path(outputPath / byteCodeRelativePath(id).string()).lexically_normal();
+    if(!_force && filesystem::exists(path))
+        return;
+
+    filesystem::create_directories(path.parent_path());
+    TemplateWriter writer(path);
+    writer.Set("LIB_NAME", _libName);
+    writer.Set("BYTECODE_ID", id);
+    writer.SetPayload("BYTECODE", [&](ostream& out) { writeByteArray(out, byteCode.data(), byteCode.size()); });
+    writer.SetPayload("BYTECODE_HASH", [&](ostream& out) { writeIntArray(out, hash.data(), hash.size()); });
+    for(const auto& line : loadTemplate("ByteCode.template").Lines())
+        writer.Write(line);
+}
+
+// images are named after their content, TextureDefs of the same image in different folders
+// share one header; like stages the template is part of the name
+string textureDataId(const SourceTextureDef& def)
+{
+    ostringstream content;
+    content << templateSource("TextureData.template") << _compress << ifstream(def.input, ios::binary).rdbuf();
+    return contentKey(content.str()).substr(0, 32);
+}
+
+// with -compress, large images other than LUTs become BC1/BC7 DDS; a serial build has the
+// cores to itself, batch builds already run one texture per worker
+bool compressTexture(const SourceTextureDef& def, vector<uint8_t>& dds, ostream& log)
+{
+    return _compress && TextureCompressor::Compress(def.input, dds, log, _threads == 1 ? 0 : 1);
+}
+
+filesystem::path textureDataRelativePath(const string& id)
+{
+    return filesystem::path(string(_libName) + "\\TextureData\\" + id + ".h");
+}
+
+// writes the shared header of an image once per run, an existing one already has this content
+void writeTextureData(const string& id, const SourceTextureDef& def, ostream& log)
+{
+    if(!claimShared(sharedTextures, id, (size_t)filesystem::file_size(def.input)))
+        return;
+
+    const auto& path = filesystem::path(outputPath / textureDataRelativePath(id).string()).lexically_normal();
+    if(!_force && filesystem::exists(path))
+        return;
+
+    filesystem::create_directories(path.parent_path());
+    TemplateWriter writer(path);
+    writer.Set("LIB_NAME", _libName);
+    writer.Set("TEXTURE_DATA_ID", id);
+    vector<uint8_t> dds;
+    if(compressTexture(def, dds, log))
+        writer.SetPayload("TEXTURE_DATA", [&](ostream& out) { writeByteArray(out, dds.data(), dds.size()); });
+    else
+        writer.SetPayload("TEXTURE_DATA", [&](ostream& out) { writeFileArray(out, def.input); });
+    for(const auto& line : loadTemplate("TextureData.template").Lines())
+        writer.Write(line);
+}
+
+// batch builds write the list once when all files are done
+void saveShaderList()
+{
+    if(_threads == 1)
+        saveSource(listPath, shaderList);
+    else
+        shaderListDirty = true;
+}
+
 void updateShaderList(const SourceShaderInfo& shaderInfo)
 {
     ostringstream oss;
@@ -259,28 +693,52 @@ void updateShaderList(const SourceShaderInfo& shaderInfo)
     {
         auto insertSpot = find(shaderList.begin(), shaderList.end(), "// %SHADER_INCLUDE%");
         shaderList.insert(insertSpot, shaderInclude);
-        saveSource(listPath, shaderList);
+        saveShaderList();
+    }
+}
+
+// adds line before marker unless the list already has it
+void addToShaderList(const string& line, const char* marker)
+{
+    if(find(shaderList.begin(), shaderList.end(), line) == shaderList.end())
+    {
+        auto insertSpot = find(shaderList.begin(), shaderList.end(), marker);
+        shaderList.insert(insertSpot, line);
+        saveShaderList();
     }
 }
 
 void updateCacheList(const SourceShaderInfo& shaderInfo)
 {
-    ostringstream oss;
-    oss << " cached.emplace_back(";
-    oss << _libName << shaderInfo.className << "ShaderDefs::sVertexHash, ";
-    oss << _libName << shaderInfo.className << "ShaderDefs::sVertexByteCode, ";
-    oss << "sizeof(" << _libName << shaderInfo.className << "ShaderDefs::sVertexByteCode));";
-    oss << " cached.emplace_back(";
-    oss << _libName << shaderInfo.className << "ShaderDefs::sFragmentHash, ";
-    oss << _libName << shaderInfo.className << "ShaderDefs::sFragmentByteCode, ";
-    oss << "sizeof(" << _libName << shaderInfo.className << "ShaderDefs::sFragmentByteCode));";
+    // lists from before stages were shared have a line per ShaderDef
+    auto shaderLine = find_if(shaderList.begin(), shaderList.end(), [&](const string& line) {
+        return line.starts_with(" cached.emplace_back(") && line.find(_libName + shaderInfo.className + "ShaderDefs::") != string::npos;
+    });
+    if(shaderLine != shaderList.end())
+    {
+        shaderList.erase(shaderLine);
+        saveShaderList();
+    }
 
-    const auto& shaderInclude = oss.str();
-    if(find(shaderList.begin(), shaderList.end(), shaderInclude) == shaderList.end())
+    if(_pack)
     {
-        auto insertSpot = find(shaderList.begin(), shaderList.end(), "// %SHADER_CACHE%");
-        shaderList.insert(insertSpot, shaderInclude);
-        saveSource(listPath, shaderList);
+        // one line adds hashes of all shaders in the pack
+        addToShaderList(" ShaderPack::Library().AddCachedShaders(cached);", "// %SHADER_CACHE%");
+        return;
+    }
+
+    // one line per shared stage, the list includes its header too so the line stays valid
+    // when ShaderDefs move to other stages
+    for(const auto& id : byteCodeIds(shaderInfo))
+    {
+        addToShaderList("#include \"" + byteCodeRelativePath(id).string() + "\"", "// %SHADER_INCLUDE%");
+
+        ostringstream oss;
+        oss << " cached.emplace_back(";
+        oss << _libName << "ByteCode::sHash" << id << ", ";
+        oss << _libName << "ByteCode::sByteCode" << id << ", ";
+        oss << "sizeof(" << _libName << "ByteCode::sByteCode" << id << "));";
+        addToShaderList(oss.str(), "// %SHADER_CACHE%");
     }
 }
 
@@ -293,21 +751,31 @@ void updateTextureList(const SourceShaderInfo& textureInfo)
     {
         auto insertSpot = find(shaderList.begin(), shaderList.end(), "// %TEXTURE_INCLUDE%");
         shaderList.insert(insertSpot, textureInclude);
-        saveSource(listPath, shaderList);
+        saveShaderList();
     }
 }
 
-void updatePresetList(const SourceShaderInfo& shaderInfo)
+void updatePresetList(const SourceShaderInfo& shaderInfo, float cost)
 {
     ostringstream oss;
     oss << "#include \"" << shaderInfo.relativePath.string() << "\"";
     const auto& presetInclude = oss.str();
 
+    // name, category and cost are listed so presets are only constructed when used
     ostringstream oss2;
-    oss2 << "new " << shaderInfo.className << "PresetDef(),";
+    oss2 << "{\"" << shaderInfo.shaderName << "\", \"" << shaderInfo.category << "\", " << fixed << setprecision(1) << cost << "f, CreatePreset<" << shaderInfo.className
+         << "PresetDef>},";
     const auto& presetClass = oss2.str();
 
-    bool updated = false;
+    // the preset may have been listed under an older name or cost
+    bool        updated = false;
+    const auto& factory = "CreatePreset<" + shaderInfo.className + "PresetDef>},";
+    const auto  listed  = find_if(shaderList.begin(), shaderList.end(), [&](const string& line) { return line.ends_with(factory); });
+    if(listed != shaderList.end() && *listed != presetClass)
+    {
+        *listed = presetClass;
+        updated = true;
+    }
 
     if(find(shaderList.begin(), shaderList.end(), presetInclude) == shaderList.end())
     {
@@ -324,78 +792,88 @@ void updatePresetList(const SourceShaderInfo& shaderInfo)
     }
 
     if(updated)
-        saveSource(listPath, shaderList);
+        saveShaderList();
 }
 
-void populateShaderTemplate(SourceShaderDef def, ofstream& log)
+void populateShaderTemplate(SourceShaderDef def, ostream& log)
 {
     const auto& info = def.info;
 
-    fstream           infile(templatePath / filesystem::path("Shader.template"));
-    std::stringstream buffer;
-    buffer << infile.rdbuf();
-    auto bufferString = buffer.str();
-    replace(bufferString, "%LIB_NAME%", _libName);
-    replace(bufferString, "%CLASS_NAME%", info.className);
-    replace(bufferString, "%SHADER_NAME%", info.shaderName);
-    replace(bufferString, "%SHADER_FORMAT%", def.format);
-    replace(bufferString, "%SHADER_CATEGORY%", info.category);
-    replace(bufferString, "%VERTEX_SOURCE%", splitCode(def.vertexSource));
-    replace(bufferString, "%FRAGMENT_SOURCE%", splitCode(def.fragmentSource));
-    replace(bufferString, "%VERTEX_BYTECODE%", def.vertexByteCode);
-    replace(bufferString, "%FRAGMENT_BYTECODE%", def.fragmentByteCode);
-    replace(bufferString, "%VERTEX_HASH%", def.vertexHash);
-    replace(bufferString, "%FRAGMENT_HASH%", def.fragmentHash);
-
     if(def.fragmentByteCode.empty() || def.vertexByteCode.empty())
     {
         throw std::runtime_error("Shader compilation failed");
     }
 
+    TemplateWriter writer(info.outputPath);
+    auto&          outfile = writer.Stream();
+    writer.Set("LIB_NAME", _libName);
+    writer.Set("CLASS_NAME", info.className);
+    writer.Set("SHADER_NAME", info.shaderName);
+    writer.Set("SHADER_FORMAT", def.format);
+    writer.Set("SHADER_CATEGORY", info.category);
+    writer.SetPayload("VERTEX_SOURCE", [&](ostream& out) { out << splitCode(def.vertexSource); });
+    writer.SetPayload("FRAGMENT_SOURCE", [&](ostream& out) { out << splitCode(def.fragmentSource); });
+    if(_pack)
+    {
+        const auto& name = info.className + "ShaderDef";
+        addPackEntry(name + ".vs", def.vertexByteCode.data(), def.vertexByteCode.size());
+        addPackEntry(name + ".ps", def.fragmentByteCode.data(), def.fragmentByteCode.size());
+        addPackEntry(name + ".vsh", (const uint8_t*)def.vertexHash.data(), def.vertexHash.size() * sizeof(uint32_t));
+        addPackEntry(name + ".psh", (const uint8_t*)def.fragmentHash.data(), def.fragmentHash.size() * sizeof(uint32_t));
+    }
+    else
+    {
+        const auto& vertexId   = byteCodeId(def.vertexByteCode, def.vertexHash);
+        const auto& fragmentId = byteCodeId(def.fragmentByteCode, def.fragmentHash);
+        writeByteCode(vertexId, def.vertexByteCode, def.vertexHash);
+        writeByteCode(fragmentId, def.fragmentByteCode, def.fragmentHash);
+        writer.Set("VERTEX_BYTECODE_ID", vertexId);
+        writer.Set("FRAGMENT_BYTECODE_ID", fragmentId);
+        writer.Set("VERTEX_BYTECODE_INCLUDE", sharedInclude(info, byteCodeRelativePath(vertexId)));
+        writer.Set("FRAGMENT_BYTECODE_INCLUDE", sharedInclude(info, byteCodeRelativePath(fragmentId)));
+    }
+
     std::vector<SourceShaderSampler> textures;
     def.params = ShaderGC::LookupParams(def.params, textures, def.fragmentMetadata);
+    writer.Set("PARAM_COUNT", to_string(count_if(def.params.begin(), def.params.end(), [](const SourceShaderParam& p) { return p.i != -1; })));
+    writer.Set("TEXTURE_COUNT", to_string(textures.size()));
+    writer.Set("COST_ALU", to_string(def.fragmentMetadata.cost.alu));
+    writer.Set("COST_TEXTURE", to_string(def.fragmentMetadata.cost.texture));
+    writer.Set("COST_SAMPLERS", to_string(def.fragmentMetadata.cost.samplers));
 
-    ofstream          outfile(info.outputPath);
-    std::stringstream iss(bufferString);
-    while(iss.good())
+    for(const auto& line : loadTemplate(_pack ? "ShaderPack.template" : "Shader.template").Lines())
     {
-        std::string line;
-        getline(iss, line, '\n');
-        if(line == "\"\"")
-            continue;
-        if(line.starts_with("%PARAM"))
+        if(line.raw.starts_with("%PARAM"))
         {
-            replace(line, "%PARAM%", "");
+            writer.Set("PARAM", "");
             for(const auto& p : def.params)
             {
                 if(p.i != -1)
                 {
-                    string paramLine(line);
-                    replace(paramLine, "%PARAM_NAME%", p.name);
-                    replace(paramLine, "%PARAM_BUFFER%", to_string(p.buffer));
-                    replace(paramLine, "%PARAM_SIZE%", to_string(p.size));
-                    replace(paramLine, "%PARAM_OFFSET%", to_string(p.offset));
-                    replace(paramLine, "%PARAM_MIN%", to_string(p.min));
-                    replace(paramLine, "%PARAM_MAX%", to_string(p.max));
-                    replace(paramLine, "%PARAM_DEF%", to_string(p.def));
-                    replace(paramLine, "%PARAM_STEP%", to_string(p.step));
-                    replace(paramLine, "%PARAM_DESC%", p.desc);
-                    outfile << paramLine << endl;
+                    writer.Set("PARAM_NAME", p.name);
+                    writer.Set("PARAM_BUFFER", to_string(p.buffer));
+                    writer.Set("PARAM_SIZE", to_string(p.size));
+                    writer.Set("PARAM_OFFSET", to_string(p.offset));
+                    writer.Set("PARAM_MIN", to_string(p.min));
+                    writer.Set("PARAM_MAX", to_string(p.max));
+                    writer.Set("PARAM_DEF", to_string(p.def));
+                    writer.Set("PARAM_STEP", to_string(p.step));
+                    writer.Set("PARAM_DESC", p.desc);
+                    writer.Write(line);
                 }
             }
         }
-        else if(line.starts_with("%TEXTURE"))
+        else if(line.raw.starts_with("%TEXTURE"))
         {
-            replace(line, "%TEXTURE%", "");
+            writer.Set("TEXTURE", "");
             for(const auto& t : textures)
             {
-                string textureLine(line);
-                replace(textureLine, "%TEXTURE_NAME%", t.name);
-                replace(textureLine, "%TEXTURE_BINDING%", to_string(t.binding));
-                outfile << textureLine << endl;
+                writer.Set("TEXTURE_NAME", t.name);
+                writer.Set("TEXTURE_BINDING", to_string(t.binding));
+                writer.Write(line);
             }
         }
-        else if(line.starts_with("%HEADER"))
+        else if(line.raw.starts_with("%HEADER"))
         {
             if(info.className.find("RetroCrisis") != string::npos)
             {
@@ -423,34 +901,32 @@ void populateShaderTemplate(SourceShaderDef def, ofstream& log)
             outfile << endl;
         }
         else
-            outfile << line << endl;
+            writer.Write(line);
     }
     outfile.close();
     log << "Generated ShaderDef " << info.outputPath << endl;
 }
 
-void populateTextureTemplate(SourceTextureDef def, ofstream& log)
+void populateTextureTemplate(SourceTextureDef def, ostream& log)
 {
     const auto& info = def.info;
 
-    fstream           infile(templatePath / filesystem::path("Texture.template"));
-    std::stringstream buffer;
-    buffer << infile.rdbuf();
-    auto bufferString = buffer.str();
-    replace(bufferString, "%LIB_NAME%", _libName);
-    replace(bufferString, "%TEXTURE_NAME%", def.input.filename().string());
-    replace(bufferString, "%CLASS_NAME%", info.className);
-    replace(bufferString, "%TEXTURE_DATA%", def.data);
-
-    ofstream          outfile(info.outputPath);
-    std::stringstream iss(bufferString);
-    while(iss.good())
-    {
-        std::string line;
-        getline(iss, line, '\n');
-        if(line == "\"\"")
-            continue;
-        if(line.starts_with("%HEADER"))
+    TemplateWriter writer(info.outputPath);
+    auto&          outfile = writer.Stream();
+    writer.Set("LIB_NAME", _libName);
+    writer.Set("TEXTURE_NAME", def.input.filename().string());
+    writer.Set("CLASS_NAME", info.className);
+    if(!_pack)
+    {
+        const auto& id = textureDataId(def);
+        writeTextureData(id, def, log);
+        writer.Set("TEXTURE_DATA_ID", id);
+        writer.Set("TEXTURE_DATA_INCLUDE", sharedInclude(info, textureDataRelativePath(id)));
+    }
+
+    for(const auto& line : loadTemplate(_pack ? "TexturePack.template" : "Texture.template").Lines())
+    {
+        if(line.raw.starts_with("%HEADER"))
         {
             if(info.className.find("RetroCrisis") != string::npos)
             {
@@ -471,91 +947,91 @@ void populateTextureTemplate(SourceTextureDef def, ofstream& log)
             outfile << "This file is auto-generated, do not modify directly." << endl;
         }
         else
-            outfile << line << endl;
+            writer.Write(line);
     }
     outfile.close();
     log << "Generated TextureDef " << info.outputPath << endl;
 }
 
+// entries of a constexpr PresetParamInfo table
+string presetParamsTable(const map<string, string>& presetParams)
+{
+    string table;
+    for(const auto& pp : presetParams)
+        table += (table.empty() ? "{\"" : ", {\"") + pp.first + "\", \"" + pp.second + "\"}";
+    return table;
+}
+
 void populatePresetTemplate(
-    const filesystem::path& input, const vector<SourceShaderDef>& shaders, const vector<SourceTextureDef>& textures, const vector<SourceShaderParam>& overrides, ofstream& log)
+    const filesystem::path& input, const vector<SourceShaderDef>& shaders, const vector<SourceTextureDef>& textures, const vector<SourceShaderParam>& overrides, ostream& log)
 {
     const auto& info = getShaderInfo(input, "PresetDef");
 
-    fstream           infile(templatePath / filesystem::path("Preset.template"));
-    std::stringstream buffer;
-    buffer << infile.rdbuf();
-    auto bufferString = buffer.str();
-    replace(bufferString, "%LIB_NAME%", _libName);
-    replace(bufferString, "%CLASS_NAME%", info.className);
-    replace(bufferString, "%PRESET_NAME%", info.shaderName);
-    replace(bufferString, "%PRESET_CATEGORY%", info.category);
-
-    ofstream          outfile(info.outputPath);
-    std::stringstream iss(bufferString);
-    while(iss.good())
-    {
-        std::string line;
-        getline(iss, line, '\n');
-        if(line == "\"\"")
-            continue;
-        if(line.starts_with("%SHADERS%"))
-        {
-            replace(line, "%SHADERS%", "         ");
+    TemplateWriter writer(info.outputPath);
+    auto&          outfile = writer.Stream();
+    writer.Set("LIB_NAME", _libName);
+    writer.Set("CLASS_NAME", info.className);
+    writer.Set("PRESET_NAME", info.shaderName);
+    writer.Set("PRESET_CATEGORY", info.category);
+    writer.Set("SHADER_COUNT", to_string(shaders.size()));
+    writer.Set("TEXTURE_COUNT", to_string(textures.size()));
 
-            for(const auto& s : shaders)
+    for(const auto& line : loadTemplate("Preset.template").Lines())
+    {
+        if(line.raw.starts_with("%SHADER_PARAMS%"))
+        {
+            writer.Set("SHADER_PARAMS", "");
+            for(size_t i = 0; i < shaders.size(); i++)
             {
-                string shaderLine(line);
-                replace(shaderLine, "%SHADER_NAME%", s.info.className);
-
-                // append preset params
-                stringstream paramsLines;
-                for(const auto& pp : s.presetParams)
-                {
-                    string paramLine(".Param(\"%PRESET_KEY%\", \"%PRESET_VALUE%\")");
-                    replace(paramLine, "%PRESET_KEY%", pp.first);
-                    replace(paramLine, "%PRESET_VALUE%", pp.second);
-                    paramsLines << endl << paramLine;
-                }
-                replace(shaderLine, "%PRESET_PARAMS%", paramsLines.str());
-                outfile << shaderLine << endl;
+                writer.Set("SHADER_INDEX", to_string(i));
+                writer.Set("PRESET_PARAM_COUNT", to_string(shaders[i].presetParams.size()));
+                writer.Set("PRESET_PARAMS", presetParamsTable(shaders[i].presetParams));
+                writer.Write(line);
             }
         }
-        else if(line.starts_with("%TEXTURES%"))
+        else if(line.raw.starts_with("%TEXTURE_PARAMS%"))
         {
-            replace(line, "%TEXTURES%", "          ");
-
-            for(const auto& t : textures)
+            writer.Set("TEXTURE_PARAMS", "");
+            for(size_t i = 0; i < textures.size(); i++)
             {
-                string textureLine(line);
-                replace(textureLine, "%TEXTURE_NAME%", t.info.className);
-
-                // append preset params
-                stringstream paramsLines;
-                for(const auto& pp : t.presetParams)
-                {
-                    string paramLine(".Param(\"%PRESET_KEY%\", \"%PRESET_VALUE%\")");
-                    replace(paramLine, "%PRESET_KEY%", pp.first);
-                    replace(paramLine, "%PRESET_VALUE%", pp.second);
-                    paramsLines << endl << paramLine;
-                }
-                replace(textureLine, "%TEXTURE_PARAMS%", paramsLines.str());
-                outfile << textureLine << endl;
+                writer.Set("TEXTURE_INDEX", to_string(i));
+                writer.Set("PRESET_PARAM_COUNT", to_string(textures[i].presetParams.size()));
+                writer.Set("PRESET_PARAMS", presetParamsTable(textures[i].presetParams));
+                writer.Write(line);
+            }
+        }
+        else if(line.raw.starts_with("%SHADERS%"))
+        {
+            writer.Set("SHADERS", "         ");
+            for(size_t i = 0; i < shaders.size(); i++)
+            {
+                writer.Set("SHADER_NAME", shaders[i].info.className);
+                writer.Set("SHADER_INDEX", to_string(i));
+                writer.Write(line);
+            }
+        }
+        else if(line.raw.starts_with("%TEXTURES%"))
+        {
+            writer.Set("TEXTURES", "          ");
+            for(size_t i = 0; i < textures.size(); i++)
+            {
+                writer.Set("TEXTURE_NAME", textures[i].info.className);
+                writer.Set("TEXTURE_INDEX", to_string(i));
+                writer.Write(line);
             }
         }
-        else if(line.starts_with("%OVERRIDES%"))
+        else if(line.raw.starts_with("%OVERRIDES%"))
         {
-            replace(line, "%OVERRIDES%", "           ");
+            writer.Set("OVERRIDES", "           ");
 
             for(const auto& o : overrides)
             {
-                string overrideLine(line);
-                replace(overrideLine, "%OVERRIDE_NAME%", o.name);
-                replace(overrideLine, "%OVERRIDE_VALUE%", to_string(o.def));
-                outfile << overrideLine << endl;
+                writer.Set("OVERRIDE_NAME", o.name);
+                writer.Set("OVERRIDE_VALUE", to_string(o.def));
+                writer.Write(line);
             }
         }
-        else if(line.starts_with("%HEADER"))
+        else if(line.raw.starts_with("%HEADER"))
         {
             if(info.className.find("RetroCrisis") != string::npos)
             {
@@ -581,17 +1057,17 @@ void populatePresetTemplate(
             outfile << "This file is auto-generated, do not modify directly." << endl;
         }
         else
-            outfile << line << endl;
+            writer.Write(line);
     }
     outfile.close();
     log << "Generated PresetDef " << info.outputPath << endl;
 }
 
-void processShader(SourceShaderDef& def, ofstream& log, bool& warn)
+void processShader(SourceShaderDef& def, ostream& log, bool& warn)
 {
     try
     {
-        ShaderGC::ProcessSourceShader(def, log, warn);
+        ShaderGC::ProcessSourceShader(def, log, warn, &sourceCache);
 
         const auto& vertexOutput   = spirv(glsl(def.input, "vert", def.vertexSource, log, warn), "vert", log, warn);
         const auto& fragmentOutput = spirv(glsl(def.input, "frag", def.fragmentSource, log, warn), "frag", log, warn);
@@ -600,10 +1076,6 @@ void processShader(SourceShaderDef& def, ofstream& log, bool& warn)
         def.fragmentSource         = fragmentOutput.first;
         def.fragmentMetadata       = fragmentOutput.second;
 
-        filesystem::path metaOutput(tempPath / def.input);
-        metaOutput.replace_extension(".meta");
-        saveSource(metaOutput, fragmentOutput.second);
-
         auto vertexCode      = fxc(def.input, "vs_5_0", vertexOutput.first, log, warn);
         auto fragmentCode    = fxc(def.input, "ps_5_0", fragmentOutput.first, log, warn);
         def.vertexByteCode   = vertexCode.first;
@@ -611,11 +1083,6 @@ void processShader(SourceShaderDef& def, ofstream& log, bool& warn)
         def.fragmentByteCode = fragmentCode.first;
         def.fragmentHash     = fragmentCode.second;
 
-        replace(def.vertexByteCode, " ", "");
-        replace(def.vertexHash, " ", "");
-        replace(def.fragmentByteCode, " ", "");
-        replace(def.fragmentHash, " ", "");
-
         populateShaderTemplate(def, log);
     }
     catch(std::runtime_error& ex)
@@ -625,76 +1092,91 @@ void processShader(SourceShaderDef& def, ofstream& log, bool& warn)
     }
 }
 
-string bin2string(filesystem::path input)
+void processTexture(SourceTextureDef def, ostream& log)
 {
-    ostringstream oss;
-    ifstream      infile(input, fstream::binary);
-    bool          first   = true;
-    int           counter = 0;
-
-    oss << "{";
-    char c;
-    while(infile.get(c))
+    if(_pack)
     {
-        if(first)
-        {
-            first = false;
-        }
-        else
+        vector<uint8_t> data;
+        if(!compressTexture(def, data, log))
         {
-            oss << ",";
+            ifstream infile(def.input, ios::binary);
+            data.assign(istreambuf_iterator<char>(infile), istreambuf_iterator<char>());
         }
-        oss << (int)((unsigned char)c);
-        counter++;
-        if(counter == 40)
-        {
-            counter = 0;
-            oss << endl;
-        }
-        if(infile.eof())
-            break;
+        addPackEntry(def.info.className + "TextureDef", data.data(), data.size());
     }
-    oss << "};";
-    return oss.str();
-}
-
-void processTexture(SourceTextureDef def, ofstream& log)
-{
-    def.data = bin2string(def.input);
     populateTextureTemplate(def, log);
 }
 
-void processPreset(SourcePresetDef& def, ofstream& log, bool& warn)
+void processPreset(SourcePresetDef& def, ostream& log, bool& warn)
 {
-    ShaderGC::ProcessSourcePreset(def, log, warn);
+    ShaderGC::ProcessSourcePreset(def, log, warn, &sourceCache);
 
     for(auto& s : def.shaders)
     {
-        s.info = getShaderInfo(s.input, "ShaderDef");
-        if(_force || !filesystem::exists(s.info.outputPath))
+        s.info          = getShaderInfo(s.input, "ShaderDef");
+        const auto& key = shaderKey(s);
+        if(isStale(s.info, key, packEntry(s)))
         {
             processShader(s, log, warn);
+            recordOutput(s.info, key);
         }
+        else
+            s.fragmentMetadata.cost = shaderCost(s.info);
         updateShaderList(s.info);
         updateCacheList(s.info);
     }
 
     for(auto& t : def.textures)
     {
-        t.info = getShaderInfo(t.input, "TextureDef");
-        if(_force || !filesystem::exists(t.info.outputPath))
+        t.info          = getShaderInfo(t.input, "TextureDef");
+        const auto& key = textureKey(t);
+        if(isStale(t.info, key, packEntry(t)))
         {
             processTexture(t, log);
+            recordOutput(t.info, key);
         }
         updateTextureList(t.info);
     }
 
-    def.info = getShaderInfo(def.input, "PresetDef");
-    if(_force || !filesystem::exists(def.info.outputPath))
+    def.info        = getShaderInfo(def.input, "PresetDef");
+    const auto& key = presetKey(def);
+    if(isStale(def.info, key))
     {
         populatePresetTemplate(def.input, def.shaders, def.textures, def.overrides, log);
+        recordOutput(def.info, key);
+    }
+    updatePresetList(def.info, ShaderCost::ChainCost(def.shaders));
+}
+
+filesystem::path logFilePath(const filesystem::path& input)
+{
+    auto inputString = input.string();
+    std::replace(inputString.begin(), inputString.end(), '\\', '!');
+    std::filesystem::create_directory(tempPath / "logs");
+    return tempPath / "logs" / (inputString + ".log");
+}
+
+void reportFile(const filesystem::path& input, filesystem::path logPath, bool warn, bool err, ofstream& reportStream)
+{
+    if(err)
+    {
+        auto orgPath(logPath);
+        std::filesystem::rename(orgPath, logPath.replace_extension(".ERROR.log"));
+        std::cout << "ERROR" << endl;
+        reportStream << "ERROR: " << input << endl;
+    }
+    else if(warn)
+    {
+        auto orgPath(logPath);
+        std::filesystem::rename(orgPath, logPath.replace_extension(".WARN.log"));
+        std::cout << "WARN" << endl;
+        reportStream << "WARN: " << input << endl;
+    }
+    else
+    {
+        std::cout << "OK" << endl;
+        reportStream << "OK: " << input << endl;
     }
-    updatePresetList(def.info);
 }
 
 void processFile(const filesystem::path& input, ofstream& reportStream)
@@ -711,11 +1193,14 @@ void processFile(const filesystem::path& input, ofstream& reportStream)
         return;
     }
 
-    auto inputString = input.string();
-    std::replace(inputString.begin(), inputString.end(), '\\', '!');
-    std::filesystem::path logPath(tempPath / "logs" / (inputString + ".log"));
-    std::filesystem::create_directory(tempPath / "logs");
-    ofstream log(logPath);
+    if(_threads != 1)
+    {
+        batchFiles.push_back(input);
+        return;
+    }
+
+    const auto logPath = logFilePath(input);
+    ofstream   log(logPath);
     bool     warn = false;
     bool     err  = false;
 
@@ -725,7 +1210,9 @@ void processFile(const filesystem::path& input, ofstream& reportStream)
         if(input.extension() == ".slang")
         {
             SourceShaderDef sd(input, getShaderInfo(input, "ShaderDef"));
+            const auto&     key = shaderKey(sd);
             processShader(sd, log, warn);
+            recordOutput(sd.info, key);
         }
         else if(input.extension() == ".slangp")
         {
@@ -744,25 +1231,262 @@ void processFile(const filesystem::path& input, ofstream& reportStream)
     }
     log.close();
 
-    if(err)
+    reportFile(input, logPath, warn, err, reportStream);
+}
+
+template<typename Def> struct BatchJob
+{
+    Def           def;
+    string        key;
+    bool          stale {false};
+    bool          needed {false}; // some input would have (re)generated it
+    bool          warn {false};
+    string        error;
+    ostringstream log;
+
+    BatchJob(const Def& def) : def {def} { }
+};
+
+struct BatchFile
+{
+    filesystem::path            input;
+    ostringstream               log; // parsing output, logs of jobs are appended in order
+    bool                        warn {false};
+    string                      error;
+    unique_ptr<SourcePresetDef> preset;
+    vector<pair<size_t, bool>>  shaders;  // job index, whether a serial run would build it
+    vector<pair<size_t, bool>>  textures; // as above
+};
+
+// adds def as a job unless another input already uses the same output, returns job index
+// and whether a serial run would build it for this input
+template<typename Def, typename Key>
+pair<size_t, bool> addBatchJob(vector<unique_ptr<BatchJob<Def>>>& jobs, map<filesystem::path, size_t>& index, const Def& def, Key keyOf, bool always)
+{
+    auto it = index.find(def.info.outputPath);
+    if(it == index.end())
     {
-        auto orgPath(logPath);
-        std::filesystem::rename(orgPath, logPath.replace_extension(".ERROR.log"));
-        std::cout << "ERROR" << endl;
-        reportStream << "ERROR: " << input << endl;
+        it         = index.emplace(def.info.outputPath, jobs.size()).first;
+        auto job   = make_unique<BatchJob<Def>>(def);
+        job->key   = keyOf(job->def);
+        job->stale = isStale(job->def.info, job->key, packEntry(job->def));
+        jobs.push_back(std::move(job));
     }
-    else if(warn)
+
+    auto& job = *jobs[it->second];
+    job.needed |= always || job.stale;
+    return make_pair(it->second, always || job.stale);
+}
+
+// builds queued inputs on _threads workers; shaders and textures of all presets are collected
+// first so each unique one is built by exactly one worker, then logs, the report and the list
+// are written in input order the same as a serial run would
+void processBatch(ofstream& reportStream)
+{
+    vector<unique_ptr<BatchFile>>                  files;
+    vector<unique_ptr<BatchJob<SourceShaderDef>>>  shaderJobs;
+    vector<unique_ptr<BatchJob<SourceTextureDef>>> textureJobs;
+    map<filesystem::path, size_t>                  shaderIndex, textureIndex;
+
+    for(const auto& input : batchFiles)
     {
-        auto orgPath(logPath);
-        std::filesystem::rename(orgPath, logPath.replace_extension(".WARN.log"));
-        std::cout << "WARN" << endl;
-        reportStream << "WARN: " << input << endl;
+        auto& file = *files.emplace_back(make_unique<BatchFile>());
+        file.input = input;
+        try
+        {
+            if(input.extension() == ".slang")
+            {
+                SourceShaderDef sd(input, getShaderInfo(input, "ShaderDef"));
+                file.shaders.push_back(addBatchJob(shaderJobs, shaderIndex, sd, shaderKey, true));
+            }
+            else if(input.extension() == ".slangp")
+            {
+                file.preset = make_unique<SourcePresetDef>(input, getShaderInfo(input, "PresetDef"));
+                ShaderGC::ProcessSourcePreset(*file.preset, file.log, file.warn, &sourceCache);
+
+                for(auto& s : file.preset->shaders)
+                {
+                    s.info = getShaderInfo(s.input, "ShaderDef");
+                    file.shaders.push_back(addBatchJob(shaderJobs, shaderIndex, s, shaderKey, false));
+
+                    const auto& job = *shaderJobs[file.shaders.back().first];
+                    if(job.def.presetParams.contains("alias"))
+                        s.presetParams["alias"] = job.def.presetParams.at("alias");
+                }
+                for(auto& t : file.preset->textures)
+                {
+                    t.info = getShaderInfo(t.input, "TextureDef");
+                    file.textures.push_back(addBatchJob(textureJobs, textureIndex, t, textureKey, false));
+                }
+            }
+        }
+        catch(std::exception& e)
+        {
+            file.error = e.what();
+        }
     }
-    else
+
+    cout << "Building " << shaderJobs.size() << " shaders and " << textureJobs.size() << " textures from " << files.size() << " files on "
+         << TaskPool::Threads(_threads) << " threads" << endl;
+
+    TaskPool::Run(shaderJobs.size() + textureJobs.size(), _threads, [&](size_t i) {
+        if(i < shaderJobs.size())
+        {
+            auto& job = *shaderJobs[i];
+            if(!job.needed)
+                return;
+            try
+            {
+                processShader(job.def, job.log, job.warn);
+            }
+            catch(std::exception& e)
+            {
+                job.error = e.what();
+            }
+        }
+        else
+        {
+            auto& job = *textureJobs[i - shaderJobs.size()];
+            if(!job.needed)
+                return;
+            try
+            {
+                processTexture(job.def, job.log);
+            }
+            catch(std::exception& e)
+            {
+                job.error = e.what();
+            }
+        }
+    });
+
+    // a serial run only builds an output the first time it's stale (or every time with -force)
+    vector<bool> shaderBuilt(shaderJobs.size()), textureBuilt(textureJobs.size());
+    for(auto& f : files)
     {
-        std::cout << "OK" << endl;
-        reportStream << "OK: " << input << endl;
+        auto& file = *f;
+        std::cout << file.input << " ...";
+        try
+        {
+            if(file.error.size())
+                throw std::runtime_error(file.error);
+
+            for(size_t i = 0; i < file.shaders.size(); i++)
+            {
+                const auto [j, process] = file.shaders[i];
+                const auto& job         = *shaderJobs[j];
+                if(process && (_force || !file.preset || !shaderBuilt[j]))
+                {
+                    file.log << job.log.str();
+                    file.warn |= job.warn;
+                    if(job.error.size())
+                        throw std::runtime_error(job.error);
+                    shaderBuilt[j] = true;
+                    recordOutput(job.def.info, job.key);
+                }
+                if(file.preset)
+                {
+                    updateShaderList(job.def.info);
+                    updateCacheList(job.def.info);
+                    file.preset->shaders[i].fragmentMetadata.cost = job.def.fragmentByteCode.size() ? job.def.fragmentMetadata.cost : shaderCost(job.def.info);
+                }
+            }
+
+            for(size_t i = 0; i < file.textures.size(); i++)
+            {
+                const auto [j, process] = file.textures[i];
+                const auto& job         = *textureJobs[j];
+                if(process && (_force || !textureBuilt[j]))
+                {
+                    file.log << job.log.str();
+                    if(job.error.size())
+                        throw std::runtime_error(job.error);
+                    textureBuilt[j] = true;
+                    recordOutput(job.def.info, job.key);
+                }
+                updateTextureList(job.def.info);
+            }
+
+            if(file.preset)
+            {
+                auto&       def = *file.preset;
+                def.info        = getShaderInfo(def.input, "PresetDef");
+                const auto& key = presetKey(def);
+                if(isStale(def.info, key))
+                {
+                    populatePresetTemplate(def.input, def.shaders, def.textures, def.overrides, file.log);
+                    recordOutput(def.info, key);
+                }
+                updatePresetList(def.info, ShaderCost::ChainCost(def.shaders));
+            }
+
+            file.log << "OK" << endl;
+        }
+        catch(std::exception& e)
+        {
+            cout << e.what() << endl;
+            file.error = e.what();
+
+            file.log << "ERROR:" << e.what() << endl;
+        }
+
+        const auto logPath = logFilePath(file.input);
+        ofstream   log(logPath);
+        log << file.log.str();
+        log.close();
+
+        reportFile(file.input, logPath, file.warn, file.error.size(), reportStream);
     }
+
+    if(shaderListDirty)
+        saveSource(listPath, shaderList);
+    batchFiles.clear();
+}
+
+// lists generated before presets were listed by name and category constructed every preset at
+// startup, their entries are rewritten from the preset headers; entries without a cost get
+// none until the preset is built again
+void migratePresetList()
+{
+    bool migrated = false;
+    for(auto& line : shaderList)
+    {
+        if(line == "const static std::vector<PresetDef*> PresetList = {")
+        {
+            line     = "constexpr PresetInfo PresetList[] = {";
+            migrated = true;
+        }
+        else if(line.starts_with("{\"") && line.find("\", CreatePreset<") != string::npos)
+        {
+            line.insert(line.find("\", CreatePreset<") + 3, "0.0f, ");
+            migrated = true;
+        }
+        else if(line.starts_with("new ") && line.ends_with("PresetDef(),"))
+        {
+            const auto& className = line.substr(4, line.size() - 7);
+            const auto  include   = find_if(shaderList.begin(), shaderList.end(), [&](const string& l) {
+                return l.starts_with("#include \"") && l.ends_with("\\" + className + ".h\"");
+            });
+            if(include == shaderList.end())
+                continue;
+
+            string name, category;
+            for(const auto& l : ShaderGC::LoadSource(listPath.parent_path() / include->substr(10, include->size() - 11), false))
+            {
+                const auto value = [&](const char* field, string& v) {
+                    const auto pos = l.find(field);
+                    if(pos != string::npos && v.empty())
+                        v = l.substr(pos + strlen(field), l.rfind('"') - pos - strlen(field));
+                };
+                value("Name = \"", name);
+                value("Category = \"", category);
+            }
+            line     = "{\"" + name + "\", \"" + category + "\", 0.0f, CreatePreset<" + className + ">},";
+            migrated = true;
+        }
+    }
+    if(migrated)
+        saveSource(listPath, shaderList);
 }
 
 void processListTemplate()
@@ -782,6 +1506,7 @@ void processListTemplate()
         std::cout << "Generated list " << listPath.string() << endl;
     }
     shaderList = ShaderGC::LoadSource(listPath, false);
+    migratePresetList();
 }
 
 int main(int argc, char* argv[])
@@ -800,6 +1525,7 @@ int main(int argc, char* argv[])
     reportStream << "Starting at " << (std::format("{:%Y-%m-%d %H:%M:%S}", std::chrono::system_clock::now())) << endl;
 
     processListTemplate();
+    loadManifest();
 
     try
     {
@@ -811,6 +1537,22 @@ int main(int argc, char* argv[])
                 _force = true;
                 continue;
             }
+            if(input == "-compress")
+            {
+                _compress = true;
+                continue;
+            }
+            if(input == "-pack")
+            {
+                _pack = true;
+                loadPack();
+                continue;
+            }
+            if(input == "-threads" && i < argc - 1)
+            {
+                _threads = (unsigned)atoi(argv[++i]);
+                continue;
+            }
             if(input == "-tools")
             {
                 if(!filesystem::exists(_fxcPath))
@@ -857,12 +1599,20 @@ int main(int argc, char* argv[])
                     processFile(input, reportStream);
             }
         }
+
+        if(batchFiles.size())
+            processBatch(reportStream);
     }
     catch(exception& e)
     {
         reportStream << "EXCEPTION: " << e.what() << endl;
     }
 
+    saveManifest();
+    savePack(reportStream);
+    reportShared(reportStream, "Bytecode", sharedByteCode);
+    reportShared(reportStream, "Textures", sharedTextures);
+
     reportStream << "Finishing at " << (std::format("{:%Y-%m-%d %H:%M:%S}", std::chrono::system_clock::now())) << endl;
     reportStream.close();
 }
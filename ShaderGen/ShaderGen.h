@@ -25,6 +25,10 @@ GNU General Public License v3.0
 #include <map>
 #include <unordered_set>
 #include <filesystem>
+#include <mutex>
+#include <functional>
+#include <charconv>
+#include <cstring>
 
 #include "SourceDefs.h"
 
@@ -50,6 +54,13 @@ const char*      _rcUrl = "https://github.com/RetroCrisis/Retro-Crisis-GDV-NTSC"
 bool             _force = false;
 bool             _tools = false;
 filesystem::path outputPath;
+unsigned         _threads  = 1; // 0 for all cores, anything but 1 builds all inputs as one batch
+bool             _pack     = false; // bytecode and textures go to RetroArch.pack instead of headers
+bool             _compress = false; // large non-LUT PNGs are stored as BC1/BC7 with mips
+
+// bump when generated headers change in a way templates and sources don't show, so
+// the build manifest marks all outputs stale
+const int _manifestVersion = 1;
 
 void replace(string& str, const string& macro, const string& value)
 {
@@ -61,6 +72,161 @@ void replace(string& str, const string& macro, const string& value)
     }
 }
 
+// template split once into lines of literal text and %NAME% placeholders
+class Template
+{
+public:
+    struct Segment
+    {
+        string text; // literal text or placeholder name
+        bool   placeholder;
+    };
+
+    struct Line
+    {
+        string          raw; // as written in the template
+        vector<Segment> segments;
+    };
+
+    Template(const string& source) : m_source {source}
+    {
+        // same split as reading with getline until the stream ends, trailing newline gives an empty line
+        size_t start = 0;
+        while(true)
+        {
+            const auto end = m_source.find('\n', start);
+            m_lines.push_back(Parse(m_source.substr(start, end == string::npos ? string::npos : end - start)));
+            if(end == string::npos)
+                break;
+            start = end + 1;
+        }
+    }
+
+    const string& Source() const
+    {
+        return m_source;
+    }
+
+    const vector<Line>& Lines() const
+    {
+        return m_lines;
+    }
+
+private:
+    static Line Parse(const string& raw)
+    {
+        Line line {raw};
+        auto literal = [&](const string& text) {
+            if(line.segments.empty() || line.segments.back().placeholder)
+                line.segments.push_back({text, false});
+            else
+                line.segments.back().text += text;
+        };
+
+        size_t i = 0;
+        while(i < raw.size())
+        {
+            const auto start = raw.find('%', i);
+            if(start == string::npos)
+            {
+                literal(raw.substr(i));
+                break;
+            }
+            literal(raw.substr(i, start - i));
+
+            auto end = start + 1;
+            while(end < raw.size() && (isupper((unsigned char)raw[end]) || isdigit((unsigned char)raw[end]) || raw[end] == '_'))
+                end++;
+            if(end < raw.size() && raw[end] == '%' && end > start + 1)
+            {
+                line.segments.push_back({raw.substr(start + 1, end - start - 1), true});
+                i = end + 1;
+            }
+            else
+            {
+                literal("%");
+                i = start + 1;
+            }
+        }
+        return line;
+    }
+
+    string       m_source;
+    vector<Line> m_lines;
+};
+
+// writes template lines through a large buffer; placeholders are filled from values or
+// streamed by payload writers (bytecode, texture data) without building them as strings
+class TemplateWriter
+{
+public:
+    using Payload = function<void(ostream&)>;
+
+    TemplateWriter(const filesystem::path& path) : m_buffer(1 << 20)
+    {
+        m_out.rdbuf()->pubsetbuf(m_buffer.data(), m_buffer.size());
+        m_out.open(path);
+    }
+
+    void Set(const string& name, const string& value)
+    {
+        m_values[name] = value;
+    }
+
+    void SetPayload(const string& name, Payload payload)
+    {
+        m_payloads[name] = std::move(payload);
+    }
+
+    void Write(const Template::Line& line)
+    {
+        string text;
+        bool   streamed = false;
+        for(const auto& s : line.segments)
+        {
+            if(!s.placeholder)
+            {
+                text += s.text;
+                continue;
+            }
+
+            const auto value = m_values.find(s.text);
+            if(value != m_values.end())
+            {
+                text += value->second;
+                continue;
+            }
+
+            const auto payload = m_payloads.find(s.text);
+            if(payload != m_payloads.end())
+            {
+                m_out << text;
+                text.clear();
+                payload->second(m_out);
+                streamed = true;
+            }
+            else
+                text += "%" + s.text + "%";
+        }
+
+        // lines left as "" are dropped
+        if(!streamed && text == "\"\"")
+            return;
+        m_out << text << '\n';
+    }
+
+    ofstream& Stream()
+    {
+        return m_out;
+    }
+
+private:
+    vector<char>         m_buffer; // must outlive m_out
+    ofstream             m_out;
+    map<string, string>  m_values;
+    map<string, Payload> m_payloads;
+};
+
 SourceShaderInfo getShaderInfo(const filesystem::path& slangInput, const string& suffix, bool fullPath = true)
 {
     SourceShaderInfo info;
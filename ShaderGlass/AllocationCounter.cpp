@@ -0,0 +1,75 @@
+/*
+ShaderGlass: shader effect overlay
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "AllocationCounter.h"
+
+#ifdef ALLOCATION_CHECK
+
+namespace
+{
+thread_local bool   tCounting {false};
+thread_local size_t tAllocations {0};
+}
+
+void AllocationCounter::Start()
+{
+    tAllocations = 0;
+    tCounting    = true;
+}
+
+size_t AllocationCounter::Stop()
+{
+    tCounting = false;
+    return tAllocations;
+}
+
+// the array, nothrow and sized forms of new and delete forward to these two pairs in the MSVC runtime
+void* operator new(size_t size)
+{
+    if(tCounting)
+        tAllocations++;
+
+    for(;;)
+    {
+        if(auto p = malloc(size ? size : 1))
+            return p;
+        auto handler = std::get_new_handler();
+        if(!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+// over-aligned types go through these and need the matching aligned free
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    if(tCounting)
+        tAllocations++;
+
+    for(;;)
+    {
+        if(auto p = _aligned_malloc(size ? size : 1, static_cast<size_t>(alignment)))
+            return p;
+        auto handler = std::get_new_handler();
+        if(!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    _aligned_free(p);
+}
+#endif
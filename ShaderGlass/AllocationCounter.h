@@ -0,0 +1,20 @@
+/*
+ShaderGlass: shader effect overlay
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+// counts operator new calls made by the calling thread between Start and Stop, backs the -allocs
+// check that frames in between preset or size changes don't allocate; global new and delete are
+// only replaced in builds with ALLOCATION_CHECK defined (Debug configurations)
+#ifdef ALLOCATION_CHECK
+class AllocationCounter
+{
+public:
+    static void   Start();
+    static size_t Stop();
+};
+#endif
@@ -10,7 +10,7 @@ GNU General Public License v3.0
 #include "resource.h"
 #include "BrowserWindow.h"
 
-constexpr int WINDOW_WIDTH  = 450;
+constexpr int WINDOW_WIDTH  = 560;
 constexpr int WINDOW_HEIGHT = 700;
 constexpr int CX_BITMAP     = 24;
 constexpr int CY_BITMAP     = 24;
@@ -136,6 +136,7 @@ void BrowserWindow::Resize()
         SendMessage(m_addFavButton, WM_SETFONT, (WPARAM)m_font, MAKELPARAM(TRUE, 0));
         SendMessage(m_delFavButton, WM_SETFONT, (WPARAM)m_font, MAKELPARAM(TRUE, 0));
         SendMessage(m_paramsButton, WM_SETFONT, (WPARAM)m_font, MAKELPARAM(TRUE, 0));
+        SendMessage(m_sortButton, WM_SETFONT, (WPARAM)m_font, MAKELPARAM(TRUE, 0));
         SendMessage(m_pixelSizeLabel, WM_SETFONT, (WPARAM)m_font, MAKELPARAM(TRUE, 0));
         SendMessage(m_pixelSizeValue, WM_SETFONT, (WPARAM)m_font, MAKELPARAM(TRUE, 0));
     }
@@ -173,7 +174,15 @@ void BrowserWindow::Resize()
                  NULL,
                  (LONG)(BUTTON_WIDTH * 2 * m_dpiScale),
                  rcClient.bottom - (LONG)(PANEL_HEIGHT * m_dpiScale),
-                 rcClient.right - (LONG)(BUTTON_WIDTH * 2 * m_dpiScale),
+                 (LONG)(BUTTON_WIDTH * m_dpiScale),
+                 (LONG)(PANEL_HEIGHT * m_dpiScale),
+                 0);
+
+    SetWindowPos(m_sortButton,
+                 NULL,
+                 (LONG)(BUTTON_WIDTH * 3 * m_dpiScale),
+                 rcClient.bottom - (LONG)(PANEL_HEIGHT * m_dpiScale),
+                 rcClient.right - (LONG)(BUTTON_WIDTH * 3 * m_dpiScale),
                  (LONG)(PANEL_HEIGHT * m_dpiScale),
                  0);
 }
@@ -336,6 +345,21 @@ HTREEITEM BrowserWindow::AddItemToTree(HWND hwndTV, LPTSTR lpszItem, LPARAM lPar
     return hPrev;
 }
 
+// presets are labelled with their estimated cost per output pixel when ShaderGen or an import computed one
+static std::string PresetLabel(const PresetEntry& preset)
+{
+    std::string label(preset.Name());
+    const auto  cost = preset.Cost();
+    char        costText[20];
+    if(cost >= 1000.0f)
+        snprintf(costText, 20, " (%.1fk)", cost / 1000.0f);
+    else if(cost > 0.0f)
+        snprintf(costText, 20, " (%.0f)", cost);
+    else
+        costText[0] = 0;
+    return label + costText;
+}
+
 void BrowserWindow::Build()
 {
     RECT rcClient; // dimensions of client area
@@ -379,19 +403,20 @@ void BrowserWindow::Build()
     int i = 0;
     for(const auto& sp : m_captureManager.Presets())
     {
-        if(sp->Category == "general")
+        if(sp.Category() == "general")
         {
             auto id     = WM_SHADER(i++);
-            noneItem    = AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(sp->Name.c_str()), id, 1);
+            noneItem    = AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(sp.Name().data()), id, 1);
             m_items[id] = noneItem;
             continue;
         }
-        if(categoryMenus.find(sp->Category) == categoryMenus.end())
+        const std::string category(sp.Category());
+        if(categoryMenus.find(category) == categoryMenus.end())
         {
-            categoryMenus.insert(std::make_pair(sp->Category, std::map<std::string, UINT, decltype(shaderComp)>()));
+            categoryMenus.insert(std::make_pair(category, std::map<std::string, UINT, decltype(shaderComp)>()));
         }
-        auto& menu = categoryMenus.find(sp->Category)->second;
-        menu.insert(std::make_pair(sp->Name, WM_SHADER(i++)));
+        auto& menu = categoryMenus.find(category)->second;
+        menu.insert(std::make_pair(std::string(sp.Name()), WM_SHADER(i++)));
     }
 
     m_personalItems = AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR("Personal Favorites"), -1, 1);
@@ -413,8 +438,10 @@ void BrowserWindow::Build()
 
     auto raItem = AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR("RetroArch Library"), -1, 1);
 
+    // category folders are numbered down from -1 so sorting keeps them in this order
     std::string parentCategory("");
-    int         level = 2;
+    int         level  = 2;
+    LPARAM      folder = -1;
     for(auto m : categoryMenus)
     {
         auto slash = m.first.find('/');
@@ -426,10 +453,10 @@ void BrowserWindow::Build()
             {
                 // add new parent
                 parentCategory = thisParent;
-                AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(parentCategory.c_str()), -1, 2);
+                AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(parentCategory.c_str()), folder--, 2);
             }
             level = 3;
-            AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(m.first.substr(slash + 1).c_str()), -1, level);
+            AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(m.first.substr(slash + 1).c_str()), folder--, level);
         }
         else if(m.first == parentCategory)
         {
@@ -444,11 +471,12 @@ void BrowserWindow::Build()
                 parentCategory = "";
             }
             level = 2;
-            AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(m.first.c_str()), -1, level);
+            AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(m.first.c_str()), folder--, level);
         }
         for(auto p : m.second)
         {
-            auto item         = AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(p.first.c_str()), p.second, level + 1);
+            const auto& label = PresetLabel(m_captureManager.Presets().at(p.second - WM_SHADER(0)));
+            auto        item  = AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(label.c_str()), p.second, level + 1);
             m_items[p.second] = item;
         }
     }
@@ -508,7 +536,7 @@ void BrowserWindow::Build()
                                   WS_TABSTOP | WS_VISIBLE | WS_CHILD,
                                   (LONG)(BUTTON_WIDTH * 2 * m_dpiScale),
                                   rcClient.bottom - (LONG)(PANEL_HEIGHT * m_dpiScale),
-                                  rcClient.right - (LONG)(BUTTON_WIDTH * 2 * m_dpiScale),
+                                  (LONG)(BUTTON_WIDTH * m_dpiScale),
                                   (LONG)(PANEL_HEIGHT * m_dpiScale),
                                   m_mainWindow,
                                   NULL,
@@ -516,6 +544,19 @@ void BrowserWindow::Build()
                                   NULL);
     SendMessage(m_paramsButton, WM_SETFONT, (LPARAM)m_font, true);
 
+    m_sortButton = CreateWindow(L"BUTTON",
+                                L"Sort by Cost",
+                                WS_TABSTOP | WS_VISIBLE | WS_CHILD | BS_AUTOCHECKBOX | BS_PUSHLIKE,
+                                (LONG)(BUTTON_WIDTH * 3 * m_dpiScale),
+                                rcClient.bottom - (LONG)(PANEL_HEIGHT * m_dpiScale),
+                                rcClient.right - (LONG)(BUTTON_WIDTH * 3 * m_dpiScale),
+                                (LONG)(PANEL_HEIGHT * m_dpiScale),
+                                m_mainWindow,
+                                NULL,
+                                (HINSTANCE)GetWindowLongPtr(m_mainWindow, GWLP_HINSTANCE),
+                                NULL);
+    SendMessage(m_sortButton, WM_SETFONT, (LPARAM)m_font, true);
+
     Resize();
 }
 
@@ -559,7 +600,7 @@ void BrowserWindow::LoadPersonal()
                     for(int p = 0; p < m_captureManager.Presets().size(); p++)
                     {
                         const auto& preset = m_captureManager.Presets().at(p);
-                        if(_strnicmp(preset->Category.c_str(), categoryName, MAX_VALUE) == 0 && _strnicmp(preset->Name.c_str(), profileName, MAX_VALUE) == 0)
+                        if(_strnicmp(preset.Category().data(), categoryName, MAX_VALUE) == 0 && _strnicmp(preset.Name().data(), profileName, MAX_VALUE) == 0)
                         {
                             auto id = WM_SHADER(p);
                             if(m_personal.find(id) == m_personal.end())
@@ -604,7 +645,7 @@ void BrowserWindow::SavePersonal()
                 const auto& profile = m_captureManager.Presets().at(p.first - WM_SHADER(0));
 
                 wchar_t value[MAX_VALUE];
-                _snwprintf_s(value, MAX_VALUE, L"%S:%S", profile->Category.c_str(), profile->Name.c_str());
+                _snwprintf_s(value, MAX_VALUE, L"%S:%S", profile.Category().data(), profile.Name().data());
                 wchar_t name[MAX_NAME];
                 _snwprintf_s(name, MAX_NAME, L"%d", index++);
                 RegSetValueEx(hkey, name, 0, REG_SZ, (PBYTE)value, (DWORD)(wcslen(value) * sizeof(wchar_t)));
@@ -616,6 +657,46 @@ void BrowserWindow::SavePersonal()
     }
 }
 
+// library and imported presets by name, or by estimated cost with unknown costs last
+int CALLBACK BrowserWindow::ComparePresets(LPARAM lParam1, LPARAM lParam2, LPARAM lParamSort)
+{
+    // category folders stay ahead of presets in the order they were added
+    if(lParam1 < 0 || lParam2 < 0)
+        return (lParam1 < 0 && lParam2 < 0) ? (int)(lParam2 - lParam1) : (lParam1 < 0 ? -1 : 1);
+
+    const auto  window  = (BrowserWindow*)lParamSort;
+    const auto& presets = window->m_captureManager.Presets();
+    const auto& p1      = presets.at(lParam1 - WM_SHADER(0));
+    const auto& p2      = presets.at(lParam2 - WM_SHADER(0));
+    if(window->m_sortByCost && p1.Cost() != p2.Cost())
+    {
+        if(p1.Cost() == 0.0f || p2.Cost() == 0.0f)
+            return p1.Cost() == 0.0f ? 1 : -1;
+        return p1.Cost() < p2.Cost() ? -1 : 1;
+    }
+    return _stricmp(p1.Name().data(), p2.Name().data());
+}
+
+void BrowserWindow::SortPresets()
+{
+    std::vector<HTREEITEM> parents;
+    for(const auto& item : m_items)
+    {
+        auto parent = TreeView_GetParent(m_treeControl, item.second);
+        if(parent != NULL && std::find(parents.begin(), parents.end(), parent) == parents.end())
+            parents.push_back(parent);
+    }
+
+    for(auto parent : parents)
+    {
+        TVSORTCB sort;
+        sort.hParent     = parent;
+        sort.lpfnCompare = ComparePresets;
+        sort.lParam      = (LPARAM)this;
+        TreeView_SortChildrenCB(m_treeControl, &sort, false);
+    }
+}
+
 LRESULT CALLBACK BrowserWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
     switch(message)
@@ -738,12 +819,14 @@ LRESULT CALLBACK BrowserWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam,
             is.hParent             = m_imported;
             is.hInsertAfter        = TVI_LAST;
             is.item.mask           = TVIF_TEXT | TVIF_IMAGE | TVIF_SELECTEDIMAGE | TVIF_PARAM;
-            is.item.pszText        = convertCharArrayToLPCWSTR(m_captureManager.Presets().at(lParam)->Name.c_str());
+            is.item.pszText        = convertCharArrayToLPCWSTR(PresetLabel(m_captureManager.Presets().at(lParam)).c_str());
             is.item.cchTextMax     = sizeof(is.item.pszText) / sizeof(is.item.pszText[0]);
             is.item.iImage         = g_nDocument;
             is.item.iSelectedImage = g_nDocument;
             is.item.lParam         = id;
             m_items[id]            = TreeView_InsertItem(m_treeControl, &is);
+            if(m_sortByCost)
+                SortPresets();
             return 0;
         }
         case WM_USER + 2: {
@@ -771,14 +854,14 @@ LRESULT CALLBACK BrowserWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam,
                 if(m_personal.find(id) == m_personal.end())
                 {
                     const auto& preset = m_captureManager.Presets().at(id - WM_SHADER(0));
-                    if(preset->Category == "Imported")
+                    if(preset.Category() == "Imported")
                         return 0;
 
                     TVINSERTSTRUCT is;
                     is.hParent             = m_personalItems;
                     is.hInsertAfter        = TVI_LAST;
                     is.item.mask           = TVIF_TEXT | TVIF_IMAGE | TVIF_SELECTEDIMAGE | TVIF_PARAM;
-                    is.item.pszText        = convertCharArrayToLPCWSTR(preset->Name.c_str());
+                    is.item.pszText        = convertCharArrayToLPCWSTR(preset.Name().data());
                     is.item.cchTextMax     = sizeof(is.item.pszText) / sizeof(is.item.pszText[0]);
                     is.item.iImage         = g_nDocument;
                     is.item.iSelectedImage = g_nDocument;
@@ -811,6 +894,11 @@ LRESULT CALLBACK BrowserWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam,
             {
                 PostMessage(m_shaderWindow, WM_COMMAND, IDM_SHADER_PARAMETERS, 0);
             }
+            else if(lParam == (LPARAM)m_sortButton)
+            {
+                m_sortByCost = SendMessage(m_sortButton, BM_GETCHECK, 0, 0) == BST_CHECKED;
+                SortPresets();
+            }
             return 0;
         }
         }
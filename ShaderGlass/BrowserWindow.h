@@ -32,6 +32,7 @@ private:
     HWND                      m_addFavButton;
     HWND                      m_delFavButton;
     HWND                      m_paramsButton;
+    HWND                      m_sortButton;
     HWND                      m_pixelSizeTrackBar;
     HWND                      m_pixelSizeLabel;
     HWND                      m_pixelSizeValue;
@@ -48,13 +49,16 @@ private:
     HTREEITEM                 m_imported;
     HTREEITEM                 m_personalItems;
     std::map<UINT, HTREEITEM> m_personal;
+    bool                      m_sortByCost {false};
 
     void Resize();
     void Build();
     void SavePersonal();
     void LoadPersonal();
+    void SortPresets();
 
     static LRESULT CALLBACK WndProcProxy(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
+    static int CALLBACK     ComparePresets(LPARAM lParam1, LPARAM lParam2, LPARAM lParamSort);
     ATOM                    MyRegisterClass(HINSTANCE hInstance);
     BOOL                    InitInstance(HINSTANCE hInstance, int nCmdShow);
     LRESULT CALLBACK        WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
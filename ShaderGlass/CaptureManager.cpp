@@ -9,12 +9,14 @@ GNU General Public License v3.0
 #include "CaptureManager.h"
 #include "ShaderList.h"
 #include "Helpers.h"
+#include "AllocationCounter.h"
 
 #include "Util/capture.desktop.interop.h"
 #include "Util/direct3d11.interop.h"
 #include "Util/d3dHelpers.h"
 
 #include <wincodec.h>
+#include <shlobj.h>
 #include "WIC\ScreenGrab11.h"
 #include "WIC\WICTextureLoader11.h"
 
@@ -22,17 +24,21 @@ using namespace std;
 using namespace util;
 using namespace util::uwp;
 
+constexpr uintmax_t DISK_CACHE_SIZE = 256 * 1024 * 1024;
+
 CaptureManager::CaptureManager(HINSTANCE instance) : m_options(), m_deviceName(L"Default"), m_lastPreset(-1), m_instance {instance} { }
 
 bool CaptureManager::Initialize()
 {
-    m_presetList.push_back(make_unique<PassthroughPresetDef>());
-    m_presetList.insert(m_presetList.end(), RetroArchPresetList.begin(), RetroArchPresetList.end());
+    const auto library = RetroArchPresetList();
+    m_presetList.reserve(library.size() + 1);
+    m_presetList.emplace_back(make_unique<PassthroughPresetDef>());
+    m_presetList.insert(m_presetList.end(), library.begin(), library.end());
     m_frameEvent = CreateEvent(NULL, FALSE, FALSE, L"FrameEvent");
     return false;
 }
 
-const vector<unique_ptr<PresetDef>>& CaptureManager::Presets()
+const vector<PresetEntry>& CaptureManager::Presets()
 {
     return m_presetList;
 }
@@ -45,13 +51,27 @@ vector<tuple<int, ShaderParam*>> CaptureManager::Params()
     return vector<tuple<int, ShaderParam*>>();
 }
 
+// built on first use, which can be the UI thread (specialization) or the compile thread (imports)
 const ShaderCache& CaptureManager::Cache()
 {
-    if(m_shaderCache.empty())
-    {
+    std::call_once(m_shaderCacheOnce, [this]() {
         const auto& raShaders = RetroArchCachedShaders();
         m_shaderCache.m_cachedShaders.insert(m_shaderCache.m_cachedShaders.begin(), raShaders.begin(), raShaders.end());
-    }
+        m_shaderCache.BuildIndex();
+
+        // compiled stages of imported shaders persist between launches
+        PWSTR localAppData = nullptr;
+        if(SUCCEEDED(SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, NULL, &localAppData)))
+        {
+            std::filesystem::path cachePath(localAppData);
+            cachePath /= L"ShaderGlass\\ShaderCache";
+            m_shaderCache.m_diskCache = make_unique<DiskCache>(cachePath, DISK_CACHE_SIZE);
+        }
+        CoTaskMemFree(localAppData);
+
+        // passes of all imported presets share identical stages
+        m_shaderCache.m_stageCache = make_unique<StageCache>();
+    });
 
     return m_shaderCache;
 }
@@ -158,6 +178,7 @@ bool CaptureManager::StartSession()
     UpdateLockedArea();
     UpdateCroppedArea();
     UpdateVertical();
+    UpdateSpecialization();
 
     if(m_options.imageFile.size())
     {
@@ -262,7 +283,7 @@ int CaptureManager::AddPreset(PresetDef* preset)
     int existing = 0, i = 0;
     for(const auto& p : m_presetList)
     {
-        if(p->Name == preset->Name && p->Category == preset->Category)
+        if(p.Name() == preset->Name && p.Category() == preset->Category)
         {
             existing = i;
             break;
@@ -271,12 +292,12 @@ int CaptureManager::AddPreset(PresetDef* preset)
     }
     if(existing)
     {
-        m_presetList[existing].reset(preset);
+        m_presetList[existing] = PresetEntry(std::unique_ptr<PresetDef>(preset));
         return existing;
     }
     else
     {
-        m_presetList.push_back(std::unique_ptr<PresetDef>(preset));
+        m_presetList.emplace_back(std::unique_ptr<PresetDef>(preset));
         return (int)m_presetList.size() - 1;
     }
 }
@@ -286,6 +307,19 @@ bool CaptureManager::IsActive()
     return m_session.get();
 }
 
+void CaptureManager::UpdatePreset(int presetNo, const PresetDef* preset, const std::function<void(PresetDef&)>& update)
+{
+    // list may have been rebuilt in the meantime
+    if(presetNo < 0 || presetNo >= (int)m_presetList.size() || m_presetList[presetNo].Get() != preset)
+        return;
+
+    auto& def = *m_presetList[presetNo].Get();
+    if(m_shaderGlass)
+        m_shaderGlass->UpdatePresetDef(&def, [&]() { update(def); });
+    else
+        update(def);
+}
+
 float CaptureManager::OutFPS()
 {
     if(m_shaderGlass)
@@ -389,7 +423,7 @@ void CaptureManager::UpdateShaderPreset()
         {
             SetParams(m_lastParams);
         }
-        m_shaderGlass->SetShaderPreset(m_presetList.at(m_options.presetNo).get(), m_queuedParams);
+        m_shaderGlass->SetShaderPreset(m_presetList.at(m_options.presetNo).Def(), m_queuedParams);
         m_queuedParams.clear();
         m_lastPreset = m_options.presetNo;
     }
@@ -428,6 +462,18 @@ void CaptureManager::UpdateVertical()
     }
 }
 
+void CaptureManager::UpdateSpecialization()
+{
+    // specializer outlives sessions so compiled variants are kept
+    if(m_options.specializeParams && !m_specializer)
+        m_specializer = make_unique<ShaderSpecializer>(Cache());
+
+    if(m_shaderGlass)
+    {
+        m_shaderGlass->SetSpecializer(m_options.specializeParams ? m_specializer.get() : nullptr);
+    }
+}
+
 void CaptureManager::GrabOutput()
 {
     if(m_shaderGlass)
@@ -463,6 +509,14 @@ void CaptureManager::ResetParams()
 
 void CaptureManager::ThreadFunc()
 {
+#ifdef ALLOCATION_CHECK
+    if(m_options.allocationCheck)
+    {
+        CheckAllocations();
+        return;
+    }
+#endif
+
     while(m_active)
     {
         WaitForSingleObject(m_frameEvent, 1);
@@ -470,6 +524,43 @@ void CaptureManager::ThreadFunc()
     }
 }
 
+#ifdef ALLOCATION_CHECK
+// -allocs n: once n frames have rendered since the chain was last rebuilt or resized, exit with 1 if
+// they made any heap allocations on this thread and 0 otherwise
+void CaptureManager::CheckAllocations()
+{
+    unsigned generation  = 0;
+    int      firstFrame  = -1;
+    size_t   allocations = 0;
+    while(m_active)
+    {
+        WaitForSingleObject(m_frameEvent, 1);
+        AllocationCounter::Start();
+        ProcessFrame();
+        auto frameAllocations = AllocationCounter::Stop();
+        if(!m_shaderGlass)
+            continue;
+
+        if(firstFrame < 0 || m_shaderGlass->Generation() != generation)
+        {
+            generation  = m_shaderGlass->Generation();
+            firstFrame  = m_shaderGlass->RenderCount();
+            allocations = 0;
+            continue;
+        }
+
+        allocations += frameAllocations;
+        if(m_shaderGlass->RenderCount() - firstFrame >= (int)m_options.allocationCheck)
+        {
+            char message[100];
+            snprintf(message, sizeof(message), "%zu allocations in %u frames\n", allocations, m_options.allocationCheck);
+            OutputDebugStringA(message);
+            ExitProcess(allocations ? 1 : 0);
+        }
+    }
+}
+#endif
+
 void CaptureManager::RememberLastPreset()
 {
     if(m_shaderGlass)
@@ -480,7 +571,7 @@ void CaptureManager::RememberLastPreset()
         {
             const auto pass        = std::get<0>(param);
             const auto shaderParam = std::get<1>(param);
-            m_lastParams.push_back(std::make_tuple(pass, shaderParam->name, shaderParam->currentValue));
+            m_lastParams.push_back(std::make_tuple(pass, std::string(shaderParam->name), shaderParam->currentValue));
         }
     }
 }
@@ -501,7 +592,7 @@ int CaptureManager::FindByName(const char* presetName)
     int p = 0;
     while(p < m_presetList.size())
     {
-        if(m_presetList[p]->Name == presetName)
+        if(m_presetList[p].Name() == presetName)
         {
             return p;
         }
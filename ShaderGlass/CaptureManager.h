@@ -42,6 +42,50 @@ struct CaptureOptions
     bool         useHDR {false};
     RECT         croppedArea {0, 0, 0, 0};
     bool         vertical {false};
+    bool         specializeParams {false};
+    unsigned     allocationCheck {0};
+};
+
+// built-in presets are listed by name and category and only get a PresetDef when first used,
+// imported ones come with theirs; names are null-terminated
+class PresetEntry
+{
+public:
+    PresetEntry(const PresetInfo& info) : m_info {&info} { }
+    PresetEntry(std::unique_ptr<PresetDef> def) : m_info {nullptr}, m_def {std::move(def)} { }
+
+    std::string_view Name() const
+    {
+        return m_def ? std::string_view(m_def->Name) : m_info->name;
+    }
+
+    std::string_view Category() const
+    {
+        return m_def ? std::string_view(m_def->Category) : m_info->category;
+    }
+
+    // estimated per output pixel, 0 when unknown
+    float Cost() const
+    {
+        return m_info ? m_info->cost : m_def->Cost;
+    }
+
+    // nullptr until the preset is used
+    PresetDef* Get() const
+    {
+        return m_def.get();
+    }
+
+    PresetDef* Def()
+    {
+        if(!m_def)
+            m_def.reset(m_info->create());
+        return m_def.get();
+    }
+
+private:
+    const PresetInfo*          m_info;
+    std::unique_ptr<PresetDef> m_def;
 };
 
 class CaptureManager
@@ -52,12 +96,12 @@ public:
     CaptureOptions m_options;
     std::wstring   m_deviceName;
 
-    const std::vector<std::unique_ptr<PresetDef>>& Presets();
-    std::vector<std::tuple<int, ShaderParam*>>     Params();
-    const ShaderCache&                             Cache();
-    const std::vector<CaptureDevice>&              CaptureDevices();
-    void                                           ShowCursor();
-    void                                           HideCursor();
+    const std::vector<PresetEntry>&            Presets();
+    std::vector<std::tuple<int, ShaderParam*>> Params();
+    const ShaderCache&                         Cache();
+    const std::vector<CaptureDevice>&          CaptureDevices();
+    void                                       ShowCursor();
+    void                                       HideCursor();
 
     bool  Initialize();
     bool  IsActive();
@@ -65,6 +109,7 @@ public:
     void  StopSession();
     void  Debug();
     int   AddPreset(PresetDef* preset);
+    void  UpdatePreset(int presetNo, const PresetDef* preset, const std::function<void(PresetDef&)>& update);
     void  UpdatePixelSize();
     void  UpdateOutputSize();
     void  UpdateOutputFlip();
@@ -75,6 +120,7 @@ public:
     void  UpdateLockedArea();
     void  UpdateCroppedArea();
     void  UpdateVertical();
+    void  UpdateSpecialization();
     void  GrabOutput();
     void  UpdateParams();
     void  ResetParams();
@@ -86,6 +132,9 @@ public:
     void  SaveOutput(LPWSTR fileName);
     void  ProcessFrame();
     void  ThreadFunc();
+#ifdef ALLOCATION_CHECK
+    void  CheckAllocations();
+#endif
     void  Exit();
     float InFPS();
     float OutFPS();
@@ -100,11 +149,13 @@ private:
     winrt::com_ptr<ID3D11Texture2D>                   m_outputTexture {nullptr};
     std::unique_ptr<CaptureSession>                   m_session {nullptr};
     std::unique_ptr<ShaderGlass>                      m_shaderGlass {nullptr};
-    std::vector<std::unique_ptr<PresetDef>>           m_presetList;
+    std::vector<PresetEntry>                          m_presetList;
     std::vector<std::tuple<int, std::string, double>> m_queuedParams;
     std::vector<std::tuple<int, std::string, double>> m_lastParams;
     std::vector<CaptureDevice>                        m_captureDevices;
     ShaderCache                                       m_shaderCache;
+    std::once_flag                                    m_shaderCacheOnce;
+    std::unique_ptr<ShaderSpecializer>                m_specializer {nullptr};
     DeviceCapture                                     m_deviceCapture;
     CursorEmulator                                    m_cursorEmulator;
     HANDLE                                            m_frameEvent {nullptr};
@@ -222,7 +222,7 @@ void ParamsWindow::RebuildControls(bool doResize)
     char        title[200];
     const auto& shader = m_captureManager.Presets().at(m_captureOptions.presetNo);
     if(m_captureManager.IsActive())
-        snprintf(title, 200, "Shader Parameters: %s", shader->Name.c_str());
+        snprintf(title, 200, "Shader Parameters: %s", shader.Name().data());
     else
         snprintf(title, 200, "Shader Parameters");
     SetWindowTextA(m_mainWindow, title);
@@ -251,7 +251,7 @@ void ParamsWindow::RebuildControls(bool doResize)
                 numSteps = (int)roundf((p->maxValue - p->minValue) / p->stepValue);
             }
             int startValue = (int)roundf(numSteps * (p->currentValue - p->minValue) / (p->maxValue - p->minValue));
-            AddTrackbar(0, numSteps, startValue, numSteps, p->name.c_str(), p);
+            AddTrackbar(0, numSteps, startValue, numSteps, p->name.data(), p);
         }
     }
 
@@ -440,8 +440,8 @@ void ParamsWindow::AddTrackbar(UINT iMin, UINT iMax, UINT iStart, UINT iSteps, c
 
     SendMessage(hwndTrack, WM_SETFONT, (LPARAM)m_font, true);
 
-    const char* label   = p->description.size() ? p->description.c_str() : name;
-    const char* tooltip = p->name.c_str();
+    const char* label   = p->description.size() ? p->description.data() : name;
+    const char* tooltip = p->name.data();
 
     auto paramNameWnd = CreateWindowEx(0,
                                        L"STATIC",
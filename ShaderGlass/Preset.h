@@ -17,9 +17,9 @@ public:
     Preset(PresetDef& presetDef);
     void Create(winrt::com_ptr<ID3D11Device> d3dDevice);
 
-    PresetDef&                     m_presetDef;
-    std::vector<Shader>            m_shaders;
-    std::map<std::string, Texture> m_textures;
+    PresetDef&                                  m_presetDef;
+    std::vector<Shader>                         m_shaders;
+    std::map<std::string, Texture, std::less<>> m_textures;
 
     ~Preset();
 };
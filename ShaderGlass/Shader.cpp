@@ -8,6 +8,7 @@ GNU General Public License v3.0
 #include "pch.h"
 
 #include "Shader.h"
+#include "DiskCache.h"
 
 static HRESULT hr;
 
@@ -45,8 +46,10 @@ const static std::unordered_map<std::string, DXGI_FORMAT> sFormats = {{"R8_UNORM
 Shader::Shader(ShaderDef& shaderDef) :
     m_shaderDef(shaderDef), m_vertexShader {}, m_pixelShader {}, m_alias {}, m_scaleAbsoluteX {}, m_scaleAbsoluteY {}, m_scaleViewportX {}, m_scaleViewportY {}
 {
-    m_pushBuffer = std::make_unique<int[]>(BufferSize(PUSH_BUFFER));
-    m_uboBuffer  = std::make_unique<int[]>(BufferSize(UBO_BUFFER));
+    m_pushSize   = shaderDef.ParamsSize(PUSH_BUFFER);
+    m_uboSize    = shaderDef.ParamsSize(UBO_BUFFER);
+    m_pushBuffer = std::make_unique<int[]>(m_pushSize);
+    m_uboBuffer  = std::make_unique<int[]>(m_uboSize);
     for(auto& p : shaderDef.Params)
     {
         SetParam(p.name, &p.defaultValue);
@@ -192,9 +195,9 @@ void Shader::Compile()
 void Shader::FillParams(int buffer, void* data)
 {
     if(buffer == PUSH_BUFFER)
-        memcpy(data, m_pushBuffer.get(), BufferSize(buffer));
+        memcpy(data, m_pushBuffer.get(), m_pushSize);
     else
-        memcpy(data, m_uboBuffer.get(), BufferSize(buffer));
+        memcpy(data, m_uboBuffer.get(), m_uboSize);
 }
 
 std::vector<ShaderParam*> Shader::Params()
@@ -211,12 +214,30 @@ void Shader::SetParam(ShaderParam* p, void* v)
 
     // if it's float remember value (user parameter)
     if(p->size == 4)
+    {
         p->currentValue = *((float*)v);
 
+        // moving a frozen parameter falls back to the generic shader
+        if(m_specializedValid)
+        {
+            auto frozen = m_frozenParams.find(p);
+            if(frozen != m_frozenParams.end() && frozen->second != p->currentValue)
+                m_specializedValid = false;
+        }
+    }
+
+    // bump the buffer version only on change so passes can skip uploading it
+    if(memcmp(buf + p->offset, v, p->size) == 0)
+        return;
+
     memcpy(buf + p->offset, v, p->size);
+    if(p->buffer == PUSH_BUFFER)
+        m_pushVersion++;
+    else
+        m_uboVersion++;
 }
 
-void Shader::SetParam(std::string name, void* v)
+void Shader::SetParam(std::string_view name, void* v)
 {
     for(auto& p : m_shaderDef.Params)
     {
@@ -228,28 +249,87 @@ void Shader::SetParam(std::string name, void* v)
     }
 }
 
-size_t Shader::BufferSize(int buffer)
+void Shader::SetParam(const ParamHandle& handle, void* v)
+{
+    for(auto p : handle.params)
+    {
+        if(p)
+            SetParam(p, v);
+    }
+}
+
+ParamHandle Shader::FindParam(std::string_view name)
+{
+    ParamHandle handle;
+    int         found = 0;
+    for(auto& p : m_shaderDef.Params)
+    {
+        if(p.name == name)
+        {
+            handle.params[found++] = &p;
+            if(found == 2)
+                break;
+        }
+    }
+    return handle;
+}
+
+size_t Shader::BufferSize(int buffer) const
 {
-    return m_shaderDef.ParamsSize(buffer);
+    return buffer == PUSH_BUFFER ? m_pushSize : m_uboSize;
+}
+
+uint32_t Shader::BufferVersion(int buffer) const
+{
+    return buffer == PUSH_BUFFER ? m_pushVersion : m_uboVersion;
 }
 
 bool Shader::IsTrue(const std::string& presetParam)
 {
-    auto it = m_shaderDef.PresetParams.find(presetParam);
-    return it != m_shaderDef.PresetParams.end() && (it->second == "true" || it->second == "1");
+    std::string_view value;
+    return m_shaderDef.PresetParams.Get(presetParam, value) && (value == "true" || value == "1");
 }
 
 bool Shader::Get(const std::string& presetParam, std::string& value)
 {
-    auto it = m_shaderDef.PresetParams.find(presetParam);
-    if(it != m_shaderDef.PresetParams.end())
+    std::string_view presetValue;
+    if(m_shaderDef.PresetParams.Get(presetParam, presetValue))
     {
-        value = it->second;
+        value = presetValue;
         return true;
     }
     return false;
 }
 
+const std::string& Shader::SourceHash()
+{
+    if(m_sourceHash.empty() && m_shaderDef.FragmentSource)
+        m_sourceHash = DiskCache::Key(m_shaderDef.FragmentSource, true);
+    return m_sourceHash;
+}
+
+void Shader::Specialize(winrt::com_ptr<ID3D11Device> d3dDevice, const std::string& key, const std::vector<const ShaderParam*>& frozen, const std::vector<uint8_t>& byteCode)
+{
+    Unspecialize();
+
+    hr = d3dDevice->CreatePixelShader(byteCode.data(), byteCode.size(), NULL, m_specializedShader.put());
+    if(FAILED(hr))
+        return;
+
+    for(const auto p : frozen)
+        m_frozenParams.emplace(p, p->currentValue);
+    m_specializedKey   = key;
+    m_specializedValid = true;
+}
+
+void Shader::Unspecialize()
+{
+    m_specializedValid  = false;
+    m_specializedShader = nullptr;
+    m_specializedKey.clear();
+    m_frozenParams.clear();
+}
+
 Shader::Shader(Shader&& shader) : m_shaderDef(shader.m_shaderDef)
 {
     throw std::runtime_error("This shouldn't happen");
@@ -257,8 +337,9 @@ Shader::Shader(Shader&& shader) : m_shaderDef(shader.m_shaderDef)
 
 Shader::~Shader()
 {
-    m_pixelShader  = nullptr;
-    m_vertexShader = nullptr;
-    m_vertexBlob   = nullptr;
-    m_pixelBlob    = nullptr;
+    m_pixelShader       = nullptr;
+    m_specializedShader = nullptr;
+    m_vertexShader      = nullptr;
+    m_vertexBlob        = nullptr;
+    m_pixelBlob         = nullptr;
 }
\ No newline at end of file
@@ -32,12 +32,22 @@ union float4x4
     }
 };
 
+// parameters a name resolves to, same name can be in both buffers; resolve once and set
+// through the handle on paths that run every frame
+struct ParamHandle
+{
+    ShaderParam* params[2] {nullptr, nullptr};
+};
+
 class Shader
 {
 public:
     ShaderDef&                         m_shaderDef;
     winrt::com_ptr<ID3D11VertexShader> m_vertexShader;
     winrt::com_ptr<ID3D11PixelShader>  m_pixelShader;
+    winrt::com_ptr<ID3D11PixelShader>  m_specializedShader;
+    std::string                        m_specializedKey {};
+    std::atomic<bool>                  m_specializedValid {false};
     std::string                        m_alias {};
     float                              m_scaleX {1.0f};
     float                              m_scaleY {1.0f};
@@ -61,14 +71,33 @@ public:
     std::vector<ShaderParam*> Params();
     void                      FillParams(int buffer, void* data);
     void                      SetParam(ShaderParam* p, void* v);
-    void                      SetParam(std::string name, void* p);
-    size_t                    BufferSize(int buffer);
+    void                      SetParam(std::string_view name, void* p);
+    void                      SetParam(const ParamHandle& handle, void* v);
+    ParamHandle               FindParam(std::string_view name);
+    size_t                    BufferSize(int buffer) const;
+    uint32_t                  BufferVersion(int buffer) const;
+    const std::string&        SourceHash();
+    void Specialize(winrt::com_ptr<ID3D11Device> d3dDevice, const std::string& key, const std::vector<const ShaderParam*>& frozen, const std::vector<uint8_t>& byteCode);
+    void Unspecialize();
+
+    ID3D11PixelShader* PixelShader()
+    {
+        return m_specializedValid ? m_specializedShader.get() : m_pixelShader.get();
+    }
 
 private:
     std::unique_ptr<int[]>   m_pushBuffer;
     std::unique_ptr<int[]>   m_uboBuffer;
+    size_t                   m_pushSize {0};
+    size_t                   m_uboSize {0};
+    uint32_t                 m_pushVersion {1};
+    uint32_t                 m_uboVersion {1};
     winrt::com_ptr<ID3DBlob> m_vertexBlob;
     winrt::com_ptr<ID3DBlob> m_pixelBlob;
+    std::string              m_sourceHash;
+
+    // values baked into m_specializedShader
+    std::unordered_map<const ShaderParam*, float> m_frozenParams;
 
     bool IsTrue(const std::string& presetParam);
     bool Get(const std::string& presetParam, std::string& value);
@@ -8,6 +8,7 @@ GNU General Public License v3.0
 #include "pch.h"
 #include "ShaderGlass.h"
 #include "ShaderList.h"
+#include "ShaderGC.h"
 #include "CursorEmulator.h"
 #include "resource.h"
 
@@ -16,7 +17,7 @@ static const float background_colour[4] = {0, 0, 0, 1.0f};
 
 ShaderGlass::ShaderGlass(CursorEmulator& cursorEmulator) :
     m_lastSize {}, m_lastPos {}, m_lastCaptureWindowPos {}, m_lastCaptureWindowSize {}, m_passthroughDef(), m_shaderPreset(new Preset(m_passthroughDef)),
-    m_preprocessShader(m_preprocessShaderDef), m_preprocessPreset(m_preprocessPresetDef), m_preprocessPass(m_preprocessShader, m_preprocessPreset, true),
+    m_preprocessShader(m_preprocessShaderDef), m_preprocessPreset(m_preprocessPresetDef), m_preprocessPass(m_preprocessShader, m_preprocessPreset, m_stateCache, true),
     m_cursorEmulator(cursorEmulator)
 { }
 
@@ -27,6 +28,12 @@ ShaderGlass::~ShaderGlass()
     DestroyShaders();
     DestroyPasses();
     DestroyTargets();
+    for(auto& iv : m_inputViews)
+    {
+        iv.second = nullptr;
+        iv.first  = nullptr;
+    }
+    m_stateCache.Clear();
 
     m_context->Flush();
 }
@@ -158,6 +165,7 @@ void ShaderGlass::Initialize(HWND                                outputWindow,
 
     m_context->RSSetState(m_rasterizerState.get());
 
+    m_stateCache.Initialize(m_device);
     m_preprocessShader.Create(m_device);
     m_preprocessPass.Initialize(m_device, m_context);
     RebuildShaders();
@@ -171,11 +179,11 @@ void ShaderGlass::RebuildShaders()
     m_shaderPasses.reserve(m_shaderPreset->m_shaders.size() + (m_vertical ? 1 : 0));
     for(auto& shader : m_shaderPreset->m_shaders)
     {
-        m_shaderPasses.emplace_back(shader, *m_shaderPreset, m_device, m_context);
+        m_shaderPasses.emplace_back(shader, *m_shaderPreset, m_stateCache, m_device, m_context);
     }
     if(m_vertical)
     {
-        m_shaderPasses.emplace_back(m_preprocessShader, m_preprocessPreset, m_device, m_context);
+        m_shaderPasses.emplace_back(m_preprocessShader, m_preprocessPreset, m_stateCache, m_device, m_context);
     }
     float vertical = m_vertical ? 1.0f : 0.0f;
     m_preprocessShader.SetParam("SGVertical", &vertical);
@@ -186,7 +194,7 @@ void ShaderGlass::RebuildShaders()
         m_presetTextures.insert(make_pair(texture.second.m_name, texture.second.m_textureView));
     }
 
-    ResetParams();
+    ApplyDefaultParams();
 }
 
 void ShaderGlass::SetInputScale(float w, float h)
@@ -216,6 +224,77 @@ void ShaderGlass::SetShaderPreset(PresetDef* p, const std::vector<std::tuple<int
     m_newParams       = params;
 }
 
+// modifies a def between frames and recreates shader objects if it's the running preset,
+// passes, targets and params are kept so the swap is seamless
+void ShaderGlass::UpdatePresetDef(PresetDef* p, const std::function<void()>& update)
+{
+    std::unique_lock lock(m_mutex);
+
+    update();
+
+    if(&m_shaderPreset->m_presetDef != p)
+        return;
+
+    for(auto& shader : m_shaderPreset->m_shaders)
+    {
+        shader.m_vertexShader = nullptr;
+        shader.m_pixelShader  = nullptr;
+        shader.Create(m_device);
+    }
+}
+
+void ShaderGlass::SetSpecializer(ShaderSpecializer* specializer)
+{
+    std::unique_lock lock(m_mutex);
+
+    m_specializer       = specializer;
+    m_specializeUpdated = true;
+}
+
+// swaps in fragment variants with untouched parameters baked in as constants, passes
+// keep using the generic shader until their variant is ready or when a frozen parameter moves
+void ShaderGlass::SpecializeShaders()
+{
+    const auto generation = m_specializer ? m_specializer->Generation() : 0;
+    if(!m_specializeUpdated && generation == m_specializerGeneration)
+        return;
+    m_specializeUpdated     = false;
+    m_specializerGeneration = generation;
+    m_generation++;
+
+    for(auto& shader : m_shaderPreset->m_shaders)
+    {
+        // only imported shaders keep their source
+        if(!m_specializer || !shader.m_shaderDef.FragmentSourceData)
+        {
+            shader.Unspecialize();
+            continue;
+        }
+
+        std::vector<const ShaderParam*> frozen;
+        for(auto& p : shader.Params())
+        {
+            if(p->size == 4 && !p->description.empty() && p->currentValue == GetDefaultValue(p))
+                frozen.push_back(p);
+        }
+        if(frozen.empty())
+        {
+            shader.Unspecialize();
+            continue;
+        }
+
+        const auto& key = ShaderSpecializer::Key(shader.SourceHash(), frozen);
+        if(shader.m_specializedValid && shader.m_specializedKey == key)
+            continue;
+
+        const auto& byteCode = m_specializer->Get(key, frozen, shader.m_shaderDef.FragmentSourceData, shader.m_shaderDef.FragmentData);
+        if(byteCode)
+            shader.Specialize(m_device, key, frozen, *byteCode);
+        else
+            shader.Unspecialize();
+    }
+}
+
 void ShaderGlass::SetFrameSkip(int s)
 {
     m_frameSkip = s;
@@ -267,8 +346,22 @@ void ShaderGlass::DestroyTargets()
     }
 }
 
+// the UI thread sets parameters while frames render, shaders' buffers and frozen values are only touched under m_mutex
 void ShaderGlass::UpdateParams()
 {
+    std::unique_lock lock(m_mutex);
+    ApplyParams();
+}
+
+void ShaderGlass::ResetParams()
+{
+    std::unique_lock lock(m_mutex);
+    ApplyDefaultParams();
+}
+
+void ShaderGlass::ApplyParams()
+{
+    m_specializeUpdated = true;
     for(auto& s : m_shaderPreset->m_shaders)
         for(auto& p : s.Params())
         {
@@ -289,8 +382,9 @@ float ShaderGlass::GetDefaultValue(ShaderParam* p)
     return p->defaultValue;
 }
 
-void ShaderGlass::ResetParams()
+void ShaderGlass::ApplyDefaultParams()
 {
+    m_specializeUpdated = true;
     for(auto& s : m_shaderPreset->m_shaders)
         for(auto& p : s.Params())
         {
@@ -395,6 +489,11 @@ void ShaderGlass::DestroyPasses()
     m_passTargets.clear();
     m_passTextures.clear();
     m_passResources.clear();
+    m_passViews.clear();
+    m_feedbackCopies.clear();
+    m_lastFeedback = nullptr;
+    m_historyViews.clear();
+    m_historyTextures.clear();
     m_requiresFeedback = false;
     m_requiresHistory  = 0;
 }
@@ -415,6 +514,23 @@ void ShaderGlass::PresentFrame()
     PostMessage(m_outputWindow, WM_PAINT, 0, 0); // necessary for click-through
 }
 
+ID3D11ShaderResourceView* ShaderGlass::InputView(ID3D11Texture2D* texture)
+{
+    for(const auto& iv : m_inputViews)
+    {
+        if(iv.first.get() == texture)
+            return iv.second.get();
+    }
+
+    // replace the oldest, holding on to the texture keeps its address from being reused
+    auto& iv = m_inputViews[m_nextInputView++ % m_inputViews.size()];
+    iv.first.copy_from(texture);
+    iv.second = nullptr;
+    hr        = m_device->CreateShaderResourceView(texture, nullptr, iv.second.put());
+    assert(SUCCEEDED(hr));
+    return iv.second.get();
+}
+
 void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG frameTicks, int inputFrameNo)
 {
     auto nowTicks            = GetTickCount64();
@@ -633,12 +749,16 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
         m_startTicks = GetTickCount64(); // reset logical frame no
 
         DestroyShaders();
+
+        // the previous preset goes after the new one is built so images both use aren't decoded again
+        std::unique_ptr<Preset> previousPreset;
         if(m_newShaderPreset)
         {
-            m_shaderPreset.swap(m_newShaderPreset);
-            m_newShaderPreset.reset();
+            previousPreset = std::move(m_shaderPreset);
+            m_shaderPreset = std::move(m_newShaderPreset);
         }
         RebuildShaders();
+        previousPreset.reset();
         if(m_newParams.size())
         {
             const auto& shaderParams = Params();
@@ -654,7 +774,7 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
                 }
             }
             m_newParams.clear();
-            UpdateParams();
+            ApplyParams();
         }
         PostMessage(m_outputWindow, WM_COMMAND, IDM_UPDATE_PARAMS, 0);
         inputRescaled     = true;
@@ -663,6 +783,8 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
         m_verticalUpdated = false;
     }
 
+    SpecializeShaders();
+
     // size of preprocessed input, which is 'original' for the shader chain
     UINT originalWidth  = static_cast<UINT>(destWidth / m_inputScaleW);
     UINT originalHeight = static_cast<UINT>(destHeight / m_inputScaleH);
@@ -706,6 +828,7 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
 
     if(inputRescaled || outputResized || inputResized)
     {
+        m_generation++;
         if(m_vertical)
         {
             std::swap(originalWidth, originalHeight);
@@ -717,8 +840,8 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
         m_textureSizes.insert(std::make_pair("FinalViewport", float4 {(float)viewportWidth, (float)viewportHeight, 1.0f / viewportWidth, 1.0f / viewportHeight}));
 
         // preprocess takes original texture full size
-        std::vector<std::array<UINT, 4>> passSizes;
-        m_preprocessPass.Resize(capturedTextureDesc.Width, capturedTextureDesc.Height, originalWidth, originalHeight, m_textureSizes, passSizes);
+        m_passSizes.clear();
+        m_preprocessPass.Resize(capturedTextureDesc.Width, capturedTextureDesc.Height, originalWidth, originalHeight, m_textureSizes, m_passSizes);
 
         UINT sourceWidth  = originalWidth;
         UINT sourceHeight = originalHeight;
@@ -732,7 +855,7 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
                     std::swap(originalWidth, originalHeight);
                     std::swap(viewportWidth, viewportHeight);
                 }
-                passSizes.push_back({sourceWidth, sourceHeight, viewportWidth, viewportHeight});
+                m_passSizes.push_back({sourceWidth, sourceHeight, viewportWidth, viewportHeight});
             }
             else
             {
@@ -750,7 +873,7 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
                     outputHeight = static_cast<UINT>(shaderPass.m_shader.m_scaleY);
                 else
                     outputHeight = static_cast<UINT>(sourceHeight * shaderPass.m_shader.m_scaleY);
-                passSizes.push_back({sourceWidth, sourceHeight, outputWidth, outputHeight});
+                m_passSizes.push_back({sourceWidth, sourceHeight, outputWidth, outputHeight});
                 if(!shaderPass.m_shader.m_alias.empty())
                 {
                     m_textureSizes.insert(std::make_pair(shaderPass.m_shader.m_alias, float4 {(float)outputWidth, (float)outputHeight, 1.0f / outputWidth, 1.0f / outputHeight}));
@@ -764,12 +887,13 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
         for(int p = 0; p < m_shaderPasses.size(); p++)
         {
             auto& shaderPass = m_shaderPasses[p];
-            shaderPass.Resize(passSizes[p][0], passSizes[p][1], passSizes[p][2], passSizes[p][3], m_textureSizes, passSizes);
+            shaderPass.Resize(m_passSizes[p][0], m_passSizes[p][1], m_passSizes[p][2], m_passSizes[p][3], m_textureSizes, m_passSizes);
         }
     }
 
     if(rebuildPasses)
     {
+        m_generation++;
         DestroyPasses();
 
         for(auto& pt : m_presetTextures)
@@ -839,6 +963,7 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
                     hr = m_device->CreateShaderResourceView(feedbackTexture.get(), nullptr, feedbackResource.put());
                     assert(SUCCEEDED(hr));
                     m_passResources.insert(std::make_pair(std::string("PassFeedback") + std::to_string(p - 1), feedbackResource));
+                    m_feedbackCopies.emplace_back(passTexture.get(), feedbackTexture.get());
                     if(!pass.m_shader.m_alias.empty())
                     {
                         m_passResources.insert(std::make_pair(pass.m_shader.m_alias + "Feedback", feedbackResource));
@@ -875,6 +1000,7 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
                 hr = m_device->CreateShaderResourceView(historyTexture.get(), nullptr, historyResource.put());
                 assert(SUCCEEDED(hr));
                 m_passResources.insert(std::make_pair(std::string("OriginalHistory") + std::to_string(h + 1), historyResource));
+                m_historyTextures.push_back(historyTexture.get());
             }
         }
 
@@ -907,6 +1033,25 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
             {
                 m_passResources.insert(std::make_pair(lastPass.m_shader.m_alias + "Feedback", feedbackResource));
             }
+            m_lastFeedback = feedbackTexture.get();
+        }
+
+        // resolve textures of each pass to indices into m_passViews, frames then don't look them up by name
+        // and rotating history only swaps views in place
+        std::map<std::string, int, std::less<>> resourceIndices;
+        for(const auto& r : m_passResources)
+        {
+            resourceIndices.insert(std::make_pair(r.first, (int)m_passViews.size()));
+            m_passViews.push_back(r.second.get());
+        }
+        for(int h = 0; h < m_requiresHistory; h++)
+        {
+            m_historyViews.push_back(resourceIndices.at(std::string("OriginalHistory") + std::to_string(h + 1)));
+        }
+        m_preprocessPass.BindResources(resourceIndices);
+        for(auto& shaderPass : m_shaderPasses)
+        {
+            shaderPass.BindResources(resourceIndices);
         }
     }
 
@@ -998,10 +1143,8 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
         m_context->ClearRenderTargetView(m_preprocessedRenderTarget.get(), background_colour);
     }
 
-    winrt::com_ptr<ID3D11ShaderResourceView> textureView;
-    hr = m_device->CreateShaderResourceView(texture.get(), nullptr, textureView.put());
-    assert(SUCCEEDED(hr));
-    m_preprocessPass.Render(textureView.get(), m_passResources, logicalFrameNo, 0, 0);
+    m_stateCache.ResetBindings();
+    m_preprocessPass.Render(InputView(texture.get()), m_passViews, logicalFrameNo, 0, 0);
 
     if(m_cursorEmulator.Hidden())
     {
@@ -1061,11 +1204,11 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
 
         if(p == 0)
         {
-            shaderPass.Render(m_originalView.get(), m_passResources, logicalFrameNo, passBoxX, passBoxY);
+            shaderPass.Render(m_originalView.get(), m_passViews, logicalFrameNo, passBoxX, passBoxY);
         }
         else
         {
-            shaderPass.Render(m_passResources, logicalFrameNo, passBoxX, passBoxY);
+            shaderPass.Render(m_passViews, logicalFrameNo, passBoxX, passBoxY);
         }
         p++;
     }
@@ -1073,27 +1216,17 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
     if(m_requiresFeedback)
     {
         // copy output to feedback
-        for(size_t q = 0; q < m_shaderPasses.size() - 1; q++)
+        for(const auto& fc : m_feedbackCopies)
         {
-            auto                           passOutput   = m_passResources.find(std::string("PassOutput") + std::to_string(q));
-            auto                           passFeedback = m_passResources.find(std::string("PassFeedback") + std::to_string(q));
-            winrt::com_ptr<ID3D11Resource> outputResource;
-            winrt::com_ptr<ID3D11Resource> feedbackResource;
-            passOutput->second->GetResource(outputResource.put());
-            passFeedback->second->GetResource(feedbackResource.put());
-            m_context->CopyResource(feedbackResource.get(), outputResource.get());
+            m_context->CopyResource(fc.second, fc.first);
         }
 
         // copy display texture as last pass feedback
         auto displayTexture = m_displayTexture;
         if(displayTexture)
         {
-            int                            p                = (int)m_shaderPasses.size() - 1;
-            const auto&                    lastPass         = m_shaderPasses[p];
-            auto                           lastPassFeedback = m_passResources.find(std::string("PassFeedback") + std::to_string(p));
-            winrt::com_ptr<ID3D11Resource> lastPassFeedbackResource;
-            lastPassFeedback->second->GetResource(lastPassFeedbackResource.put());
-            D3D11_TEXTURE2D_DESC desc3 = {};
+            const auto&          lastPass = m_shaderPasses[m_shaderPasses.size() - 1];
+            D3D11_TEXTURE2D_DESC desc3    = {};
             displayTexture->GetDesc(&desc3);
             if(m_boxX != 0 || m_boxY != 0 || lastPass.m_destWidth != desc3.Width || lastPass.m_destHeight != desc3.Height)
             {
@@ -1104,39 +1237,29 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, ULONGLONG fra
                 srcBox.bottom = srcBox.top + lastPass.m_destHeight;
                 srcBox.back   = 1;
                 srcBox.front  = 0;
-                m_context->CopySubresourceRegion(lastPassFeedbackResource.get(), 0, 0, 0, 0, displayTexture.get(), 0, &srcBox);
+                m_context->CopySubresourceRegion(m_lastFeedback, 0, 0, 0, 0, displayTexture.get(), 0, &srcBox);
             }
             else
             {
-                m_context->CopyResource(lastPassFeedbackResource.get(), displayTexture.get());
+                m_context->CopyResource(m_lastFeedback, displayTexture.get());
             }
         }
     }
 
     if(m_requiresHistory)
     {
-        // lookup oldest History for reuse
-        const auto&                    lastHistory     = m_passResources.find(std::string("OriginalHistory" + std::to_string(m_requiresHistory)));
-        auto                           lastHistoryView = lastHistory->second;
-        winrt::com_ptr<ID3D11Resource> lastHistoryResource;
-        lastHistoryView->GetResource(lastHistoryResource.put());
-
-        for(int h = m_requiresHistory; h > 1; h--)
+        // reuse the oldest History for current Original, remapping middle ones one frame back
+        auto oldestView    = m_passViews[m_historyViews.back()];
+        auto oldestTexture = m_historyTextures.back();
+        for(int h = m_requiresHistory - 1; h > 0; h--)
         {
-            // remap middle Histories one frame back
-            m_passResources[std::string("OriginalHistory" + std::to_string(h))] = m_passResources[std::string("OriginalHistory" + std::to_string(h - 1))];
+            m_passViews[m_historyViews[h]] = m_passViews[m_historyViews[h - 1]];
+            m_historyTextures[h]           = m_historyTextures[h - 1];
         }
+        m_passViews[m_historyViews[0]] = oldestView;
+        m_historyTextures[0]           = oldestTexture;
 
-        // copy current Original to History1 for next pass
-        const auto&                    original = m_passResources.find("Original");
-        winrt::com_ptr<ID3D11Resource> originalResource;
-        original->second->GetResource(originalResource.put());
-
-        m_context->CopyResource(lastHistoryResource.get(), originalResource.get());
-        if(m_requiresHistory > 1)
-        {
-            m_passResources["OriginalHistory1"] = lastHistoryView;
-        }
+        m_context->CopyResource(oldestTexture, m_preprocessedTexture.get());
     }
 
     PresentFrame();
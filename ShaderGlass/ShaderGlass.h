@@ -9,6 +9,7 @@ GNU General Public License v3.0
 
 #include "Preset.h"
 #include "ShaderPass.h"
+#include "ShaderSpecializer.h"
 #include "Shaders\PreprocessShaderDef.h"
 #include "Shaders\PassthroughShaderDef.h"
 #include "Shaders\PassthroughPresetDef.h"
@@ -34,6 +35,8 @@ public:
     void  SetOutputScale(float w, float h);
     void  SetOutputFlip(bool h, bool v);
     void  SetShaderPreset(PresetDef* p, const std::vector<std::tuple<int, std::string, double>>& params);
+    void  UpdatePresetDef(PresetDef* p, const std::function<void()>& update);
+    void  SetSpecializer(ShaderSpecializer* specializer);
     void  SetFrameSkip(int s);
     void  SetLockedArea(RECT area);
     void  SetCroppedArea(RECT area);
@@ -43,6 +46,15 @@ public:
     {
         return m_fps;
     }
+    // changes on anything that rebuilds or resizes passes, frames in between shouldn't allocate
+    unsigned Generation() const
+    {
+        return m_generation;
+    }
+    int RenderCount() const
+    {
+        return m_renderCounter;
+    }
     winrt::com_ptr<ID3D11Texture2D>            GrabOutput();
     std::vector<std::tuple<int, ShaderParam*>> Params();
     void                                       UpdateParams();
@@ -58,7 +70,11 @@ private:
     void DestroyPasses();
     void DestroyTargets();
     void RebuildShaders();
+    void SpecializeShaders();
+    void ApplyParams();
+    void ApplyDefaultParams();
     void PresentFrame();
+    ID3D11ShaderResourceView* InputView(ID3D11Texture2D* texture);
 
     POINT                                    m_lastSize;
     POINT                                    m_lastPos;
@@ -75,12 +91,22 @@ private:
     winrt::com_ptr<ID3D11Texture2D>          m_preprocessedTexture {nullptr};
     winrt::com_ptr<ID3D11RenderTargetView>   m_preprocessedRenderTarget {nullptr};
 
-    std::vector<winrt::com_ptr<ID3D11Texture2D>>                    m_passTextures;
-    std::vector<winrt::com_ptr<ID3D11RenderTargetView>>             m_passTargets;
-    std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>> m_passResources;
-    std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>> m_presetTextures;
-    std::map<std::string, float4>                                   m_textureSizes;
-    std::vector<ShaderPass>                                         m_shaderPasses;
+    std::vector<winrt::com_ptr<ID3D11Texture2D>>                                 m_passTextures;
+    std::vector<winrt::com_ptr<ID3D11RenderTargetView>>                          m_passTargets;
+    std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>, std::less<>> m_passResources;
+    std::vector<ID3D11ShaderResourceView*>                                       m_passViews;      // m_passResources in order, indexed by pass bindings
+    std::vector<std::pair<ID3D11Texture2D*, ID3D11Texture2D*>>                   m_feedbackCopies; // output and feedback texture of passes but last
+    ID3D11Texture2D*                                                             m_lastFeedback {nullptr};
+    std::vector<int>                                                             m_historyViews;   // m_passViews index of OriginalHistory1..n
+    std::vector<ID3D11Texture2D*>                                                m_historyTextures;
+    std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>, std::less<>> m_presetTextures;
+    std::map<std::string, float4>                                                m_textureSizes;
+    std::vector<std::array<UINT, 4>>                                             m_passSizes;
+    std::vector<ShaderPass>                                                      m_shaderPasses;
+
+    // views of capture surfaces, the frame pool cycles through a few so each gets its view once
+    std::array<std::pair<winrt::com_ptr<ID3D11Texture2D>, winrt::com_ptr<ID3D11ShaderResourceView>>, 4> m_inputViews;
+    unsigned                                                                                           m_nextInputView {0};
 
     POINT      m_monitorOffset {0, 0};
     HWND       m_outputWindow {0};
@@ -94,6 +120,7 @@ private:
     int        m_logicalFrameCounter {0};
     ULONGLONG  m_startTicks {0};
     int        m_renderCounter {0};
+    unsigned   m_generation {0};
     int        m_prevRenderCounter {0};
     ULONGLONG  m_prevRenderTicks {0};
     ULONGLONG  m_prevTicks {0};
@@ -108,6 +135,7 @@ private:
     int        m_boxY {0};
 
     CursorEmulator&                                   m_cursorEmulator;
+    StateCache                                        m_stateCache;
     PassthroughPresetDef                              m_passthroughDef;
     PreprocessShaderDef                               m_preprocessShaderDef;
     PresetDef                                         m_preprocessPresetDef;
@@ -117,6 +145,9 @@ private:
     std::unique_ptr<Preset>                           m_shaderPreset {nullptr};
     std::unique_ptr<Preset>                           m_newShaderPreset {nullptr};
     std::vector<std::tuple<int, std::string, double>> m_newParams;
+    ShaderSpecializer*                                m_specializer {nullptr};
+    unsigned                                          m_specializerGeneration {0};
+    std::atomic<bool>                                 m_specializeUpdated {false};
 
     volatile int   m_frameSkip {0};
     volatile bool  m_running {false};
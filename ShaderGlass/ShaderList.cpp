@@ -14,7 +14,10 @@ GNU General Public License v3.0
 
 #include "shaders\RetroArch.h"
 
-std::vector<PresetDef*> RetroArchPresetList = RetroArch::PresetList;
+std::span<const PresetInfo> RetroArchPresetList()
+{
+	return RetroArch::PresetList;
+}
 
 std::vector<CachedShader> RetroArchCachedShaders()
 {
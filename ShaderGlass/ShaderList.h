@@ -11,11 +11,12 @@ GNU General Public License v3.0
 #include "TextureDef.h"
 #include "PresetDef.h"
 #include "ShaderCache.h"
+#include "ShaderPack.h"
 
 #include "shaders\PassthroughShaderDef.h"
 #include "shaders\PreprocessShaderDef.h"
 
 #include "shaders\PassthroughPresetDef.h"
 
-extern std::vector<PresetDef*> RetroArchPresetList;
+extern std::span<const PresetInfo> RetroArchPresetList();
 extern std::vector<CachedShader> RetroArchCachedShaders();
\ No newline at end of file
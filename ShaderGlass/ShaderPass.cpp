@@ -12,54 +12,27 @@ GNU General Public License v3.0
 
 static HRESULT hr;
 
-ShaderPass::ShaderPass(Shader& shader, Preset& preset, bool preprocess) : m_shader {shader}, m_preset {preset}, m_preprocess {preprocess} { }
+ShaderPass::ShaderPass(Shader& shader, Preset& preset, StateCache& states, bool preprocess) :
+    m_shader {shader}, m_preset {preset}, m_states {states}, m_preprocess {preprocess}
+{ }
 
-ShaderPass::ShaderPass(Shader& shader, Preset& preset, winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context) : ShaderPass(shader, preset, false)
+ShaderPass::ShaderPass(Shader& shader, Preset& preset, StateCache& states, winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context) :
+    ShaderPass(shader, preset, states, false)
 {
     Initialize(device, context);
 }
 
-// clang-format off
-static float sVertexBuffer[] = 
-{
-    // Preprocess VB
-    -1.0f, -1.0f, 0.0f, 1.0f, 0.0f, 1.0f,
-    -1.0f, 1.0f,  0.0f, 1.0f, 0.0f, 0.0f,
-    1.0f,  -1.0f, 0.0f, 1.0f, 1.0f, 1.0f,
-    1.0f,  1.0f,  0.0f, 1.0f, 1.0f, 0.0f,
-    // Shader VB
-    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f,
-    0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f,
-    1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f,
-    1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f
-};
-// clang-format on
-
 void ShaderPass::Initialize(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context)
 {
     m_device  = device;
     m_context = context;
 
-    D3D11_INPUT_ELEMENT_DESC inputElementDesc[] = {{"TEXCOORD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
-                                                   {"TEXCOORD", 1, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0}};
-
-    hr = m_device->CreateInputLayout(inputElementDesc, ARRAYSIZE(inputElementDesc), m_shader.m_shaderDef.VertexByteCode, m_shader.m_shaderDef.VertexLength, m_inputLayout.put());
-    assert(SUCCEEDED(hr));
-    {
-        D3D11_BUFFER_DESC vertex_buff_descr = {};
-        vertex_buff_descr.ByteWidth         = sizeof(sVertexBuffer);
-        vertex_buff_descr.Usage             = D3D11_USAGE_DEFAULT;
-        vertex_buff_descr.BindFlags         = D3D11_BIND_VERTEX_BUFFER;
-        D3D11_SUBRESOURCE_DATA sr_data      = {0};
-        sr_data.pSysMem                     = sVertexBuffer;
-        hr                                  = m_device->CreateBuffer(&vertex_buff_descr, &sr_data, m_vertexBuffer.put());
-        assert(SUCCEEDED(hr));
-    }
+    m_inputLayout = m_states.InputLayout(m_shader.m_shaderDef.VertexByteCode, m_shader.m_shaderDef.VertexLength);
 
+    m_samplers.clear();
     for(const auto& texture : m_shader.m_shaderDef.Samplers)
     {
-        winrt::com_ptr<ID3D11SamplerState> samplerState;
-        D3D11_SAMPLER_DESC                 samplerDesc = {};
+        D3D11_SAMPLER_DESC samplerDesc = {};
 
         samplerDesc.Filter         = D3D11_FILTER_MIN_MAG_MIP_POINT;
         samplerDesc.AddressU       = D3D11_TEXTURE_ADDRESS_BORDER;
@@ -123,8 +96,7 @@ void ShaderPass::Initialize(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<
             }
         }
 
-        m_device->CreateSamplerState(&samplerDesc, samplerState.put());
-        m_samplers.insert(std::make_pair(texture.binding, samplerState));
+        m_samplers.insert(std::make_pair(texture.binding, m_states.SamplerState(samplerDesc)));
     }
 
     if(m_shader.BufferSize(0) > 0)
@@ -159,6 +131,35 @@ void ShaderPass::Initialize(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<
         m_pushBuffer = nullptr;
     }
 
+    // versions of Shader's copies last uploaded, 0 is never
+    m_uboVersion  = 0;
+    m_pushVersion = 0;
+
+    // resolve parameters set by the pass here so Resize and Render don't look them up by name
+    m_frameCountParam = m_shader.FindParam("FrameCount");
+    m_mvpParam        = m_shader.FindParam("MVP");
+    m_sourceSizeParam = m_shader.FindParam("SourceSize");
+    m_outputSizeParam = m_shader.FindParam("OutputSize");
+    m_textureSizeParams.clear();
+    m_passSizeParams.clear();
+    for(auto& p : m_shader.m_shaderDef.Params)
+    {
+        if(!p.name.ends_with("Size") || p.name == "SourceSize" || p.name == "OutputSize")
+            continue;
+        auto handle = m_shader.FindParam(p.name);
+        if(handle.params[0] != &p)
+            continue; // already added from the other buffer
+        if(p.name.starts_with("PassOutputSize"))
+        {
+            auto passNo = atoi(std::string(p.name.substr(14)).c_str());
+            m_passSizeParams.emplace_back(passNo, handle);
+        }
+        else
+        {
+            m_textureSizeParams.emplace_back(p.name.substr(0, p.name.size() - 4), handle);
+        }
+    }
+
     // create MVP
     memset(&m_modelViewProj, 0, 16 * sizeof(float));
     m_modelViewProj.m[0][0] = 2.0f;
@@ -197,8 +198,7 @@ void ShaderPass::Initialize(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<
         omDesc.RenderTarget[0].BlendOpAlpha          = D3D11_BLEND_OP_ADD;
         omDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
 
-        hr = device->CreateBlendState(&omDesc, m_blendState.put());
-        assert(SUCCEEDED(hr));
+        m_blendState = m_states.BlendState(omDesc);
     }
 }
 
@@ -214,7 +214,6 @@ void ShaderPass::UpdateMVP(float sx, float sy, float tx, float ty)
 ShaderPass::~ShaderPass()
 {
     m_inputLayout    = nullptr;
-    m_vertexBuffer   = nullptr;
     m_constantBuffer = nullptr;
     m_pushBuffer     = nullptr;
     m_samplers.clear();
@@ -234,82 +233,62 @@ void ShaderPass::Resize(
     params_OutputSize[1] = static_cast<float>(destHeight);
     params_OutputSize[2] = 1.0f / destWidth;
     params_OutputSize[3] = 1.0f / destHeight;
-    m_shader.SetParam("SourceSize", params_SourceSize);
-    m_shader.SetParam("OutputSize", params_OutputSize);
+    m_shader.SetParam(m_sourceSizeParam, params_SourceSize);
+    m_shader.SetParam(m_outputSizeParam, params_OutputSize);
 
-    for(const auto& tx : textureSizes)
+    for(const auto& tx : m_textureSizeParams)
     {
-        auto sizeParam = tx.first + "Size";
-        m_shader.SetParam(sizeParam, (void*)&tx.second);
+        auto size = textureSizes.find(tx.first);
+        if(size != textureSizes.end())
+            m_shader.SetParam(tx.second, (void*)&size->second);
     }
-    for(auto p = 0; p < passSizes.size(); p++)
+    for(const auto& ps : m_passSizeParams)
     {
-        const auto& passSize = passSizes.at(p);
+        if(ps.first < 0 || ps.first >= passSizes.size())
+            continue;
+        const auto& passSize = passSizes.at(ps.first);
         if(passSize[2] != 0 && passSize[3] != 0)
         {
-            auto  sizeParam    = "PassOutputSize" + std::to_string(p);
             float passSizeF[4] = {(float)passSize[2], (float)passSize[3], 1.0f / passSize[2], 1.0f / passSize[3]};
-            m_shader.SetParam(sizeParam, passSizeF);
+            m_shader.SetParam(ps.second, passSizeF);
         }
     }
 }
 
-void ShaderPass::Render(std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>>& resources, int frameNo, int boxX, int boxY)
-{
-    Render(m_sourceView, resources, frameNo, boxX, boxY);
-}
-
-void ShaderPass::Render(ID3D11ShaderResourceView* sourceView, std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>>& resources, int frameNo, int boxX, int boxY)
+// buffers are dynamic so they keep their contents between frames, only re-upload those that changed
+// (passes sharing a Shader, like preprocess, each track what they've uploaded)
+void ShaderPass::UploadParams()
 {
-    params_FrameCount = frameNo;
-    if(m_shader.m_frameCountMod > 0)
-    {
-        while(params_FrameCount >= m_shader.m_frameCountMod)
-            params_FrameCount -= m_shader.m_frameCountMod;
-    }
-
-    m_shader.SetParam("FrameCount", &params_FrameCount);
-    m_shader.SetParam("MVP", &m_modelViewProj);
-
-    if(m_constantBuffer != nullptr)
+    auto uboVersion = m_shader.BufferVersion(UBO_BUFFER);
+    if(m_constantBuffer != nullptr && m_uboVersion != uboVersion)
     {
         D3D11_MAPPED_SUBRESOURCE mappedSubresource;
         m_context->Map(m_constantBuffer.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource);
-        m_shader.FillParams(0, (char*)mappedSubresource.pData);
+        m_shader.FillParams(UBO_BUFFER, (char*)mappedSubresource.pData);
         m_context->Unmap(m_constantBuffer.get(), 0);
+        m_uboVersion = uboVersion;
     }
 
-    if(m_pushBuffer != nullptr)
+    auto pushVersion = m_shader.BufferVersion(PUSH_BUFFER);
+    if(m_pushBuffer != nullptr && m_pushVersion != pushVersion)
     {
         D3D11_MAPPED_SUBRESOURCE mappedSubresource;
         m_context->Map(m_pushBuffer.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource);
-        m_shader.FillParams(-1, (char*)mappedSubresource.pData);
+        m_shader.FillParams(PUSH_BUFFER, (char*)mappedSubresource.pData);
         m_context->Unmap(m_pushBuffer.get(), 0);
+        m_pushVersion = pushVersion;
     }
+}
 
-    D3D11_VIEWPORT viewport = {static_cast<float>(boxX), static_cast<float>(boxY), static_cast<float>(m_destWidth), static_cast<float>(m_destHeight), 0.0f, 1.0f};
-    m_context->RSSetViewports(1, &viewport);
-
-    ID3D11RenderTargetView* targets[1] = {m_targetView};
-    m_context->OMSetRenderTargets(1, targets, NULL);
-
-    m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
-    m_context->IASetInputLayout(m_inputLayout.get());
-    ID3D11Buffer* vertexBuffer[1] = {m_vertexBuffer.get()};
-    m_context->IASetVertexBuffers(0, 1, vertexBuffer, &s_vertexStride, &s_vertexOffset);
-
-    m_context->VSSetShader(m_shader.m_vertexShader.get(), NULL, 0);
-    m_context->PSSetShader(m_shader.m_pixelShader.get(), NULL, 0);
-
-    std::vector<int> bindings;
+void ShaderPass::BindResources(const std::map<std::string, int, std::less<>>& resources)
+{
+    m_bindings.clear();
     for(const auto& texture : m_shader.m_shaderDef.Samplers)
     {
-        auto& sampler = m_samplers.at(texture.binding);
+        PassBinding binding {static_cast<UINT>(texture.binding), PassBinding::Unbound, m_samplers.at(texture.binding)};
         if(texture.name == "Source")
         {
-            ID3D11ShaderResourceView* localResources[1] = {sourceView};
-            m_context->PSSetShaderResources(texture.binding, 1, localResources);
-            bindings.push_back(texture.binding);
+            binding.resource = PassBinding::Source;
         }
         else
         {
@@ -320,20 +299,58 @@ void ShaderPass::Render(ID3D11ShaderResourceView* sourceView, std::map<std::stri
             }
             if(it != resources.end())
             {
-                ID3D11ShaderResourceView* localResources[1] = {it->second.get()};
-                m_context->PSSetShaderResources(texture.binding, 1, localResources);
-                bindings.push_back(texture.binding);
+                binding.resource = it->second;
             }
             else
             {
 #ifdef _DEBUG
-                OutputDebugStringW(convertCharArrayToLPCWSTR(texture.name.c_str()));
+                OutputDebugStringW(convertCharArrayToLPCWSTR(std::string(texture.name).c_str()));
                 OutputDebugStringW(L"\n");
 #endif
             }
         }
-        ID3D11SamplerState* samplers[1] = {sampler.get()};
-        m_context->PSSetSamplers(texture.binding, 1, samplers);
+        m_bindings.push_back(binding);
+    }
+}
+
+void ShaderPass::Render(const std::vector<ID3D11ShaderResourceView*>& views, int frameNo, int boxX, int boxY)
+{
+    Render(m_sourceView, views, frameNo, boxX, boxY);
+}
+
+void ShaderPass::Render(ID3D11ShaderResourceView* sourceView, const std::vector<ID3D11ShaderResourceView*>& views, int frameNo, int boxX, int boxY)
+{
+    params_FrameCount = frameNo;
+    if(m_shader.m_frameCountMod > 0)
+    {
+        while(params_FrameCount >= m_shader.m_frameCountMod)
+            params_FrameCount -= m_shader.m_frameCountMod;
+    }
+
+    m_shader.SetParam(m_frameCountParam, &params_FrameCount);
+    m_shader.SetParam(m_mvpParam, &m_modelViewProj);
+
+    UploadParams();
+
+    D3D11_VIEWPORT viewport = {static_cast<float>(boxX), static_cast<float>(boxY), static_cast<float>(m_destWidth), static_cast<float>(m_destHeight), 0.0f, 1.0f};
+    m_context->RSSetViewports(1, &viewport);
+
+    ID3D11RenderTargetView* targets[1] = {m_targetView};
+    m_context->OMSetRenderTargets(1, targets, NULL);
+
+    m_states.BindInput(m_context.get(), m_inputLayout);
+
+    m_context->VSSetShader(m_shader.m_vertexShader.get(), NULL, 0);
+    m_context->PSSetShader(m_shader.PixelShader(), NULL, 0);
+
+    for(const auto& b : m_bindings)
+    {
+        if(b.resource != PassBinding::Unbound)
+        {
+            ID3D11ShaderResourceView* localResources[1] = {b.resource == PassBinding::Source ? sourceView : views[b.resource]};
+            m_context->PSSetShaderResources(b.binding, 1, localResources);
+        }
+        m_states.BindSampler(m_context.get(), b.binding, b.sampler);
     }
 
     if(m_constantBuffer != nullptr)
@@ -359,10 +376,12 @@ void ShaderPass::Render(ID3D11ShaderResourceView* sourceView, std::map<std::stri
     }
 
     // unbind to allow rebinding as input/output
-    for(auto& b : bindings)
+    for(const auto& b : m_bindings)
     {
+        if(b.resource == PassBinding::Unbound)
+            continue;
         ID3D11ShaderResourceView* null[] = {nullptr};
-        m_context->PSSetShaderResources(b, 1, null);
+        m_context->PSSetShaderResources(b.binding, 1, null);
     }
     ID3D11RenderTargetView* null[] = {nullptr};
     m_context->OMSetRenderTargets(1, null, NULL);
@@ -376,19 +395,13 @@ void ShaderPass::RenderCursor(float x, float y, float w, float h, winrt::com_ptr
     D3D11_VIEWPORT viewport = {static_cast<float>(x), static_cast<float>(y), w, h, 0.0f, 1.0f};
     m_context->RSSetViewports(1, &viewport);
 
-    m_shader.SetParam("MVP", &m_cursorMVP);
-    if(m_constantBuffer != nullptr)
-    {
-        D3D11_MAPPED_SUBRESOURCE mappedSubresource;
-        m_context->Map(m_constantBuffer.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource);
-        m_shader.FillParams(0, (char*)mappedSubresource.pData);
-        m_context->Unmap(m_constantBuffer.get(), 0);
-    }
+    m_shader.SetParam(m_mvpParam, &m_cursorMVP);
+    UploadParams();
 
     ID3D11RenderTargetView*   targets[1]        = {m_targetView};
     ID3D11ShaderResourceView* localResources[1] = {cursorView.get()};
     m_context->PSSetShaderResources(m_sourceBinding, 1, localResources);
-    m_context->OMSetBlendState(m_blendState.get(), NULL, 0xffffffff);
+    m_context->OMSetBlendState(m_blendState, NULL, 0xffffffff);
     m_context->OMSetRenderTargets(1, targets, NULL);
     m_context->Draw(s_vertexCount, 4);
 
@@ -420,7 +433,7 @@ int ShaderPass::RequiresHistory() const
         {
             try
             {
-                auto historyString = texture.name.substr(15);
+                auto historyString = std::string(texture.name.substr(15));
                 auto historyNum    = std::stoi(historyString);
                 if(historyNum > 0 && historyNum < 100)
                 {
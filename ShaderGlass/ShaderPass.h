@@ -9,19 +9,32 @@ GNU General Public License v3.0
 
 #include "Shader.h"
 #include "Preset.h"
+#include "StateCache.h"
 
 #pragma once
 
+// texture slot of a pass resolved when passes are rebuilt, so rendering only indexes arrays
+struct PassBinding
+{
+    static constexpr int Source  = -1; // the view passed to Render
+    static constexpr int Unbound = -2; // nothing by that name, only the sampler is set
+
+    UINT                binding;
+    int                 resource; // index into the views passed to Render
+    ID3D11SamplerState* sampler;
+};
+
 class ShaderPass
 {
 public:
-    ShaderPass(Shader& shader, Preset& preset, bool preprocess);
-    ShaderPass(Shader& shader, Preset& preset, winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context);
+    ShaderPass(Shader& shader, Preset& preset, StateCache& states, bool preprocess);
+    ShaderPass(Shader& shader, Preset& preset, StateCache& states, winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context);
     ~ShaderPass();
 
     void Initialize(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context);
-    void Render(std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>>& resources, int frameCount, int boxX, int boxY);
-    void Render(ID3D11ShaderResourceView* sourceView, std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>>& resources, int frameCount, int boxX, int boxY);
+    void BindResources(const std::map<std::string, int, std::less<>>& resources);
+    void Render(const std::vector<ID3D11ShaderResourceView*>& views, int frameCount, int boxX, int boxY);
+    void Render(ID3D11ShaderResourceView* sourceView, const std::vector<ID3D11ShaderResourceView*>& views, int frameCount, int boxX, int boxY);
     void RenderCursor(float x, float y, float w, float h, winrt::com_ptr<ID3D11ShaderResourceView> cursorView);
     void
     Resize(int sourceWidth, int sourceHeight, int destWidth, int destHeight, const std::map<std::string, float4>& textureSizes, const std::vector<std::array<UINT, 4>>& passSizes);
@@ -37,22 +50,31 @@ public:
     int                       m_destHeight {0};
 
 private:
+    void UploadParams();
+
     float4x4                                          m_modelViewProj {};
+    StateCache&                                       m_states;
     winrt::com_ptr<ID3D11Device>                      m_device {nullptr};
     winrt::com_ptr<ID3D11DeviceContext>               m_context {nullptr};
-    winrt::com_ptr<ID3D11InputLayout>                 m_inputLayout {nullptr};
-    winrt::com_ptr<ID3D11Buffer>                      m_vertexBuffer {nullptr};
+    ID3D11InputLayout*                                m_inputLayout {nullptr};
     winrt::com_ptr<ID3D11Buffer>                      m_constantBuffer {nullptr};
     winrt::com_ptr<ID3D11Buffer>                      m_pushBuffer {nullptr};
-    std::map<int, winrt::com_ptr<ID3D11SamplerState>> m_samplers;
+    std::map<int, ID3D11SamplerState*>                m_samplers;
+    std::vector<PassBinding>                          m_bindings;
     bool                                              m_preprocess {false};
-    const UINT                                        s_vertexStride {6 * sizeof(float)};
-    const UINT                                        s_vertexOffset {0};
     const UINT                                        s_vertexCount {4};
     float                                             params_SourceSize[4] {0, 0, 0, 0};
     float                                             params_OutputSize[4] {0, 0, 0, 0};
     int                                               params_FrameCount {0};
-    winrt::com_ptr<ID3D11BlendState>                  m_blendState;
+    ID3D11BlendState*                                 m_blendState {nullptr};
     int                                               m_sourceBinding {-1};
     float4x4                                          m_cursorMVP {};
+    ParamHandle                                       m_frameCountParam;
+    ParamHandle                                       m_mvpParam;
+    ParamHandle                                       m_sourceSizeParam;
+    ParamHandle                                       m_outputSizeParam;
+    std::vector<std::pair<std::string, ParamHandle>>  m_textureSizeParams;
+    std::vector<std::pair<int, ParamHandle>>          m_passSizeParams;
+    uint32_t                                          m_uboVersion {0};
+    uint32_t                                          m_pushVersion {0};
 };
@@ -0,0 +1,127 @@
+/*
+ShaderGlass: shader effect overlay
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "ShaderSpecializer.h"
+#include "HLSL.h"
+#include "ShaderGC.h"
+
+ShaderSpecializer::ShaderSpecializer(const ShaderCache& cache) : m_cache {cache}
+{
+    m_thread = std::thread(&ShaderSpecializer::ThreadFunc, this);
+}
+
+ShaderSpecializer::~ShaderSpecializer()
+{
+    {
+        std::unique_lock lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    m_thread.join();
+}
+
+std::string ShaderSpecializer::Key(const std::string& sourceHash, const std::vector<const ShaderParam*>& frozen)
+{
+    std::ostringstream input;
+    input << "specialized " << sourceHash << std::endl;
+    for(const auto p : frozen)
+    {
+        uint32_t bits;
+        memcpy(&bits, &p->currentValue, sizeof(bits));
+        input << p->name << "=" << bits << std::endl;
+    }
+    return DiskCache::Key(input.str(), true);
+}
+
+std::shared_ptr<const std::vector<uint8_t>> ShaderSpecializer::Get(const std::string&                                 key,
+                                                                   const std::vector<const ShaderParam*>&             frozen,
+                                                                   const std::shared_ptr<const std::string>&          source,
+                                                                   const std::shared_ptr<const std::vector<uint8_t>>& generic)
+{
+    {
+        std::unique_lock lock(m_mutex);
+        auto             it = m_variants.find(key);
+        if(it != m_variants.end())
+            return it->second;
+
+        // placeholder until compiled
+        m_variants.emplace(key, nullptr);
+    }
+
+    // the worker gets its own copy of the frozen values, source and bytecode are shared
+    Request request {key, {}, source, generic};
+    request.frozen.reserve(frozen.size());
+    for(const auto p : frozen)
+        request.frozen.push_back(*p);
+
+    {
+        std::unique_lock lock(m_mutex);
+        m_queue.push_back(std::move(request));
+    }
+    m_wake.notify_one();
+    return nullptr;
+}
+
+void ShaderSpecializer::ThreadFunc()
+{
+    while(true)
+    {
+        Request request;
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if(m_stop)
+                return;
+            request = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        const auto& key = request.key;
+
+        CompiledShaderStage stage;
+        if(!m_cache.m_diskCache || !m_cache.m_diskCache->Load(key, stage))
+        {
+            try
+            {
+                std::vector<const ShaderParam*> frozen;
+                for(const auto& p : request.frozen)
+                    frozen.push_back(&p);
+                auto hlsl = ShaderGC::SpecializeHLSL(*request.source, frozen);
+
+                std::ostringstream log;
+                bool               warn = false;
+                stage.byteCode          = HLSL::CompileHLSL(hlsl.c_str(), hlsl.size(), "ps_5_0", true, true, log, warn);
+                stage.hlsl              = std::move(hlsl);
+                if(m_cache.m_diskCache)
+                    m_cache.m_diskCache->Store(key, stage);
+            }
+            catch(std::exception& ex)
+            {
+                // generic shader stays in use
+                OutputDebugStringA(ex.what());
+            }
+        }
+
+        if(stage.byteCode.size())
+        {
+            char message[100];
+            snprintf(message,
+                     sizeof(message),
+                     "specialized %.8s: %u -> %u instructions\n",
+                     key.c_str(),
+                     request.generic ? HLSL::InstructionCount(*request.generic) : 0,
+                     HLSL::InstructionCount(stage.byteCode));
+            OutputDebugStringA(message);
+
+            std::unique_lock lock(m_mutex);
+            m_variants[key] = std::make_shared<const std::vector<uint8_t>>(std::move(stage.byteCode));
+        }
+        m_generation++;
+    }
+}
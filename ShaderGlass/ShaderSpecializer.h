@@ -0,0 +1,60 @@
+/*
+ShaderGlass: shader effect overlay
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include "ShaderCache.h"
+#include "ShaderDef.h"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+// compiles fragment stages with frozen parameters baked in on a background thread;
+// variants are keyed by source and parameter values and kept for the whole session
+// (and in the disk cache when available)
+class ShaderSpecializer
+{
+public:
+    ShaderSpecializer(const ShaderCache& cache);
+    ~ShaderSpecializer();
+
+    static std::string Key(const std::string& sourceHash, const std::vector<const ShaderParam*>& frozen);
+
+    // compiled variant, or nullptr while it's compiling (queued on first request) or if it failed;
+    // the source is specialized on the worker, the generic stage is only used to log how many instructions the variant saves
+    std::shared_ptr<const std::vector<uint8_t>> Get(const std::string&                                 key,
+                                                    const std::vector<const ShaderParam*>&             frozen,
+                                                    const std::shared_ptr<const std::string>&          source,
+                                                    const std::shared_ptr<const std::vector<uint8_t>>& generic);
+
+    // changes whenever a variant finishes compiling
+    unsigned Generation() const
+    {
+        return m_generation;
+    }
+
+private:
+    struct Request
+    {
+        std::string                                 key;
+        std::vector<ShaderParam>                    frozen;
+        std::shared_ptr<const std::string>          source;
+        std::shared_ptr<const std::vector<uint8_t>> generic;
+    };
+
+    void ThreadFunc();
+
+    const ShaderCache&                                                            m_cache;
+    std::mutex                                                                    m_mutex;
+    std::condition_variable                                                       m_wake;
+    std::deque<Request>                                                           m_queue;
+    std::unordered_map<std::string, std::shared_ptr<const std::vector<uint8_t>>> m_variants;
+    std::atomic<unsigned>                                                         m_generation {0};
+    bool                                                                          m_stop {false};
+    std::thread                                                                   m_thread;
+};
@@ -13,6 +13,9 @@ GNU General Public License v3.0
 #include "CursorEmulator.h"
 
 #include "Shlobj.h"
+#include <psapi.h>
+
+#pragma comment(lib, "psapi.lib")
 
 #define TIMER_TITLE 0
 
@@ -265,7 +268,7 @@ bool ShaderWindow::LoadProfile(const std::wstring& fileName)
             const auto& presets = m_captureManager.Presets();
             for(unsigned i = 0; i < presets.size(); i++)
             {
-                if(presets.at(i)->Category == shaderCategory && presets.at(i)->Name == shaderName)
+                if(presets.at(i).Category() == shaderCategory && presets.at(i).Name() == shaderName)
                 {
                     SendMessage(m_mainWindow, WM_COMMAND, WM_SHADER(i), 0);
                     break;
@@ -514,16 +517,16 @@ void ShaderWindow::SaveProfile(const std::wstring& fileName)
         outfile << "AspectRatio " << std::quoted(std::to_string(aspectRatio.r)) << std::endl;
     else
         outfile << "AspectRatio " << std::quoted(aspectRatio.mnemonic) << std::endl;
-    if(shader->Category == "Imported")
+    if(shader.Category() == "Imported")
     {
         char utfName[MAX_PATH * 4];
-        WideCharToMultiByte(CP_UTF8, 0, shader->ImportPath.c_str(), -1, utfName, MAX_PATH * 4, NULL, NULL);
+        WideCharToMultiByte(CP_UTF8, 0, shader.Get()->ImportPath.c_str(), -1, utfName, MAX_PATH * 4, NULL, NULL);
         outfile << "ShaderPath " << std::quoted(utfName) << std::endl;
     }
     else
     {
-        outfile << "ShaderCategory " << std::quoted(shader->Category) << std::endl;
-        outfile << "ShaderName " << std::quoted(shader->Name) << std::endl;
+        outfile << "ShaderCategory " << std::quoted(shader.Category()) << std::endl;
+        outfile << "ShaderName " << std::quoted(shader.Name()) << std::endl;
     }
     outfile << "FrameSkip " << std::quoted(frameSkip.mnemonic) << std::endl;
     outfile << "OutputScale " << std::quoted(m_captureOptions.freeScale ? "Free" : outputScale.mnemonic) << std::endl;
@@ -622,16 +625,23 @@ void ShaderWindow::CompileThreadFunc()
 
         if(m_importPath.empty())
             continue;
-
-        std::string errorMsg;
+        m_cancelOptimize = false;
+
+        // preview build is shown first and optimised afterwards
+        std::vector<TieredShaderStage> tiered;
+        std::unique_ptr<CompileTrace>  trace(m_tracePath.empty() ? nullptr : new CompileTrace());
+        const auto                     importPath = m_importPath;
+        PresetDef*                     preset     = nullptr;
+        int                            id     = -1;
+        std::string                    errorMsg;
         try
         {
             std::ofstream log;
             bool          warn;
-            auto          preset = ShaderGC::CompilePreset(m_importPath, log, warn, cache);
+            preset = ShaderGC::CompilePreset(m_importPath, log, warn, cache, 0, &tiered, trace.get());
             if(preset == nullptr)
                 throw std::runtime_error("Internal error");
-            auto id      = m_captureManager.AddPreset(preset);
+            id           = m_captureManager.AddPreset(preset);
             m_numPresets = (unsigned int)m_captureManager.Presets().size();
             SendMessage(m_browserWindow, WM_COMMAND, WM_USER + 1, id);
             SendMessage(m_mainWindow, WM_COMMAND, WM_SHADER(id), 0);
@@ -652,6 +662,39 @@ void ShaderWindow::CompileThreadFunc()
         {
             MessageBox(m_mainWindow, convertCharArrayToLPCWSTR(errorMsg.c_str()), L"ShaderGlass", MB_OK);
         }
+        else if(tiered.size())
+        {
+            // another import cancels this, completed stages are still swapped in
+            std::ostringstream report;
+            bool               warn = false;
+            ShaderGC::OptimizeStages(tiered, report, warn, cache, 0, m_cancelOptimize, trace.get());
+            m_captureManager.UpdatePreset(id, preset, [&](PresetDef& def) { ShaderGC::ApplyStages(def, tiered); });
+            OutputDebugStringA(report.str().c_str());
+        }
+
+        if(trace)
+        {
+            // .json gets a Chrome trace of the last import, anything else collects JSON lines
+            if(m_tracePath.extension() == L".json")
+            {
+                std::ofstream out(m_tracePath, std::ios::trunc);
+                trace->WriteChromeTrace(out);
+            }
+            else
+            {
+                std::string label;
+                try
+                {
+                    label = importPath.string();
+                }
+                catch(...)
+                {
+                    label = "???"; // unicode...
+                }
+                std::ofstream out(m_tracePath, std::ios::app);
+                trace->WriteJsonLines(out, label);
+            }
+        }
     }
 }
 
@@ -693,6 +736,7 @@ bool ShaderWindow::ImportShader(const std::wstring& fileName)
         }
         if(m_compileEvent)
         {
+            m_cancelOptimize = true;
             SetEvent(m_compileEvent);
         }
         return true;
@@ -1283,7 +1327,7 @@ void ShaderWindow::UpdateTitle()
                      200,
                      _T("ShaderGlass (%s%S, %Spx, %S%%, ~%S, %S%dfps%S)"),
                      windowName,
-                     shader->Name.c_str(),
+                     shader.Name().data(),
                      pixelSize.mnemonic,
                      scaleString,
                      aspectRatio.mnemonic,
@@ -1404,6 +1448,21 @@ LRESULT CALLBACK ShaderWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam, L
                 SaveHotkeyState(true);
             }
             break;
+        case ID_SHADER_SPECIALIZEPARAMETERS:
+            if(GetMenuState(m_shaderMenu, ID_SHADER_SPECIALIZEPARAMETERS, MF_BYCOMMAND) & MF_CHECKED)
+            {
+                CheckMenuItem(m_shaderMenu, ID_SHADER_SPECIALIZEPARAMETERS, MF_UNCHECKED);
+                SaveSpecializeParamsState(false);
+                m_captureOptions.specializeParams = false;
+            }
+            else
+            {
+                CheckMenuItem(m_shaderMenu, ID_SHADER_SPECIALIZEPARAMETERS, MF_CHECKED);
+                SaveSpecializeParamsState(true);
+                m_captureOptions.specializeParams = true;
+            }
+            m_captureManager.UpdateSpecialization();
+            break;
         case ID_PROCESSING_REMEMBERPOSITION:
             if(GetMenuState(m_programMenu, ID_PROCESSING_REMEMBERPOSITION, MF_BYCOMMAND) & MF_CHECKED)
             {
@@ -2374,6 +2433,11 @@ bool ShaderWindow::Create(_In_ HINSTANCE hInstance, _In_ int nCmdShow)
         CheckMenuItem(m_advancedMenu, ID_ADVANCED_ALLOWTEARING, MF_BYCOMMAND | MF_CHECKED);
         m_captureOptions.allowTearing = true;
     }
+    if(GetSpecializeParamsState())
+    {
+        CheckMenuItem(m_shaderMenu, ID_SHADER_SPECIALIZEPARAMETERS, MF_BYCOMMAND | MF_CHECKED);
+        m_captureOptions.specializeParams = true;
+    }
     if(GetStartingPositionState())
     {
         CheckMenuItem(m_programMenu, ID_PROCESSING_REMEMBERPOSITION, MF_BYCOMMAND | MF_CHECKED);
@@ -2521,6 +2585,16 @@ bool ShaderWindow::GetTearingState()
     return GetRegistryOption(TEXT("Allow Tearing"), false);
 }
 
+void ShaderWindow::SaveSpecializeParamsState(bool state)
+{
+    SaveRegistryOption(TEXT("Specialize Parameters"), state);
+}
+
+bool ShaderWindow::GetSpecializeParamsState()
+{
+    return GetRegistryOption(TEXT("Specialize Parameters"), false);
+}
+
 void ShaderWindow::SaveMaxCaptureRateState(bool state)
 {
     SaveRegistryOption(TEXT("Max Capture Rate"), state);
@@ -2884,6 +2958,37 @@ void ShaderWindow::UnregisterHotkeys()
     }
 }
 
+// time from process creation to the windows being ready, so static initialisation is included,
+// and memory resident at that point; written to the -trace file like imports
+void ShaderWindow::TraceStartup()
+{
+    FILETIME creation, exit, kernel, user, now;
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+    GetSystemTimeAsFileTime(&now);
+    const auto ticks = [](const FILETIME& ft) { return ((ULONGLONG)ft.dwHighDateTime << 32) | ft.dwLowDateTime; };
+    const auto since = std::chrono::microseconds((ticks(now) - ticks(creation)) / 10);
+
+    PROCESS_MEMORY_COUNTERS_EX pmc {};
+    GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc));
+
+    CompileTrace trace;
+    trace.Add("startup", -1, -1, std::chrono::steady_clock::now() - since);
+    trace.Count("presets", (unsigned)m_captureManager.Presets().size());
+    trace.Count("working-set-kb", (unsigned)(pmc.WorkingSetSize / 1024));
+    trace.Count("private-kb", (unsigned)(pmc.PrivateUsage / 1024));
+
+    if(m_tracePath.extension() == L".json")
+    {
+        std::ofstream out(m_tracePath, std::ios::trunc);
+        trace.WriteChromeTrace(out);
+    }
+    else
+    {
+        std::ofstream out(m_tracePath, std::ios::app);
+        trace.WriteJsonLines(out, "startup");
+    }
+}
+
 void ShaderWindow::Start(_In_ LPWSTR lpCmdLine, HWND paramsWindow, HWND browserWindow, HWND compileWindow)
 {
     bool autoStart  = true;
@@ -2901,6 +3006,12 @@ void ShaderWindow::Start(_In_ LPWSTR lpCmdLine, HWND paramsWindow, HWND browserW
                 autoStart = false;
             else if(wcscmp(args[a], L"-fullscreen") == 0 || wcscmp(args[a], L"-f") == 0)
                 fullScreen = true;
+            else if(wcscmp(args[a], L"-trace") == 0 && a < numArgs - 1)
+                m_tracePath = args[++a];
+#ifdef ALLOCATION_CHECK
+            else if(wcscmp(args[a], L"-allocs") == 0 && a < numArgs - 1)
+                m_captureOptions.allocationCheck = _wtoi(args[++a]);
+#endif
             else if(a == numArgs - 1)
             {
                 std::wstring ws(args[a]);
@@ -2917,6 +3028,9 @@ void ShaderWindow::Start(_In_ LPWSTR lpCmdLine, HWND paramsWindow, HWND browserW
     m_cropDialog.reset(new CropDialog(m_instance, m_mainWindow));
     m_hotkeyDialog.reset(new HotkeyDialog(m_instance, m_mainWindow));
 
+    if(!m_tracePath.empty())
+        TraceStartup();
+
     if(autoStart && HasCaptureAPI())
     {
         SendMessage(m_mainWindow, WM_COMMAND, IDM_START, 0);
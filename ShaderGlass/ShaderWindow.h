@@ -75,6 +75,7 @@ private:
     bool                          m_inDialog {false};
     HANDLE                        m_compileThread {nullptr};
     HANDLE                        m_compileEvent {nullptr};
+    std::atomic<bool>             m_cancelOptimize {false};
     float                         m_dpiScale {1.0f};
     RECT                          m_lastPosition;
     std::unique_ptr<InputDialog>  m_inputDialog;
@@ -86,6 +87,7 @@ private:
     std::vector<std::wstring>     m_recentImports;
     std::map<UINT, HotkeyInfo>    m_hotkeys;
     std::filesystem::path         m_importPath;
+    std::filesystem::path         m_tracePath;
 
     bool         LoadProfile(const std::wstring& fileName);
     void         LoadProfile();
@@ -93,6 +95,7 @@ private:
     void         SaveProfile();
     void         ImportShader();
     bool         ImportShader(const std::wstring& fileName);
+    void         TraceStartup();
     void         ScanWindows();
     void         ScanDisplays();
     void         ScanDevices();
@@ -125,6 +128,8 @@ private:
     bool         GetFlipModeState();
     void         SaveTearingState(bool state);
     bool         GetTearingState();
+    void         SaveSpecializeParamsState(bool state);
+    bool         GetSpecializeParamsState();
     void         SaveMaxCaptureRateState(bool state);
     bool         GetMaxCaptureRateState();
     void         SaveUseHDRState(bool state);
@@ -3239,2080 +3239,2080 @@
 
 namespace RetroArch
 {
-const static std::vector<PresetDef*> PresetList = {
-new AnamorphicAnamorphicPresetDef(),
-new AntiAliasingAaShader40Level2PresetDef(),
-new AntiAliasingAaShader40PresetDef(),
-new AntiAliasingAdvancedAaPresetDef(),
-new AntiAliasingFxaaLinearPresetDef(),
-new AntiAliasingFxaaPresetDef(),
-new AntiAliasingReverseAaPresetDef(),
-new AntiAliasingSmaaLinearPresetDef(),
-new AntiAliasingSmaaSharpenPresetDef(),
-new AntiAliasingSmaaPresetDef(),
-new BezelKokoAioKokoAioNgPresetDef(),
-new BezelKokoAioPresetsNgBasePresetDef(),
-new BezelKokoAioPresetsNgMonitorAmbilightImmersivePresetDef(),
-new BezelKokoAioPresetsNgMonitorBalancedPresetDef(),
-new BezelKokoAioPresetsNgMonitorFor_1440pMin_HiNitsPresetDef(),
-new BezelKokoAioPresetsNgMonitorFor_HigherNitsPresetDef(),
-new BezelKokoAioPresetsNgMonitorFXAA_sharpAperturegrillePresetDef(),
-new BezelKokoAioPresetsNgMonitorFXAA_sharpCore_SlotMaskPresetDef(),
-new BezelKokoAioPresetsNgMonitorFXAA_sharpScreen_SlotMaskPresetDef(),
-new BezelKokoAioPresetsNgMonitorNew_aperturegrille_gmPresetDef(),
-new BezelKokoAioPresetsNgMonitorNew_slotmask_gmPresetDef(),
-new BezelKokoAioPresetsNgMonitorNew_slotmask_rgbPresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_HmaskAperturegrilleOvermaskPresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_HmaskAperturegrillePresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_HmaskCore_SlotMaskOvermaskPresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_HmaskCore_SlotMaskPresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_HmaskScreen_SlotMaskChameleonPresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_HmaskScreen_SlotMaskPresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_HmaskScreen_SlotMask_TallerPresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_HmaskScreen_SlotMask_Taller_BrighterPresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_HmaskShadowMaskPresetDef(),
-new BezelKokoAioPresetsNgMonitorScreen_Hmask_OverlappedOldpainlessPresetDef(),
-new BezelKokoAioPresetsNgMonitorSlotmaskTVL410PresetDef(),
-new BezelKokoAioPresetsNgTVTvNTSC_GenericAA_sharpSelectivePresetDef(),
-new BezelKokoAioPresetsNgTVTvNTSC_MegadriveAA_sharpSelectivePresetDef(),
-new BezelKokoAioPresetsNgVectorGFXVector_neon_4_mame2003plus_defaultsPresetDef(),
-new BezelKokoAioPresetsNgVectorGFXVector_std_4_mame2003plus_defaultsPresetDef(),
-new BezelKokoAioPresetsNgVGAMonitorVGADoubleScanAmberPresetDef(),
-new BezelKokoAioPresetsNgVGAMonitorVGADoubleScanGreenPresetDef(),
-new BezelKokoAioPresetsNgVGAMonitorVGADoubleScanShadowMaskPresetDef(),
-new BezelKokoAioPresetsNgVGAMonitorVGADoubleScanXBRPresetDef(),
-new BezelKokoAioPresetsNgVGAMonitorVGADoubleScanPresetDef(),
-new BezelKokoAioPresets_HandheldsNgDots_11PresetDef(),
-new BezelKokoAioPresets_HandheldsNgDots_43PresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyAdvanceOverlayNightPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyAdvanceOverlayPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyAdvancePresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyColorOverlayIPSPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyColorOverlayTallerIPSPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyColorOverlayTallerPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyColorOverlayPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyColorPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyMonoOverlayTallerPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyMonoOverlayPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyMonoPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyPocketOverlayTallerPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyPocketOverlayPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameboyPocketPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameGearOverlayNightPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGameGearOverlayPresetDef(),
-new BezelKokoAioPresets_HandheldsNgGenericHandheldRGBPresetDef(),
-new BezelKokoAioPresets_HandheldsNgPSPOverlayNightBigY_flipPresetDef(),
-new BezelKokoAioPresets_HandheldsNgPSPOverlayNightBigPresetDef(),
-new BezelKokoAioPresets_HandheldsNgPSPOverlayNightSmallY_flipPresetDef(),
-new BezelKokoAioPresets_HandheldsNgPSPOverlayNightSmallPresetDef(),
-new BezelKokoAioPresets_HandheldsNgPSPPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVRESHADEFX__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSRESHADEFX__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYNOTUBEFX__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__PASSTHROUGHPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDNOTUBEFX__PASSTHROUGHPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__PASSTHROUGHPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTNOTUBEFX__PASSTHROUGHPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__PASSTHROUGHPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYNOTUBEFX__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYNOTUBEFX__PASSTHROUGHPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__PASSTHROUGHPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__MEGATRONNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__MEGATRONPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__PASSTHROUGHPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_ADVGLASSPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_ADVNOREFLECTPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_ADVPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_POTATOPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_SMOOTHADVGLASSPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_SMOOTHADVPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_STDGLASSPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_STDNOREFLECTPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_STDPresetDef(),
-new BezelUborderKokoAmbiCrtPresetDef(),
-new BezelUborderUborderBezelReflectionsPresetDef(),
-new BezelUborderUborderKokoAmbiPresetDef(),
-new StockBilinearPresetDef(),
-new BlursDual_filter_2_passPresetDef(),
-new BlursDual_filter_4_passPresetDef(),
-new BlursDual_filter_6_passPresetDef(),
-new BlursDual_filter_bloomPresetDef(),
-new BlursDual_filter_bloom_fastPresetDef(),
-new BlursDual_filter_bloom_fastestPresetDef(),
-new BlursGaussian_blurSharpPresetDef(),
-new BlursGaussian_blurPresetDef(),
-new BlursGaussian_blur_2_passSharpPresetDef(),
-new BlursGaussian_blur_2_passPresetDef(),
-new BlursGauss_4tapPresetDef(),
-new BlursGizmoCompositeBlurPresetDef(),
-new BlursKawase_blur_5passPresetDef(),
-new BlursKawase_blur_9passPresetDef(),
-new BlursKawase_glowPresetDef(),
-new BlursSharpsmootherPresetDef(),
-new BlursSmartBlurPresetDef(),
-new BorderAmbientGlowPresetDef(),
-new BorderAutocropKokoPresetDef(),
-new BorderAverage_fillPresetDef(),
-new BorderBigblurPresetDef(),
-new BorderBlur_fillPresetDef(),
-new BorderBlur_fill_stronger_blurPresetDef(),
-new BorderBlur_fill_weaker_blurPresetDef(),
-new BorderEffectBorderIqPresetDef(),
-new BorderGameboyPlayerGameboyPlayerCrtEasymodePresetDef(),
-new BorderGameboyPlayerGameboyPlayerCrtGeom1xPresetDef(),
-new BorderGameboyPlayerGameboyPlayerCrtRoyalePresetDef(),
-new BorderGameboyPlayerGameboyPlayerGbaColorCrtEasymodePresetDef(),
-new BorderGameboyPlayerGameboyPlayerGbaColorPresetDef(),
-new BorderGameboyPlayerGameboyPlayerTvoutInterlacingPresetDef(),
-new BorderGameboyPlayerGameboyPlayerTvoutGbaColorInterlacingPresetDef(),
-new BorderGameboyPlayerGameboyPlayerTvoutGbaColorPresetDef(),
-new BorderGameboyPlayerGameboyPlayerTvoutPresetDef(),
-new BorderGameboyPlayerGameboyPlayerPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbCrtConsumerPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbDotPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbLcdGridV2PresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbaCrtConsumerPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbaDotPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbaLcdGridV2PresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbaPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGgCrtConsumerPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGgDotPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGgLcdGridV2PresetDef(),
-new BorderHandheldNebulaHandheldNebulaGgPresetDef(),
-new BorderImgborderPresetDef(),
-new BorderLightgunBorderPresetDef(),
-new BorderSgbSgbCrtEasymodePresetDef(),
-new BorderSgbSgbCrtGeom1xPresetDef(),
-new BorderSgbSgbCrtRoyalePresetDef(),
-new BorderSgbSgbGbcColorTvoutInterlacingPresetDef(),
-new BorderSgbSgbGbcColorPresetDef(),
-new BorderSgbSgbTvoutInterlacingPresetDef(),
-new BorderSgbSgbPresetDef(),
-new BorderSgbaSgbaGbaColorPresetDef(),
-new BorderSgbaSgbaTvoutInterlacingPresetDef(),
-new BorderSgbaSgbaTvoutGbaColorInterlacingPresetDef(),
-new BorderSgbaSgbaPresetDef(),
-new CelAdvcartoonPresetDef(),
-new CelMMJ_Cel_ShaderPresetDef(),
-new CelMMJ_Cel_Shader_MPPresetDef(),
-new CrtAdvanced_crt_whkrmrgks0PresetDef(),
-new CrtCathodeRetro_noSignalPresetDef(),
-new CrtCrt1tapBloomPresetDef(),
-new CrtCrt1tapBloom_fastPresetDef(),
-new CrtCrt1tapPresetDef(),
-new CrtCrtAperturePresetDef(),
-new CrtCrtBlurPiSharpPresetDef(),
-new CrtCrtBlurPiSoftPresetDef(),
-new CrtCrtCaligariPresetDef(),
-new CrtCrtCgwgFastPresetDef(),
-new CrtCrtConsumerPresetDef(),
-new CrtCrtCyclonPresetDef(),
-new CrtCrtEasymodeHalationPresetDef(),
-new CrtCrtEasymodePresetDef(),
-new CrtCrtFrutbunnPresetDef(),
-new CrtCrtGdvMiniUltraTrinitronPresetDef(),
-new CrtCrtGdvMiniPresetDef(),
-new CrtCrtGeomDeluxePresetDef(),
-new CrtCrtGeomMiniPresetDef(),
-new CrtCrtGeomTatePresetDef(),
-new CrtCrtGeomPresetDef(),
-new CrtCrtGuestAdvancedFastPresetDef(),
-new CrtCrtGuestAdvancedFastestPresetDef(),
-new CrtCrtGuestAdvancedHdPresetDef(),
-new CrtCrtGuestAdvancedNtscPresetDef(),
-new CrtCrtGuestAdvancedPresetDef(),
-new CrtCrtHyllian3dPresetDef(),
-new CrtCrtHyllianFastPresetDef(),
-new CrtCrtHyllianNtscRainbowPresetDef(),
-new CrtCrtHyllianNtscPresetDef(),
-new CrtCrtHyllianSincCompositePresetDef(),
-new CrtCrtHyllianPresetDef(),
-new CrtCrtInterlacedHalationPresetDef(),
-new CrtCrtLottesFastPresetDef(),
-new CrtCrtLottesMultipassGlowPresetDef(),
-new CrtCrtLottesMultipassPresetDef(),
-new CrtCrtLottesPresetDef(),
-new CrtCrtMattiasPresetDef(),
-new CrtCrtMaximusRoyaleFastModePresetDef(),
-new CrtCrtMaximusRoyaleHalfResModePresetDef(),
-new CrtCrtMaximusRoyalePresetDef(),
-new CrtCrtNesMiniPresetDef(),
-new CrtCrtNobodyPresetDef(),
-new CrtCrtPiPresetDef(),
-new CrtCrtPocketPresetDef(),
-new CrtCrtPotatoBVMPresetDef(),
-new CrtCrtPotatoCoolPresetDef(),
-new CrtCrtPotatoWarmPresetDef(),
-new CrtCrtResswitchGlitchKokoPresetDef(),
-new CrtCrtRoyaleFakeBloomIntelPresetDef(),
-new CrtCrtRoyaleFakeBloomPresetDef(),
-new CrtCrtRoyaleFastPresetDef(),
-new CrtCrtRoyaleIntelPresetDef(),
-new CrtCrtRoyalePresetDef(),
-new CrtCrtSimplePresetDef(),
-new CrtCrtSinesPresetDef(),
-new CrtCrtSlangtestCubicPresetDef(),
-new CrtCrtSlangtestLanczosPresetDef(),
-new CrtCrtSuperXbrPresetDef(),
-new CrtCrtTorridgristlePresetDef(),
-new CrtCrtYahSinglePassPresetDef(),
-new CrtCrtYahPresetDef(),
-new CrtCrtYo6FlatTrinitronTvPresetDef(),
-new CrtCrtYo6KV21CL10BPresetDef(),
-new CrtCrtYo6KVM1420BSharpPresetDef(),
-new CrtCrtYo6KVM1420BPresetDef(),
-new CrtCrtglow_gaussPresetDef(),
-new CrtCrtglow_lanczosPresetDef(),
-new CrtCrtsimPresetDef(),
-new CrtFakeCrtGeomPotatoPresetDef(),
-new CrtFakeCrtGeomPresetDef(),
-new CrtFakelottesPresetDef(),
-new CrtGizmoCrtPresetDef(),
-new CrtGizmoSlotmaskCrtPresetDef(),
-new CrtGlow_trailsPresetDef(),
-new CrtGritsScanlinesPresetDef(),
-new CrtGtuV050PresetDef(),
-new CrtMame_hlslPresetDef(),
-new CrtMetacrtPresetDef(),
-new CrtNewpixieCrtPresetDef(),
-new CrtNewpixieMiniPresetDef(),
-new CrtPhosphorPersistencePresetDef(),
-new CrtPhosphorlutPresetDef(),
-new CrtRay_traced_curvaturePresetDef(),
-new CrtRay_traced_curvature_appendPresetDef(),
-new CrtSimpleCrtFxaaPresetDef(),
-new CrtSimpleCrtPresetDef(),
-new CrtTvoutTweaksPresetDef(),
-new CrtVectorGlowAltRenderPresetDef(),
-new CrtVectorGlowPresetDef(),
-new CrtVt220PresetDef(),
-new CrtYee64PresetDef(),
-new CrtYeetronPresetDef(),
-new CrtZfastCrtCompositePresetDef(),
-new CrtZfastCrtCurvaturePresetDef(),
-new CrtZfastCrtGeoPresetDef(),
-new CrtZfastCrtHdmaskPresetDef(),
-new CrtZfastCrtPresetDef(),
-new DeblurDeblurLumaPresetDef(),
-new DeblurDeblurPresetDef(),
-new DenoisersBilateral2pPresetDef(),
-new DenoisersBilateralPresetDef(),
-new DenoisersCrtFastBilateralSuperXbrPresetDef(),
-new DenoisersFastBilateralPresetDef(),
-new DenoisersMedian_3x3PresetDef(),
-new DenoisersMedian_5x5PresetDef(),
-new DenoisersSlowBilateralPresetDef(),
-new DitheringBayerMatrixDitheringPresetDef(),
-new DitheringBayer_4x4PresetDef(),
-new DitheringBlue_noisePresetDef(),
-new DitheringBlue_noise_dynamic_4BitPresetDef(),
-new DitheringBlue_noise_dynamic_monochromePresetDef(),
-new DitheringCbod_v1PresetDef(),
-new DitheringCheckerboardDeditherPresetDef(),
-new DitheringGSharp_resamplerPresetDef(),
-new DitheringGdaptPresetDef(),
-new DitheringGenditherPresetDef(),
-new DitheringJinc2DeditherPresetDef(),
-new DitheringMdaptPresetDef(),
-new DitheringPs1DeditherBoxblurPresetDef(),
-new DitheringPs1DeditherComparisonPresetDef(),
-new DitheringPs1DitherPresetDef(),
-new DitheringSgenptMixMultipassPresetDef(),
-new DitheringSgenptMixPresetDef(),
-new EdgeSmoothingCleanEdgeCleanEdgeScalePresetDef(),
-new EdgeSmoothingDdt3PointPresetDef(),
-new EdgeSmoothingDdtCutPresetDef(),
-new EdgeSmoothingDdtDdtExtendedPresetDef(),
-new EdgeSmoothingDdtDdtJincLinearPresetDef(),
-new EdgeSmoothingDdtDdtJincPresetDef(),
-new EdgeSmoothingDdtDdtXbrLv1PresetDef(),
-new EdgeSmoothingDdtDdtPresetDef(),
-new EdgeSmoothingEagle2xsaiFixPixelShiftPresetDef(),
-new EdgeSmoothingEagle2xsaiPresetDef(),
-new EdgeSmoothingEagleSuper2xsaiFixPixelShiftPresetDef(),
-new EdgeSmoothingEagleSuper2xsaiPresetDef(),
-new EdgeSmoothingEagleSupereaglePresetDef(),
-new EdgeSmoothingFsrFsrEasuPresetDef(),
-new EdgeSmoothingFsrFsrPresetDef(),
-new EdgeSmoothingFsrSmaaFsrPresetDef(),
-new EdgeSmoothingHqxHq2xHalphonPresetDef(),
-new EdgeSmoothingHqxHq2xPresetDef(),
-new EdgeSmoothingHqxHq3xPresetDef(),
-new EdgeSmoothingHqxHq4xPresetDef(),
-new EdgeSmoothingNediFastBilateralNediPresetDef(),
-new EdgeSmoothingNediNediHybridSharperPresetDef(),
-new EdgeSmoothingNediNediHybridPresetDef(),
-new EdgeSmoothingNediNediSharperPresetDef(),
-new EdgeSmoothingNediNediPresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariantPresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant2PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant3PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant4PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant5PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant6PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant7PresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns162xLumaPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns162xRgbPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns164xLumaPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns322xRgbNns324xLumaPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns324xRgbPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns642xNns324xNns168xRgbPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns642xNns324xRgbPresetDef(),
-new EdgeSmoothingOmniscaleOmniscaleLegacyPresetDef(),
-new EdgeSmoothingOmniscaleOmniscalePresetDef(),
-new EdgeSmoothingSabrSabrHybridDeposterizePresetDef(),
-new EdgeSmoothingSabrSabrPresetDef(),
-new EdgeSmoothingScalefxScalefxRAAPresetDef(),
-new EdgeSmoothingScalefxScalefx9xPresetDef(),
-new EdgeSmoothingScalefxScalefxHybridPresetDef(),
-new EdgeSmoothingScalefxScalefxPresetDef(),
-new EdgeSmoothingScalehq2xScaleHQPresetDef(),
-new EdgeSmoothingScalehq4xScaleHQPresetDef(),
-new EdgeSmoothingScalenxEpxPresetDef(),
-new EdgeSmoothingScalenxMmpxPresetDef(),
-new EdgeSmoothingScalenxScale2xPresetDef(),
-new EdgeSmoothingScalenxScale2xplusPresetDef(),
-new EdgeSmoothingScalenxScale2xSFXPresetDef(),
-new EdgeSmoothingScalenxScale3xPresetDef(),
-new EdgeSmoothingXbrHybridJinc2XbrLv2PresetDef(),
-new EdgeSmoothingXbrSuperXbrFastPresetDef(),
-new EdgeSmoothingXbrSuperXbrPresetDef(),
-new EdgeSmoothingXbrXbrLv2SharpPresetDef(),
-new EdgeSmoothingXbrXbrLv2PresetDef(),
-new EdgeSmoothingXbrXbrLv3SharpPresetDef(),
-new EdgeSmoothingXbrXbrLv3PresetDef(),
-new EdgeSmoothingXbrz2xbrzLinearPresetDef(),
-new EdgeSmoothingXbrz4xbrzLinearPresetDef(),
-new EdgeSmoothingXbrz5xbrzLinearPresetDef(),
-new EdgeSmoothingXbrz6xbrzLinearPresetDef(),
-new EdgeSmoothingXbrzXbrzFreescaleMultipassPresetDef(),
-new EdgeSmoothingXbrzXbrzFreescalePresetDef(),
-new EdgeSmoothingXsal2xsalLevel2CrtPresetDef(),
-new EdgeSmoothingXsal2xsalPresetDef(),
-new EdgeSmoothingXsal4xsalLevel2CrtPresetDef(),
-new EdgeSmoothingXsal4xsalLevel2HqPresetDef(),
-new EdgeSmoothingXsal4xsalLevel2PresetDef(),
-new EdgeSmoothingXsoft4xsoftPresetDef(),
-new EdgeSmoothingXsoft4xsoftSdBPresetDef(),
-new FilmFilmGrainPresetDef(),
-new FilmTechnicolorPresetDef(),
-new Gpu3dfx_4x1PresetDef(),
-new GpuPowervr2PresetDef(),
-new HandheldAgb001PresetDef(),
-new HandheldAgs001PresetDef(),
-new HandheldAuthentic_gbcPresetDef(),
-new HandheldAuthentic_gbc_fastPresetDef(),
-new HandheldAuthentic_gbc_single_passPresetDef(),
-new HandheldBevelPresetDef(),
-new HandheldColorModDsliteColorPresetDef(),
-new HandheldColorModGbaColorPresetDef(),
-new HandheldColorModGbcColorPresetDef(),
-new HandheldColorModGbcGambatteColorPresetDef(),
-new HandheldColorModGbMicroColorPresetDef(),
-new HandheldColorModNdsColorPresetDef(),
-new HandheldColorModNSOGbaColorPresetDef(),
-new HandheldColorModNSOGbcColorPresetDef(),
-new HandheldColorModPalmColorPresetDef(),
-new HandheldColorModPspColorPresetDef(),
-new HandheldColorModSp101ColorPresetDef(),
-new HandheldColorModSwitchOLEDColorPresetDef(),
-new HandheldColorModVbaColorPresetDef(),
-new HandheldConsoleBorderDmgPresetDef(),
-new HandheldConsoleBorderGbDmgAltPresetDef(),
-new HandheldConsoleBorderGbLightAltPresetDef(),
-new HandheldConsoleBorderGbPocketAltPresetDef(),
-new HandheldConsoleBorderGbPocketPresetDef(),
-new HandheldConsoleBorderGbaAgb001ColorMotionblurPresetDef(),
-new HandheldConsoleBorderGbaAgs001ColorMotionblurPresetDef(),
-new HandheldConsoleBorderGbaLcdGridV2PresetDef(),
-new HandheldConsoleBorderGbaPresetDef(),
-new HandheldConsoleBorderGbcLcdGridV2PresetDef(),
-new HandheldConsoleBorderGbcPresetDef(),
-new HandheldConsoleBorderGgPresetDef(),
-new HandheldConsoleBorderNgpcPresetDef(),
-new HandheldConsoleBorderPspPresetDef(),
-new HandheldDotPresetDef(),
-new HandheldDsHybridSabrPresetDef(),
-new HandheldDsHybridScalefxPresetDef(),
-new HandheldGameboyAdvanceDotMatrixPresetDef(),
-new HandheldGameboyColorDotMatrixWhiteBgPresetDef(),
-new HandheldGameboyColorDotMatrixPresetDef(),
-new HandheldGameboyDarkModePresetDef(),
-new HandheldGameboyLightModePresetDef(),
-new HandheldGameboyLightPresetDef(),
-new HandheldGameboyPocketHighContrastPresetDef(),
-new HandheldGameboyPocketPresetDef(),
-new HandheldGameboyPresetDef(),
-new HandheldGbPaletteDmgPresetDef(),
-new HandheldGbPaletteLightPresetDef(),
-new HandheldGbPalettePocketPresetDef(),
-new HandheldGbcDevPresetDef(),
-new HandheldLcdGridV2PresetDef(),
-new HandheldLcdGridPresetDef(),
-new HandheldLcdShaderPresetDef(),
-new HandheldLcd1xPresetDef(),
-new HandheldLcd1x_ndsPresetDef(),
-new HandheldLcd1x_pspPresetDef(),
-new HandheldLcd3xPresetDef(),
-new HandheldRetroTilesPresetDef(),
-new HandheldRetroV2PresetDef(),
-new HandheldRetroV3PresetDef(),
-new HandheldSameboyLcdPresetDef(),
-new HandheldSimpletex_lcd4kPresetDef(),
-new HandheldSimpletex_lcdPresetDef(),
-new HandheldSimpletex_lcd_720pPresetDef(),
-new HandheldZfastLcdPresetDef(),
-new InterpolationBSpline4TapsFastPresetDef(),
-new InterpolationBSpline4TapsPresetDef(),
-new InterpolationBSplineFastPresetDef(),
-new InterpolationBicubic5TapsPresetDef(),
-new InterpolationBicubic6TapsFastPresetDef(),
-new InterpolationBicubicFastPresetDef(),
-new InterpolationBicubicPresetDef(),
-new InterpolationCatmullRom4TapsPresetDef(),
-new InterpolationCatmullRom5TapsPresetDef(),
-new InterpolationCatmullRom6TapsFastPresetDef(),
-new InterpolationCatmullRomFastPresetDef(),
-new InterpolationCatmullRomPresetDef(),
-new InterpolationCubicGammaCorrectPresetDef(),
-new InterpolationCubicPresetDef(),
-new InterpolationHann5TapsPresetDef(),
-new InterpolationHermitePresetDef(),
-new InterpolationJinc2SharpPresetDef(),
-new InterpolationJinc2SharperPresetDef(),
-new InterpolationJinc2PresetDef(),
-new InterpolationLanczos25TapsPresetDef(),
-new InterpolationLanczos26TapsFastPresetDef(),
-new InterpolationLanczos2FastPresetDef(),
-new InterpolationLanczos2PresetDef(),
-new InterpolationLanczos3FastPresetDef(),
-new InterpolationLanczos4PresetDef(),
-new InterpolationLanczos6PresetDef(),
-new InterpolationLanczos8PresetDef(),
-new InterpolationLinearGammaPresetsBSplineFastPresetDef(),
-new InterpolationLinearGammaPresetsBicubicFastPresetDef(),
-new InterpolationLinearGammaPresetsCatmullRomFastPresetDef(),
-new InterpolationLinearGammaPresetsLanczos2FastPresetDef(),
-new InterpolationLinearGammaPresetsLanczos3FastPresetDef(),
-new InterpolationLinearGammaPresetsSpline16FastPresetDef(),
-new InterpolationLinearGammaPresetsSpline36FastPresetDef(),
-new InterpolationQuilezPresetDef(),
-new InterpolationSpline100PresetDef(),
-new InterpolationSpline144PresetDef(),
-new InterpolationSpline16FastPresetDef(),
-new InterpolationSpline256PresetDef(),
-new InterpolationSpline36FastPresetDef(),
-new InterpolationSpline64PresetDef(),
-new LinearLinearGammaCorrectPresetDef(),
-new MiscAccessibility_modsPresetDef(),
-new MiscAntiFlickerPresetDef(),
-new MiscAsciiPresetDef(),
-new MiscBeadPresetDef(),
-new MiscBobDeinterlacingPresetDef(),
-new MiscChromaPresetDef(),
-new MiscChromaticityPresetDef(),
-new MiscCmykHalftoneDotPresetDef(),
-new MiscCocktailCabinetPresetDef(),
-new MiscColorManglerPresetDef(),
-new MiscColorimetryPresetDef(),
-new MiscConvergencePresetDef(),
-new MiscDebandPresetDef(),
-new MiscDeinterlacePresetDef(),
-new MiscEdgeDetectPresetDef(),
-new MiscEgaPresetDef(),
-new MiscGeomAppendPresetDef(),
-new MiscGeomPresetDef(),
-new MiscGlassPresetDef(),
-new MiscGradeNoLUTPresetDef(),
-new MiscGradePresetDef(),
-new MiscHalf_resPresetDef(),
-new MiscImageAdjustmentPresetDef(),
-new MiscImg_modPresetDef(),
-new MiscInterlacingPresetDef(),
-new MiscNaturalVisionPresetDef(),
-new MiscNightModePresetDef(),
-new MiscNtscColorsPresetDef(),
-new MiscPatchyColorPresetDef(),
-new MiscReliefPresetDef(),
-new MiscRetroPalettesPresetDef(),
-new MiscSimple_color_controlsPresetDef(),
-new MiscSsGammaRampPresetDef(),
-new MiscTestPatternAppendPresetDef(),
-new MiscTestPatternPrependPresetDef(),
-new MiscTonemappingPresetDef(),
-new MiscWhite_pointPresetDef(),
-new MiscYiqHueAdjustmentPresetDef(),
-new MotionInterpolationMotion_interpolationPresetDef(),
-new MotionblurBraidRewindPresetDef(),
-new MotionblurFeedbackPresetDef(),
-new MotionblurMix_framesPresetDef(),
-new MotionblurMix_frames_smartPresetDef(),
-new MotionblurMotionblurBluePresetDef(),
-new MotionblurMotionblurColorPresetDef(),
-new MotionblurMotionblurSimplePresetDef(),
-new MotionblurResponseTimePresetDef(),
-new StockNearestPresetDef(),
-new Nes_raw_paletteCgwgFamicomGeomPresetDef(),
-new Nes_raw_paletteGtuFamicomPresetDef(),
-new Nes_raw_paletteNtscNesPresetDef(),
-new Nes_raw_palettePalR57shellRawPresetDef(),
-new Nes_raw_palettePatchyMesenRawPalettePresetDef(),
-new NtscArtifactColorsPresetDef(),
-new NtscBlarggPresetDef(),
-new NtscMameNtscPresetDef(),
-new NtscNtsc256pxCompositeScanlinePresetDef(),
-new NtscNtsc256pxCompositePresetDef(),
-new NtscNtsc256pxSvideoScanlinePresetDef(),
-new NtscNtsc256pxSvideoPresetDef(),
-new NtscNtsc320pxCompositeScanlinePresetDef(),
-new NtscNtsc320pxCompositePresetDef(),
-new NtscNtsc320pxSvideoScanlinePresetDef(),
-new NtscNtsc320pxSvideoPresetDef(),
-new NtscNtscAdaptive4xPresetDef(),
-new NtscNtscAdaptiveOld4xPresetDef(),
-new NtscNtscAdaptiveOldPresetDef(),
-new NtscNtscAdaptiveTatePresetDef(),
-new NtscNtscAdaptivePresetDef(),
-new NtscNtscBlastemPresetDef(),
-new NtscNtscMdRainbowsPresetDef(),
-new NtscNtscMiniPresetDef(),
-new NtscNtscSimplePresetDef(),
-new NtscNtscXotPresetDef(),
-new NtscPatchyBlastemPresetDef(),
-new NtscPatchyGenplusgxPresetDef(),
-new NtscPatchySnesPresetDef(),
-new NtscTiny_ntscPresetDef(),
-new PalPalR57shellMoireOnlyPresetDef(),
-new PalPalR57shellPresetDef(),
-new PalPalSinglepassPresetDef(),
-new PixelArtScalingAannPresetDef(),
-new PixelArtScalingBandlimitPixelPresetDef(),
-new PixelArtScalingBilinearAdjustablePresetDef(),
-new PixelArtScalingBox_filter_aa_xformPresetDef(),
-new PixelArtScalingCleanEdgeRotatePresetDef(),
-new PixelArtScalingControlled_sharpnessPresetDef(),
-new PixelArtScalingEdge1pixelPresetDef(),
-new PixelArtScalingEdgeNpixelsPresetDef(),
-new PixelArtScalingGridBlendHybridPresetDef(),
-new PixelArtScalingPixellatePresetDef(),
-new PixelArtScalingPixel_aaPresetDef(),
-new PixelArtScalingPixel_aa_fastPresetDef(),
-new PixelArtScalingPixel_aa_single_passPresetDef(),
-new PixelArtScalingPixel_aa_xformPresetDef(),
-new PixelArtScalingSharpBilinear2xPrescalePresetDef(),
-new PixelArtScalingSharpBilinearScanlinesPresetDef(),
-new PixelArtScalingSharpBilinearSimplePresetDef(),
-new PixelArtScalingSharpBilinearPresetDef(),
-new PixelArtScalingSharpShimmerlessPresetDef(),
-new PixelArtScalingSmootheststepPresetDef(),
-new PixelArtScalingSmuberstepPresetDef(),
-new PixelArtScalingSoftPixelArtPresetDef(),
-new PixelArtScalingUniformNearestPresetDef(),
-new PresetsBlursDualBloomFilterAaLv2FsrGammaRampGlassPresetDef(),
-new PresetsBlursDualBloomFilterAaLv2FsrGammaRampPresetDef(),
-new PresetsBlursDualBloomFilterAaLv2FsrPresetDef(),
-new PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampGsharpResamplerPresetDef(),
-new PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampPresetDef(),
-new PresetsBlursGizmoCompositeBlurAaLv2FsrGsharpResamplerPresetDef(),
-new PresetsBlursGizmoCompositeBlurAaLv2FsrPresetDef(),
-new PresetsBlursKawaseGlowBspline4tapsFsrGammaRampTonemappingPresetDef(),
-new PresetsBlursSmartblurBspline4tapsFsrGammaRampVhsPresetDef(),
-new PresetsBlursSmartblurBspline4tapsFsrGammaRampPresetDef(),
-new PresetsBlursSmartblurBspline4tapsFsrPresetDef(),
-new PresetsCrtGeomSimplePresetDef(),
-new PresetsCrtHyllianSincSmartblurSgenptPresetDef(),
-new PresetsCrtHyllianSmartblurSgenptPresetDef(),
-new PresetsCrtLottesMultipassInterlacedGlowPresetDef(),
-new PresetsCrtNtscSharpCompositeGlowPresetDef(),
-new PresetsCrtNtscSharpCompositePresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x4GlowPresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x4PresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x5GlowPresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x5PresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x6GlowPresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x6PresetDef(),
-new PresetsCrtNtscSharpTateCompositeGlowPresetDef(),
-new PresetsCrtNtscSharpTateCompositePresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x4GlowPresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x4PresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x5GlowPresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x5PresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x6GlowPresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x6PresetDef(),
-new PresetsCrtPlusSignalC64MonitorPresetDef(),
-new PresetsCrtPlusSignalCrtGeomDeluxeNtscAdaptivePresetDef(),
-new PresetsCrtPlusSignalCrtRoyaleFastNtscCompositePresetDef(),
-new PresetsCrtPlusSignalCrtRoyaleNtscCompositePresetDef(),
-new PresetsCrtPlusSignalCrtRoyaleNtscSvideoPresetDef(),
-new PresetsCrtPlusSignalCrtRoyalePalR57shellPresetDef(),
-new PresetsCrtPlusSignalCrtglow_gauss_ntscPresetDef(),
-new PresetsCrtPlusSignalFakelottesNtscCompositePresetDef(),
-new PresetsCrtPlusSignalFakelottesNtscSvideoPresetDef(),
-new PresetsCrtPlusSignalMy_old_tvPresetDef(),
-new PresetsCrtPlusSignalNtscPhosphorlutPresetDef(),
-new PresetsCrtPlusSignalNtsclutPhosphorlutPresetDef(),
-new PresetsCrtPotatoCrtPotatoColorimetryConvergencePresetDef(),
-new PresetsCrtRoyaleDownsamplePresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePsxPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureSnesPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscRfSlotmaskNesPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastRgbAperturePresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastRgbSlotPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePsxPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeSnesPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmRgbBlendPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmRgbShmupPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmRgbPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePsxPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureSnesPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscRfSlotmaskNesPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastRgbAperturePresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastRgbSlotPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePsxPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeSnesPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmRgbBlendPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmRgbShmupPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmRgbPresetDef(),
-new PresetsCrtRoyaleKurozumiPresetDef(),
-new PresetsCrtRoyaleSmoothPresetDef(),
-new PresetsCrtRoyaleXm29plusPresetDef(),
-new PresetsCrtsimGrungyPresetDef(),
-new PresetsDownsampleDrez8xFsrAaLv2Bspline4tapsPresetDef(),
-new PresetsFsrFsrAaLv2Bspline4tapsNtscColorsPresetDef(),
-new PresetsFsrFsrAaLv2Bspline4tapsPresetDef(),
-new PresetsFsrFsrAaLv2DeblurPresetDef(),
-new PresetsFsrFsrAaLv2GlassPresetDef(),
-new PresetsFsrFsrAaLv2Kawase5blurNtscColorsGlassPresetDef(),
-new PresetsFsrFsrAaLv2Kawase5blurNtscColorsPresetDef(),
-new PresetsFsrFsrAaLv2Median3x3GlassPresetDef(),
-new PresetsFsrFsrAaLv2Median3x3NtscColorsGlassPresetDef(),
-new PresetsFsrFsrAaLv2Median3x3NtscColorsPresetDef(),
-new PresetsFsrFsrAaLv2Median3x3PresetDef(),
-new PresetsFsrFsrAaLv2NaturalvisionGlassPresetDef(),
-new PresetsFsrFsrAaLv2NaturalvisionVhsPresetDef(),
-new PresetsFsrFsrAaLv2NaturalvisionPresetDef(),
-new PresetsFsrFsrAaLv2SabrHybridDeposterizePresetDef(),
-new PresetsFsrFsrAaLv2VhsPresetDef(),
-new PresetsFsrFsrAaLv2PresetDef(),
-new PresetsFsrFsrCrtPotatoBvmVhsPresetDef(),
-new PresetsFsrFsrCrtPotatoBvmPresetDef(),
-new PresetsFsrFsrCrtPotatoColorimetryConvergencePresetDef(),
-new PresetsFsrFsrCrtPotatoWarmColorimetryConvergencePresetDef(),
-new PresetsFsrFsrCrtroyaleXm29plusPresetDef(),
-new PresetsFsrFsrCrtroyalePresetDef(),
-new PresetsFsrFsrLv2AaChromacityGlassPresetDef(),
-new PresetsFsrFsrSmaaColorimetryConvergencePresetDef(),
-new PresetsGameboyAdvanceDotMatrixSepiaPresetDef(),
-new PresetsGizmoCrtGizmoCrtCurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtMegadriveCurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtMegadrivePresetDef(),
-new PresetsGizmoCrtGizmoCrtN64CurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtN64PresetDef(),
-new PresetsGizmoCrtGizmoCrtPsxCurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtPsxPresetDef(),
-new PresetsGizmoCrtGizmoCrtSnes4kPresetDef(),
-new PresetsGizmoCrtGizmoCrtSnesCurvator4kPresetDef(),
-new PresetsGizmoCrtGizmoCrtSnesDarkCurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtSnesDarkPresetDef(),
-new PresetsHandheldPlusColorModAgb001GbaColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModAgs001GbaColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModBandlimitPixelGbaColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2DsliteColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2DsliteColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbaColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbaColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbcColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbcColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbMicroColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbMicroColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2NdsColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2NdsColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2PalmColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2PalmColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2PspColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2PspColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2Sp101ColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2Sp101ColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2VbaColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2VbaColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2GbaColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2GbcColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2ImageAdjustmentPresetDef(),
-new PresetsHandheldPlusColorModRetroV2NdsColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2PspColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2VbaColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV3NdsColorPresetDef(),
-new PresetsHandheldPlusColorModSameboyLcdGbcColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcdGbaColor4kPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcdGbaColorPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcdGbcColor4kPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcdGbcColorPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcd_720pGbaColorPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcd_720pGbcColorPresetDef(),
-new PresetsImgborderRoyaleKurozumiPresetDef(),
-new PresetsInterpolationBspline4tapsAaLv2FsrGammaRampPresetDef(),
-new PresetsInterpolationBspline4tapsAaLv2FsrPowervrPresetDef(),
-new PresetsInterpolationBspline4tapsAaLv2FsrPresetDef(),
-new PresetsInterpolationBspline4tapsAaLv2PresetDef(),
-new PresetsInterpolationBspline4tapsFsrVhsPresetDef(),
-new PresetsInterpolationLanczos25tapsFsrGammaRampVhsPresetDef(),
-new PresetsInterpolationLanczos25tapsFsrGammaRampPresetDef(),
-new PresetsInterpolationLanczos25tapsFsrPresetDef(),
-new PresetsInterpolationSpline36FastFsrGammaRampVhsPresetDef(),
-new PresetsInterpolationSpline36FastFsrGammaRampPresetDef(),
-new PresetsInterpolationSpline36FastFsrPresetDef(),
-new PresetsMdaptFastBilateralSuper4xbrScanlinesPresetDef(),
-new PresetsNediPowervrSharpenPresetDef(),
-new PresetsNesColorDecoderColorimetryPixellatePresetDef(),
-new PresetsNesColorDecoderPixellatePresetDef(),
-new PresetsScalefxPlusSmoothingScalefxRAAAaFastPresetDef(),
-new PresetsScalefxPlusSmoothingScalefxRAAAaPresetDef(),
-new PresetsScalefxPlusSmoothingScalefxAaFastPresetDef(),
-new PresetsScalefxPlusSmoothingScalefxAaPresetDef(),
-new PresetsScalefxPlusSmoothingScalefx9AaBlurHazyNtscSh1nra358PresetDef(),
-new PresetsScalefxPlusSmoothingScalefx9AaBlurHazyVibranceSh1nra358PresetDef(),
-new PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaSharpsmootherPresetDef(),
-new PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaPresetDef(),
-new PresetsTvoutTvoutNesColorDecoderPresetDef(),
-new PresetsTvoutTvoutNtsc256pxCompositePresetDef(),
-new PresetsTvoutTvoutNtsc256pxSvideoPresetDef(),
-new PresetsTvoutTvoutNtsc2phaseCompositePresetDef(),
-new PresetsTvoutTvoutNtsc2phaseSvideoPresetDef(),
-new PresetsTvoutTvoutNtsc320pxCompositePresetDef(),
-new PresetsTvoutTvoutNtsc320pxSvideoPresetDef(),
-new PresetsTvoutTvoutNtsc3phaseCompositePresetDef(),
-new PresetsTvoutTvoutNtsc3phaseSvideoPresetDef(),
-new PresetsTvoutTvoutNtscNesPresetDef(),
-new PresetsTvoutTvoutSnesHiresBlendPresetDef(),
-new PresetsTvoutTvoutJincSharpenPresetDef(),
-new PresetsTvoutTvoutPixelsharpPresetDef(),
-new PresetsTvoutTvoutPresetDef(),
-new PresetsTvoutInterlacingTvoutInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNesColorDecoderInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc256pxCompositeInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc256pxSvideoInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc2phaseCompositeInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc2phaseSvideoInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc320pxCompositeInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc320pxSvideoInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc3phaseCompositeInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc3phaseSvideoInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtscNesInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutJincSharpenInterlacingPresetDef(),
-new PresetsXbrXsalXbrLv32xsalLv2AaSoftPresetDef(),
-new PresetsXbrXsalXbrLv32xsalLv2AaPresetDef(),
-new PresetsXbrXsalXbrLv3AaFastPresetDef(),
-new PresetsXbrXsalXbrLv3AaSoftFastPresetDef(),
-new ReshadeBlendoverlayPresetDef(),
-new ReshadeBloomPresetDef(),
-new ReshadeBsnesGammaRampPresetDef(),
-new ReshadeFilmGrainPresetDef(),
-new ReshadeHalftonePrintPresetDef(),
-new ReshadeHandheldColorLUTsDSLite2020PresetDef(),
-new ReshadeHandheldColorLUTsDSLiteP3PresetDef(),
-new ReshadeHandheldColorLUTsDSLiteSRGBPresetDef(),
-new ReshadeHandheldColorLUTsGBA2020PresetDef(),
-new ReshadeHandheldColorLUTsGBAP3DarkPresetDef(),
-new ReshadeHandheldColorLUTsGBAP3PresetDef(),
-new ReshadeHandheldColorLUTsGBARec2020DarkPresetDef(),
-new ReshadeHandheldColorLUTsGBARec2020PresetDef(),
-new ReshadeHandheldColorLUTsGBASRGBDarkPresetDef(),
-new ReshadeHandheldColorLUTsGBASRGBPresetDef(),
-new ReshadeHandheldColorLUTsGBA_GBC2020PresetDef(),
-new ReshadeHandheldColorLUTsGBA_GBCP3PresetDef(),
-new ReshadeHandheldColorLUTsGBA_GBCSRGBPresetDef(),
-new ReshadeHandheldColorLUTsGBCDevColorspacePresetDef(),
-new ReshadeHandheldColorLUTsGBC2020PresetDef(),
-new ReshadeHandheldColorLUTsGBCP3PresetDef(),
-new ReshadeHandheldColorLUTsGBCRec2020PresetDef(),
-new ReshadeHandheldColorLUTsGBCSRGBPresetDef(),
-new ReshadeHandheldColorLUTsGBMicro2020PresetDef(),
-new ReshadeHandheldColorLUTsGBMicroP3PresetDef(),
-new ReshadeHandheldColorLUTsGBMicroSRGBPresetDef(),
-new ReshadeHandheldColorLUTsNDS2020PresetDef(),
-new ReshadeHandheldColorLUTsNDSP3PresetDef(),
-new ReshadeHandheldColorLUTsNDSRec2020PresetDef(),
-new ReshadeHandheldColorLUTsNDSSRGBPresetDef(),
-new ReshadeHandheldColorLUTsNSOGBAPresetDef(),
-new ReshadeHandheldColorLUTsNSOGBCPresetDef(),
-new ReshadeHandheldColorLUTsPSP2020PresetDef(),
-new ReshadeHandheldColorLUTsPSPP3PureGamma22PresetDef(),
-new ReshadeHandheldColorLUTsPSPP3PresetDef(),
-new ReshadeHandheldColorLUTsPSPRec2020SRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsPSPRec2020PresetDef(),
-new ReshadeHandheldColorLUTsPSPSRGBSRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsPSPSRGBPresetDef(),
-new ReshadeHandheldColorLUTsSP1012020PresetDef(),
-new ReshadeHandheldColorLUTsSP101P3PresetDef(),
-new ReshadeHandheldColorLUTsSP101SRGBPresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDP3SRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDP3PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDRec2020SRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDRec2020PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDSRGBSRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDSRGBPresetDef(),
-new ReshadeHandheldColorLUTsSWOLED2020PresetDef(),
-new ReshadeHandheldColorLUTsSWOLEDP3PresetDef(),
-new ReshadeHandheldColorLUTsSWOLEDSRGBPresetDef(),
-new ReshadeHandheldColorLUTsVBAColorspacePresetDef(),
-new ReshadeLutPresetDef(),
-new ReshadeMagicbloomPresetDef(),
-new ReshadeNormalsDisplacementPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCArcadeCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCArcadeDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCArcadeRGBPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCDOSHighResCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCDOSHighResDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCDOSLowResCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCDOSLowResDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCDreamcastCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCDreamcastDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCGBACleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCGBADirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCMasterSystemCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCMasterSystemDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCMegaDriveCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCMegaDriveDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCMegaDriveRF100PresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCMegaDriveRGB100PresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCN64PresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCNESCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCNESDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCNESComposite100PresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCNESRGB100PresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPCEComposite100PresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPCERGB100PresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPCEPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPlayStationCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPlayStationDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPlayStationRGB100240pPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPlayStationRGB100480iPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPS2CleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPS2DirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCPS2PresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCSaturnPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCSGBCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCSGBDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCSNESCleanPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCSNESDirtyPresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCSNESRF100PresetDef(),
-new RetroCrisis1080pCurvedRCGDVNTSCSNESRGB100PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCArcadeCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCArcadeDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCArcadeRGBPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCDOSHighResCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCDOSHighResDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCDOSLowResCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCDOSLowResDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCDreamcastCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCDreamcastDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCGBACleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCGBADirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCMasterSystemCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCMasterSystemDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCMegaDriveCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCMegaDriveDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCMegaDriveRF100PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCMegaDriveRGB100PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCN64PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCNESCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCNESDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCNESComposite100PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCNESRGB100PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPCEComposite100PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPCERGB100PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPCEPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPlayStationCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPlayStationDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPlayStationRGB100240pPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPlayStationRGB100480iPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPS2CleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPS2DirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCPS2PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCSaturnPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCSGBCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCSGBDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCSNESCleanPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCSNESDirtyPresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCSNESRF100PresetDef(),
-new RetroCrisis1080pFlatRCGDVNTSCSNESRGB100PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCArcadeCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCArcadeDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCArcadeRGBPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCDOSHighResCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCDOSHighResDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCDOSLowResCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCDOSLowResDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCDreamcastCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCDreamcastDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCGBACleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCGBADirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCMasterSystemCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCMasterSystemDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCMegaDriveCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCMegaDriveDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCMegaDriveRF100PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCMegaDriveRGB100PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCN64PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCNESCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCNESDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCNESComposite100PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCNESRGB100PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPCEComposite100PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPCERGB100PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPCEPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPlayStationCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPlayStationDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPlayStationRGB100240pPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPlayStationRGB100480iPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPS2CleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPS2DirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCPS2PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCSaturnPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCSGBCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCSGBDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCSNESCleanPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCSNESDirtyPresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCSNESRF100PresetDef(),
-new RetroCrisis1440pCurvedRCGDVNTSCSNESRGB100PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCArcadeCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCArcadeDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCArcadeRGBPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCDOSHighResCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCDOSHighResDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCDOSLowResCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCDOSLowResDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCDreamcastCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCDreamcastDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCGBACleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCGBADirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCMasterSystemCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCMasterSystemDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCMegaDriveCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCMegaDriveDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCMegaDriveRF100PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCMegaDriveRGB100PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCN64PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCNESCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCNESDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCNESComposite100PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCNESRGB100PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPCEComposite100PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPCERGB100PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPCEPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPlayStationCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPlayStationDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPlayStationRGB100240pPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPlayStationRGB100480iPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPS2CleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPS2DirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCPS2PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCSaturnPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCSGBCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCSGBDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCSNESCleanPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCSNESDirtyPresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCSNESRF100PresetDef(),
-new RetroCrisis1440pFlatRCGDVNTSCSNESRGB100PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCArcadeCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCArcadeDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCArcadeRGBPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCDOSHighResCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCDOSHighResDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCDOSLowResCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCDOSLowResDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCDreamcastCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCDreamcastDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCGBACleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCGBADirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCMasterSystemCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCMasterSystemDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCMegaDriveCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCMegaDriveDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCMegaDriveRF100PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCMegaDriveRGB100PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCN64PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCNESCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCNESDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCNESComposite100PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCNESRGB100PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPCEComposite100PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPCERGB100PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPCEPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPlayStationCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPlayStationDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPlayStationRGB100240pPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPlayStationRGB100480iPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPS2CleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPS2DirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCPS2PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCSaturnPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCSGBCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCSGBDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCSNESCleanPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCSNESDirtyPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCSNESRF100PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCSNESRGB100PresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCVHS1080pCurvedPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCVHS2160pCurvedPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCVHS240pCurvedPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCVHS360pCurvedPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCVHS480pCurvedPresetDef(),
-new RetroCrisis4KCurvedRCGDVNTSCVHS720pCurvedPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCArcadeCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCArcadeDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCArcadeRGBPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCDOSHighResCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCDOSHighResDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCDOSLowResCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCDOSLowResDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCDreamcastCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCDreamcastDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCGBACleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCGBADirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCMasterSystemCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCMasterSystemDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCMegaDriveCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCMegaDriveDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCMegaDriveRF100PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCMegaDriveRGB100PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCN64PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCNESCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCNESDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCNESComposite100PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCNESRGB100PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPCEComposite100PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPCERGB100PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPCEPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPlayStationCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPlayStationDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPlayStationRGB100240pPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPlayStationRGB100480iPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPS2CleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPS2DirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCPS2PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCSaturnPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCSGBCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCSGBDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCSNESCleanPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCSNESDirtyPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCSNESRF100PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCSNESRGB100PresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCVHS1080pPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCVHS2160pPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCVHS240pPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCVHS360pPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCVHS480pPresetDef(),
-new RetroCrisis4KFlatRCGDVNTSCVHS720pPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCArcadeCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCArcadeDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCArcadeRGBPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCDOSHighResCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCDOSHighResDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCDOSLowResCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCDOSLowResDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCDreamcastCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCDreamcastDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCGBACleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCGBADirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCMasterSystemCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCMasterSystemDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCMegaDriveCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCMegaDriveDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCMegaDriveRF100PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCMegaDriveRGB100PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCN64PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCNESCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCNESDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCNESComposite100PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCNESRGB100PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPCEComposite100PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPCERGB100PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPCEPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPlayStationCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPlayStationDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPlayStationRGB100240pPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPlayStationRGB100480iPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPS2CleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPS2DirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCPS2PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCSaturnPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCSGBCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCSGBDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCSNESCleanPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCSNESDirtyPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCSNESRF100PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCSNESRGB100PresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCVHS1080pPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCVHS2160pPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCVHS240pPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCVHS360pPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCVHS480pPresetDef(),
-new RetroCrisis720pSteamDeckRCGDVNTSCVHS720pPresetDef(),
-new ScanlinesIntegerScalingScanlinesPresetDef(),
-new ScanlinesOsscPresetDef(),
-new ScanlinesOssc_slotPresetDef(),
-new ScanlinesResIndependentScanlinesPresetDef(),
-new ScanlinesScanlineFractPresetDef(),
-new ScanlinesScanlinePresetDef(),
-new ScanlinesScanlinesRerePresetDef(),
-new ScanlinesScanlinesSineAbsPresetDef(),
-new SharpenAdaptiveSharpenMultipassPresetDef(),
-new SharpenAdaptiveSharpenPresetDef(),
-new SharpenAnime4kPresetDef(),
-new SharpenCheapSharpenPresetDef(),
-new SharpenRca_sharpenPresetDef(),
-new SharpenSuperXbrSuperResPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p011080pCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p021080pCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p031080pCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p041080pCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p051080pCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p061080pCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p071080pCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p081080pCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p091080pCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p101080pCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p111080pCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p121080pCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p131080pCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p141080pCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p151080pCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p161080pCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p171080pCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p181080pCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p191080pCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p201080pCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p211080pCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p221080pCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p231080pCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p241080pCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p251080pCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p261080pCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p271080pCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p281080pCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p291080pCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p301080pCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p311080pCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p321080pCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p331080pCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p341080pCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p351080pCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p361080pCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p371080pCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p381080pCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p391080pCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p401080pCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p411080pCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p421080pCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p431080pCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p441080pCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1080p451080pCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p011440pCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p021440pCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p031440pCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p041440pCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p051440pCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p061440pCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p071440pCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p081440pCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p091440pCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p101440pCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p111440pCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p121440pCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p131440pCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p141440pCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p151440pCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p161440pCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p171440pCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p181440pCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p191440pCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p201440pCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p211440pCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p221440pCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p231440pCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p241440pCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p251440pCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p261440pCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p271440pCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p281440pCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p291440pCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p301440pCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p311440pCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p321440pCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p331440pCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p341440pCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p351440pCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p361440pCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p371440pCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p381440pCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p391440pCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p401440pCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p411440pCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p421440pCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p431440pCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p441440pCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen1440p451440pCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k014kCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k024kCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen4k034kCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k044kCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k054kCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k064kCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k074kCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen4k084kCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k094kCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k104kCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k114kCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k124kCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen4k134kCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k144kCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k154kCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k164kCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k174kCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen4k184kCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k194kCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k204kCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k214kCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k224kCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen4k234kCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k244kCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k254kCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k264kCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k274kCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen4k284kCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k294kCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k304kCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k314kCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k324kCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen4k334kCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k344kCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k354kCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k364kCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k374kCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen4k384kCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k394kCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k404kCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k414kCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k424kCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef(),
-new SonkunApertureGrilleCurvedScreen4k434kCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k444kCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef(),
-new SonkunApertureGrilleCurvedScreen4k454kCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p011080pCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p021080pCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1080p031080pCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p041080pCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p051080pCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p061080pCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p071080pCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1080p081080pCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p091080pCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p101080pCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p111080pCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p121080pCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1080p131080pCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p141080pCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p151080pCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p161080pCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p171080pCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1080p181080pCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p191080pCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p201080pCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p211080pCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p221080pCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1080p231080pCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p241080pCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p251080pCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p261080pCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p271080pCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1080p281080pCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p291080pCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p301080pCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p311080pCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p321080pCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1080p331080pCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p341080pCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p351080pCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p361080pCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p371080pCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1080p381080pCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p391080pCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p401080pCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p411080pCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p421080pCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1080p431080pCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p441080pCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1080p451080pCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p011440pCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p021440pCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1440p031440pCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p041440pCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p051440pCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p061440pCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p071440pCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1440p081440pCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p091440pCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p101440pCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p111440pCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p121440pCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1440p131440pCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p141440pCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p151440pCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p161440pCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p171440pCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1440p181440pCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p191440pCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p201440pCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p211440pCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p221440pCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1440p231440pCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p241440pCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p251440pCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p261440pCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p271440pCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1440p281440pCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p291440pCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p301440pCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p311440pCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p321440pCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1440p331440pCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p341440pCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p351440pCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p361440pCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p371440pCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1440p381440pCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p391440pCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p401440pCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p411440pCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p421440pCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen1440p431440pCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p441440pCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen1440p451440pCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen4k014kCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef(),
-new SonkunApertureGrilleFlatScreen4k024kCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen4k034kCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen4k044kCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen4k054kCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen4k064kCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef(),
-new SonkunApertureGrilleFlatScreen4k074kCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen4k084kCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen4k094kCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen4k104kCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen4k114kCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef(),
-new SonkunApertureGrilleFlatScreen4k124kCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen4k134kCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen4k144kCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen4k154kCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen4k164kCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef(),
-new SonkunApertureGrilleFlatScreen4k174kCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen4k184kCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen4k194kCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen4k204kCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen4k214kCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef(),
-new SonkunApertureGrilleFlatScreen4k224kCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen4k234kCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen4k244kCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen4k254kCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen4k264kCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef(),
-new SonkunApertureGrilleFlatScreen4k274kCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen4k284kCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen4k294kCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen4k304kCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen4k314kCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef(),
-new SonkunApertureGrilleFlatScreen4k324kCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen4k334kCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen4k344kCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen4k354kCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen4k364kCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef(),
-new SonkunApertureGrilleFlatScreen4k374kCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen4k384kCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen4k394kCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen4k404kCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef(),
-new SonkunApertureGrilleFlatScreen4k414kCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef(),
-new SonkunApertureGrilleFlatScreen4k424kCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef(),
-new SonkunApertureGrilleFlatScreen4k434kCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunApertureGrilleFlatScreen4k444kCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef(),
-new SonkunApertureGrilleFlatScreen4k454kCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p011080pCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p021080pCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1080p031080pCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p041080pCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p051080pCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p061080pCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p071080pCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1080p081080pCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p091080pCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p101080pCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p111080pCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p121080pCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1080p131080pCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p141080pCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p151080pCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p161080pCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p171080pCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1080p181080pCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p191080pCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p201080pCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p211080pCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p221080pCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1080p231080pCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p241080pCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p251080pCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p261080pCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p271080pCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1080p281080pCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p291080pCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p301080pCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p311080pCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p321080pCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1080p331080pCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p341080pCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p351080pCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p361080pCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p371080pCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1080p381080pCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p391080pCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p401080pCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p411080pCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p421080pCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1080p431080pCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p441080pCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1080p451080pCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p011440pCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p021440pCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1440p031440pCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p041440pCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p051440pCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p061440pCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p071440pCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1440p081440pCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p091440pCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p101440pCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p111440pCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p121440pCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1440p131440pCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p141440pCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p151440pCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p161440pCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p171440pCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1440p181440pCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p191440pCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p201440pCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p211440pCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p221440pCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1440p231440pCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p241440pCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p251440pCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p261440pCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p271440pCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1440p281440pCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p291440pCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p301440pCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p311440pCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p321440pCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1440p331440pCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p341440pCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p351440pCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p361440pCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p371440pCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1440p381440pCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p391440pCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p401440pCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p411440pCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p421440pCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen1440p431440pCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p441440pCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen1440p451440pCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen4k014kCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef(),
-new SonkunShadowMaskCurvedScreen4k024kCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen4k034kCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen4k044kCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen4k054kCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen4k064kCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef(),
-new SonkunShadowMaskCurvedScreen4k074kCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen4k084kCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen4k094kCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen4k104kCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen4k114kCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef(),
-new SonkunShadowMaskCurvedScreen4k124kCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen4k134kCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen4k144kCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen4k154kCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen4k164kCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef(),
-new SonkunShadowMaskCurvedScreen4k174kCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen4k184kCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen4k194kCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen4k204kCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen4k214kCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef(),
-new SonkunShadowMaskCurvedScreen4k224kCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen4k234kCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen4k244kCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen4k254kCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen4k264kCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef(),
-new SonkunShadowMaskCurvedScreen4k274kCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen4k284kCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen4k294kCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen4k304kCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen4k314kCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef(),
-new SonkunShadowMaskCurvedScreen4k324kCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen4k334kCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen4k344kCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen4k354kCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen4k364kCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef(),
-new SonkunShadowMaskCurvedScreen4k374kCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen4k384kCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen4k394kCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen4k404kCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef(),
-new SonkunShadowMaskCurvedScreen4k414kCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef(),
-new SonkunShadowMaskCurvedScreen4k424kCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef(),
-new SonkunShadowMaskCurvedScreen4k434kCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskCurvedScreen4k444kCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef(),
-new SonkunShadowMaskCurvedScreen4k454kCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1080p011080pCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef(),
-new SonkunShadowMaskFlatScreen1080p021080pCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1080p031080pCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1080p041080pCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1080p051080pCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1080p061080pCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef(),
-new SonkunShadowMaskFlatScreen1080p071080pCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1080p081080pCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1080p091080pCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1080p101080pCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1080p111080pCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef(),
-new SonkunShadowMaskFlatScreen1080p121080pCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1080p131080pCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1080p141080pCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1080p151080pCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1080p161080pCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef(),
-new SonkunShadowMaskFlatScreen1080p171080pCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1080p181080pCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1080p191080pCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1080p201080pCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1080p211080pCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef(),
-new SonkunShadowMaskFlatScreen1080p221080pCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1080p231080pCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1080p241080pCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1080p251080pCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1080p261080pCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef(),
-new SonkunShadowMaskFlatScreen1080p271080pCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1080p281080pCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1080p291080pCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1080p301080pCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1080p311080pCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef(),
-new SonkunShadowMaskFlatScreen1080p321080pCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1080p331080pCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1080p341080pCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1080p351080pCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1080p361080pCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef(),
-new SonkunShadowMaskFlatScreen1080p371080pCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1080p381080pCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1080p391080pCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1080p401080pCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1080p411080pCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef(),
-new SonkunShadowMaskFlatScreen1080p421080pCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1080p431080pCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1080p441080pCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1080p451080pCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1440p011440pCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef(),
-new SonkunShadowMaskFlatScreen1440p021440pCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1440p031440pCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1440p041440pCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1440p051440pCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1440p061440pCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef(),
-new SonkunShadowMaskFlatScreen1440p071440pCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1440p081440pCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1440p091440pCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1440p101440pCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1440p111440pCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef(),
-new SonkunShadowMaskFlatScreen1440p121440pCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1440p131440pCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1440p141440pCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1440p151440pCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1440p161440pCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef(),
-new SonkunShadowMaskFlatScreen1440p171440pCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1440p181440pCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1440p191440pCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1440p201440pCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1440p211440pCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef(),
-new SonkunShadowMaskFlatScreen1440p221440pCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1440p231440pCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1440p241440pCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1440p251440pCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1440p261440pCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef(),
-new SonkunShadowMaskFlatScreen1440p271440pCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1440p281440pCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1440p291440pCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1440p301440pCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1440p311440pCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef(),
-new SonkunShadowMaskFlatScreen1440p321440pCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1440p331440pCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1440p341440pCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1440p351440pCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1440p361440pCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef(),
-new SonkunShadowMaskFlatScreen1440p371440pCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1440p381440pCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1440p391440pCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1440p401440pCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef(),
-new SonkunShadowMaskFlatScreen1440p411440pCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef(),
-new SonkunShadowMaskFlatScreen1440p421440pCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef(),
-new SonkunShadowMaskFlatScreen1440p431440pCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen1440p441440pCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen1440p451440pCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef(),
-new SonkunShadowMaskFlatScreen4k014kCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef(),
-new SonkunShadowMaskFlatScreen4k024kCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef(),
-new SonkunShadowMaskFlatScreen4k034kCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen4k044kCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen4k054kCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef(),
-new SonkunShadowMaskFlatScreen4k064kCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef(),
-new SonkunShadowMaskFlatScreen4k074kCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef(),
-new SonkunShadowMaskFlatScreen4k084kCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen4k094kCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen4k104kCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef(),
-new SonkunShadowMaskFlatScreen4k114kCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef(),
-new SonkunShadowMaskFlatScreen4k124kCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef(),
-new SonkunShadowMaskFlatScreen4k134kCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen4k144kCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen4k154kCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef(),
-new SonkunShadowMaskFlatScreen4k164kCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef(),
-new SonkunShadowMaskFlatScreen4k174kCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef(),
-new SonkunShadowMaskFlatScreen4k184kCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen4k194kCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen4k204kCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef(),
-new SonkunShadowMaskFlatScreen4k214kCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef(),
-new SonkunShadowMaskFlatScreen4k224kCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef(),
-new SonkunShadowMaskFlatScreen4k234kCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen4k244kCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen4k254kCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef(),
-new SonkunShadowMaskFlatScreen4k264kCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef(),
-new SonkunShadowMaskFlatScreen4k274kCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef(),
-new SonkunShadowMaskFlatScreen4k284kCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen4k294kCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen4k304kCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef(),
-new SonkunShadowMaskFlatScreen4k314kCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef(),
-new SonkunShadowMaskFlatScreen4k324kCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef(),
-new SonkunShadowMaskFlatScreen4k334kCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen4k344kCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen4k354kCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef(),
-new SonkunShadowMaskFlatScreen4k364kCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef(),
-new SonkunShadowMaskFlatScreen4k374kCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef(),
-new SonkunShadowMaskFlatScreen4k384kCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen4k394kCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen4k404kCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef(),
-new SonkunShadowMaskFlatScreen4k414kCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef(),
-new SonkunShadowMaskFlatScreen4k424kCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef(),
-new SonkunShadowMaskFlatScreen4k434kCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunShadowMaskFlatScreen4k444kCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef(),
-new SonkunShadowMaskFlatScreen4k454kCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p011080pCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p021080pCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1080p031080pCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p041080pCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p051080pCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p061080pCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p071080pCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1080p081080pCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p091080pCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p101080pCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p111080pCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p121080pCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1080p131080pCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p141080pCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p151080pCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p161080pCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p171080pCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1080p181080pCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p191080pCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p201080pCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p211080pCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p221080pCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1080p231080pCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p241080pCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p251080pCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p261080pCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p271080pCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1080p281080pCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p291080pCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p301080pCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p311080pCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p321080pCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1080p331080pCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p341080pCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p351080pCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p361080pCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p371080pCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1080p381080pCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p391080pCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p401080pCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p411080pCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p421080pCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1080p431080pCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p441080pCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1080p451080pCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p011440pCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p021440pCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1440p031440pCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p041440pCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p051440pCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p061440pCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p071440pCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1440p081440pCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p091440pCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p101440pCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p111440pCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p121440pCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1440p131440pCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p141440pCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p151440pCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p161440pCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p171440pCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1440p181440pCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p191440pCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p201440pCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p211440pCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p221440pCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1440p231440pCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p241440pCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p251440pCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p261440pCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p271440pCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1440p281440pCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p291440pCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p301440pCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p311440pCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p321440pCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1440p331440pCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p341440pCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p351440pCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p361440pCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p371440pCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1440p381440pCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p391440pCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p401440pCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p411440pCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p421440pCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen1440p431440pCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p441440pCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen1440p451440pCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen4k014kCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef(),
-new SonkunSlotMaskCurvedScreen4k024kCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen4k034kCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen4k044kCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen4k054kCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen4k064kCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef(),
-new SonkunSlotMaskCurvedScreen4k074kCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen4k084kCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen4k094kCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen4k104kCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen4k114kCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef(),
-new SonkunSlotMaskCurvedScreen4k124kCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen4k134kCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen4k144kCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen4k154kCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen4k164kCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef(),
-new SonkunSlotMaskCurvedScreen4k174kCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen4k184kCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen4k194kCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen4k204kCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen4k214kCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef(),
-new SonkunSlotMaskCurvedScreen4k224kCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen4k234kCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen4k244kCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen4k254kCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen4k264kCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef(),
-new SonkunSlotMaskCurvedScreen4k274kCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen4k284kCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen4k294kCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen4k304kCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen4k314kCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef(),
-new SonkunSlotMaskCurvedScreen4k324kCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen4k334kCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen4k344kCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen4k354kCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen4k364kCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef(),
-new SonkunSlotMaskCurvedScreen4k374kCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen4k384kCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen4k394kCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen4k404kCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef(),
-new SonkunSlotMaskCurvedScreen4k414kCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef(),
-new SonkunSlotMaskCurvedScreen4k424kCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef(),
-new SonkunSlotMaskCurvedScreen4k434kCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskCurvedScreen4k444kCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef(),
-new SonkunSlotMaskCurvedScreen4k454kCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1080p011080pCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef(),
-new SonkunSlotMaskFlatScreen1080p021080pCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1080p031080pCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1080p041080pCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1080p051080pCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1080p061080pCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef(),
-new SonkunSlotMaskFlatScreen1080p071080pCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1080p081080pCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1080p091080pCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1080p101080pCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1080p111080pCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef(),
-new SonkunSlotMaskFlatScreen1080p121080pCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1080p131080pCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1080p141080pCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1080p151080pCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1080p161080pCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef(),
-new SonkunSlotMaskFlatScreen1080p171080pCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1080p181080pCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1080p191080pCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1080p201080pCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1080p211080pCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef(),
-new SonkunSlotMaskFlatScreen1080p221080pCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1080p231080pCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1080p241080pCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1080p251080pCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1080p261080pCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef(),
-new SonkunSlotMaskFlatScreen1080p271080pCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1080p281080pCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1080p291080pCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1080p301080pCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1080p311080pCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef(),
-new SonkunSlotMaskFlatScreen1080p321080pCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1080p331080pCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1080p341080pCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1080p351080pCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1080p361080pCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef(),
-new SonkunSlotMaskFlatScreen1080p371080pCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1080p381080pCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1080p391080pCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1080p401080pCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1080p411080pCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef(),
-new SonkunSlotMaskFlatScreen1080p421080pCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1080p431080pCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1080p441080pCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1080p451080pCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1440p011440pCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef(),
-new SonkunSlotMaskFlatScreen1440p021440pCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1440p031440pCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1440p041440pCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1440p051440pCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1440p061440pCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef(),
-new SonkunSlotMaskFlatScreen1440p071440pCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1440p081440pCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1440p091440pCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1440p101440pCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1440p111440pCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef(),
-new SonkunSlotMaskFlatScreen1440p121440pCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1440p131440pCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1440p141440pCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1440p151440pCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1440p161440pCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef(),
-new SonkunSlotMaskFlatScreen1440p171440pCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1440p181440pCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1440p191440pCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1440p201440pCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1440p211440pCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef(),
-new SonkunSlotMaskFlatScreen1440p221440pCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1440p231440pCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1440p241440pCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1440p251440pCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1440p261440pCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef(),
-new SonkunSlotMaskFlatScreen1440p271440pCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1440p281440pCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1440p291440pCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1440p301440pCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1440p311440pCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef(),
-new SonkunSlotMaskFlatScreen1440p321440pCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1440p331440pCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1440p341440pCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1440p351440pCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1440p361440pCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef(),
-new SonkunSlotMaskFlatScreen1440p371440pCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1440p381440pCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1440p391440pCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1440p401440pCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef(),
-new SonkunSlotMaskFlatScreen1440p411440pCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef(),
-new SonkunSlotMaskFlatScreen1440p421440pCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef(),
-new SonkunSlotMaskFlatScreen1440p431440pCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen1440p441440pCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen1440p451440pCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef(),
-new SonkunSlotMaskFlatScreen4k014kCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef(),
-new SonkunSlotMaskFlatScreen4k024kCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef(),
-new SonkunSlotMaskFlatScreen4k034kCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen4k044kCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen4k054kCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef(),
-new SonkunSlotMaskFlatScreen4k064kCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef(),
-new SonkunSlotMaskFlatScreen4k074kCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef(),
-new SonkunSlotMaskFlatScreen4k084kCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen4k094kCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen4k104kCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef(),
-new SonkunSlotMaskFlatScreen4k114kCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef(),
-new SonkunSlotMaskFlatScreen4k124kCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef(),
-new SonkunSlotMaskFlatScreen4k134kCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen4k144kCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen4k154kCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef(),
-new SonkunSlotMaskFlatScreen4k164kCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef(),
-new SonkunSlotMaskFlatScreen4k174kCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef(),
-new SonkunSlotMaskFlatScreen4k184kCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen4k194kCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen4k204kCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef(),
-new SonkunSlotMaskFlatScreen4k214kCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef(),
-new SonkunSlotMaskFlatScreen4k224kCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef(),
-new SonkunSlotMaskFlatScreen4k234kCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen4k244kCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen4k254kCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef(),
-new SonkunSlotMaskFlatScreen4k264kCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef(),
-new SonkunSlotMaskFlatScreen4k274kCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef(),
-new SonkunSlotMaskFlatScreen4k284kCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen4k294kCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen4k304kCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef(),
-new SonkunSlotMaskFlatScreen4k314kCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef(),
-new SonkunSlotMaskFlatScreen4k324kCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef(),
-new SonkunSlotMaskFlatScreen4k334kCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen4k344kCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen4k354kCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef(),
-new SonkunSlotMaskFlatScreen4k364kCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef(),
-new SonkunSlotMaskFlatScreen4k374kCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef(),
-new SonkunSlotMaskFlatScreen4k384kCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen4k394kCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen4k404kCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef(),
-new SonkunSlotMaskFlatScreen4k414kCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef(),
-new SonkunSlotMaskFlatScreen4k424kCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef(),
-new SonkunSlotMaskFlatScreen4k434kCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef(),
-new SonkunSlotMaskFlatScreen4k444kCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef(),
-new SonkunSlotMaskFlatScreen4k454kCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef(),
-new Stereoscopic3dAnaglyphToInterlacedPresetDef(),
-new Stereoscopic3dAnaglyphToSideBySidePresetDef(),
-new Stereoscopic3dFubax_vrPresetDef(),
-new Stereoscopic3dShutterToAnaglyphPresetDef(),
-new Stereoscopic3dShutterToSideBySidePresetDef(),
-new Stereoscopic3dSideBySideSimplePresetDef(),
-new Stereoscopic3dSideBySideToInterlacedPresetDef(),
-new Stereoscopic3dSideBySideToShutterPresetDef(),
-new VhsGristleVHSPresetDef(),
-new VhsMudlordPalVhsPresetDef(),
-new VhsNtscVcrPresetDef(),
-new VhsVhsPresetDef(),
-new VhsVHSProPresetDef(),
-new VhsVhs_and_crt_godotPresetDef(),
-new VhsVhs_mpalkoPresetDef(),
-new WarpDilationPresetDef(),
+constexpr PresetInfo PresetList[] = {
+{"anamorphic", "anamorphic", 0.0f, CreatePreset<AnamorphicAnamorphicPresetDef>},
+{"aa-shader-4.0-level2", "anti-aliasing", 0.0f, CreatePreset<AntiAliasingAaShader40Level2PresetDef>},
+{"aa-shader-4.0", "anti-aliasing", 0.0f, CreatePreset<AntiAliasingAaShader40PresetDef>},
+{"advanced-aa", "anti-aliasing", 0.0f, CreatePreset<AntiAliasingAdvancedAaPresetDef>},
+{"fxaa+linear", "anti-aliasing", 0.0f, CreatePreset<AntiAliasingFxaaLinearPresetDef>},
+{"fxaa", "anti-aliasing", 0.0f, CreatePreset<AntiAliasingFxaaPresetDef>},
+{"reverse-aa", "anti-aliasing", 0.0f, CreatePreset<AntiAliasingReverseAaPresetDef>},
+{"smaa+linear", "anti-aliasing", 0.0f, CreatePreset<AntiAliasingSmaaLinearPresetDef>},
+{"smaa+sharpen", "anti-aliasing", 0.0f, CreatePreset<AntiAliasingSmaaSharpenPresetDef>},
+{"smaa", "anti-aliasing", 0.0f, CreatePreset<AntiAliasingSmaaPresetDef>},
+{"koko-aio-ng", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioKokoAioNgPresetDef>},
+{"Base", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgBasePresetDef>},
+{"Monitor-Ambilight-immersive", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorAmbilightImmersivePresetDef>},
+{"Monitor-Balanced", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorBalancedPresetDef>},
+{"Monitor-for_1440pMin_HiNits", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorFor_1440pMin_HiNitsPresetDef>},
+{"Monitor-for_HigherNits", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorFor_HigherNitsPresetDef>},
+{"Monitor-FXAA_sharp-aperturegrille", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorFXAA_sharpAperturegrillePresetDef>},
+{"Monitor-FXAA_sharp-Core_SlotMask", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorFXAA_sharpCore_SlotMaskPresetDef>},
+{"Monitor-FXAA_sharp-Screen_SlotMask", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorFXAA_sharpScreen_SlotMaskPresetDef>},
+{"Monitor-New_aperturegrille_gm", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorNew_aperturegrille_gmPresetDef>},
+{"Monitor-New_slotmask_gm", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorNew_slotmask_gmPresetDef>},
+{"Monitor-New_slotmask_rgb", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorNew_slotmask_rgbPresetDef>},
+{"Monitor-Screen_Hmask-Aperturegrille-Overmask", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_HmaskAperturegrilleOvermaskPresetDef>},
+{"Monitor-Screen_Hmask-Aperturegrille", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_HmaskAperturegrillePresetDef>},
+{"Monitor-Screen_Hmask-Core_SlotMask-Overmask", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_HmaskCore_SlotMaskOvermaskPresetDef>},
+{"Monitor-Screen_Hmask-Core_SlotMask", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_HmaskCore_SlotMaskPresetDef>},
+{"Monitor-Screen_Hmask-Screen_SlotMask-Chameleon", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_HmaskScreen_SlotMaskChameleonPresetDef>},
+{"Monitor-Screen_Hmask-Screen_SlotMask", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_HmaskScreen_SlotMaskPresetDef>},
+{"Monitor-Screen_Hmask-Screen_SlotMask_Taller", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_HmaskScreen_SlotMask_TallerPresetDef>},
+{"Monitor-Screen_Hmask-Screen_SlotMask_Taller_Brighter", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_HmaskScreen_SlotMask_Taller_BrighterPresetDef>},
+{"Monitor-Screen_Hmask-ShadowMask", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_HmaskShadowMaskPresetDef>},
+{"Monitor-Screen_Hmask_Overlapped-oldpainless", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorScreen_Hmask_OverlappedOldpainlessPresetDef>},
+{"Monitor-slotmask-TVL410", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgMonitorSlotmaskTVL410PresetDef>},
+{"Tv-NTSC_Generic-AA_sharp-Selective", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgTVTvNTSC_GenericAA_sharpSelectivePresetDef>},
+{"Tv-NTSC_Megadrive-AA_sharp-Selective", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgTVTvNTSC_MegadriveAA_sharpSelectivePresetDef>},
+{"Vector_neon_4_mame2003plus_defaults", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgVectorGFXVector_neon_4_mame2003plus_defaultsPresetDef>},
+{"Vector_std_4_mame2003plus_defaults", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgVectorGFXVector_std_4_mame2003plus_defaultsPresetDef>},
+{"Monitor-VGA-DoubleScan-Amber", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgVGAMonitorVGADoubleScanAmberPresetDef>},
+{"Monitor-VGA-DoubleScan-Green", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgVGAMonitorVGADoubleScanGreenPresetDef>},
+{"Monitor-VGA-DoubleScan-ShadowMask", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgVGAMonitorVGADoubleScanShadowMaskPresetDef>},
+{"Monitor-VGA-DoubleScan-XBR", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgVGAMonitorVGADoubleScanXBRPresetDef>},
+{"Monitor-VGA-DoubleScan", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresetsNgVGAMonitorVGADoubleScanPresetDef>},
+{"Dots_1-1", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgDots_11PresetDef>},
+{"Dots_4-3", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgDots_43PresetDef>},
+{"GameboyAdvance-Overlay-Night", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyAdvanceOverlayNightPresetDef>},
+{"GameboyAdvance-Overlay", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyAdvanceOverlayPresetDef>},
+{"GameboyAdvance", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyAdvancePresetDef>},
+{"GameboyColor-Overlay-IPS", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyColorOverlayIPSPresetDef>},
+{"GameboyColor-Overlay-Taller-IPS", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyColorOverlayTallerIPSPresetDef>},
+{"GameboyColor-Overlay-Taller", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyColorOverlayTallerPresetDef>},
+{"GameboyColor-Overlay", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyColorOverlayPresetDef>},
+{"GameboyColor", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyColorPresetDef>},
+{"GameboyMono-Overlay-Taller", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyMonoOverlayTallerPresetDef>},
+{"GameboyMono-Overlay", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyMonoOverlayPresetDef>},
+{"GameboyMono", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyMonoPresetDef>},
+{"GameboyPocket-Overlay-Taller", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyPocketOverlayTallerPresetDef>},
+{"GameboyPocket-Overlay", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyPocketOverlayPresetDef>},
+{"GameboyPocket", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameboyPocketPresetDef>},
+{"GameGear-Overlay-Night", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameGearOverlayNightPresetDef>},
+{"GameGear-Overlay", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGameGearOverlayPresetDef>},
+{"Generic-Handheld-RGB", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgGenericHandheldRGBPresetDef>},
+{"PSP-Overlay-Night-Big- Y_flip", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgPSPOverlayNightBigY_flipPresetDef>},
+{"PSP-Overlay-Night-Big", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgPSPOverlayNightBigPresetDef>},
+{"PSP-Overlay-Night-Small-Y_flip", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgPSPOverlayNightSmallY_flipPresetDef>},
+{"PSP-Overlay-Night-Small", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgPSPOverlayNightSmallPresetDef>},
+{"PSP", "bezel/koko-aio", 0.0f, CreatePreset<BezelKokoAioPresets_HandheldsNgPSPPresetDef>},
+{"MBZ__0__SMOOTH-ADV-GLASS__EASYMODE", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__EASYMODEPresetDef>},
+{"MBZ__0__SMOOTH-ADV-GLASS__GDV-MINI", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVMINIPresetDef>},
+{"MBZ__0__SMOOTH-ADV-GLASS__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVNTSCPresetDef>},
+{"MBZ__0__SMOOTH-ADV-GLASS__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVPresetDef>},
+{"MBZ__0__SMOOTH-ADV-GLASS__LCD-GRID", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__LCDGRIDPresetDef>},
+{"MBZ__0__SMOOTH-ADV-GLASS__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__MEGATRONNTSCPresetDef>},
+{"MBZ__0__SMOOTH-ADV-GLASS__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__MEGATRONPresetDef>},
+{"MBZ__0__SMOOTH-ADV-NO-REFLECT__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVNTSCPresetDef>},
+{"MBZ__0__SMOOTH-ADV-NO-REFLECT__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVPresetDef>},
+{"MBZ__0__SMOOTH-ADV-NO-REFLECT__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__MEGATRONNTSCPresetDef>},
+{"MBZ__0__SMOOTH-ADV-NO-REFLECT__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__MEGATRONPresetDef>},
+{"MBZ__0__SMOOTH-ADV-SCREEN-ONLY__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVNTSCPresetDef>},
+{"MBZ__0__SMOOTH-ADV-SCREEN-ONLY__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVPresetDef>},
+{"MBZ__0__SMOOTH-ADV-SCREEN-ONLY__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__MEGATRONNTSCPresetDef>},
+{"MBZ__0__SMOOTH-ADV-SCREEN-ONLY__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__MEGATRONPresetDef>},
+{"MBZ__0__SMOOTH-ADV__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVNTSCPresetDef>},
+{"MBZ__0__SMOOTH-ADV__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVPresetDef>},
+{"MBZ__0__SMOOTH-ADV__LCD-GRID", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__LCDGRIDPresetDef>},
+{"MBZ__0__SMOOTH-ADV__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__MEGATRONNTSCPresetDef>},
+{"MBZ__0__SMOOTH-ADV__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__MEGATRONPresetDef>},
+{"MBZ__1__ADV-RESHADE-FX__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVRESHADEFX__GDVPresetDef>},
+{"MBZ__1__ADV-SUPER-XBR__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVNTSCPresetDef>},
+{"MBZ__1__ADV-SUPER-XBR__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVPresetDef>},
+{"MBZ__1__ADV__EASYMODE", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__EASYMODEPresetDef>},
+{"MBZ__1__ADV__GDV-MINI-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMININTSCPresetDef>},
+{"MBZ__1__ADV__GDV-MINI", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMINIPresetDef>},
+{"MBZ__1__ADV__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVNTSCPresetDef>},
+{"MBZ__1__ADV__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVPresetDef>},
+{"MBZ__1__ADV__LCD-GRID", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__LCDGRIDPresetDef>},
+{"MBZ__1__ADV__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__MEGATRONNTSCPresetDef>},
+{"MBZ__1__ADV__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__MEGATRONPresetDef>},
+{"MBZ__2__ADV-GLASS-RESHADE-FX__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSRESHADEFX__GDVPresetDef>},
+{"MBZ__2__ADV-GLASS-SUPER-XBR__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVNTSCPresetDef>},
+{"MBZ__2__ADV-GLASS-SUPER-XBR__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVPresetDef>},
+{"MBZ__2__ADV-GLASS__EASYMODE", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__EASYMODEPresetDef>},
+{"MBZ__2__ADV-GLASS__GDV-MINI-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMININTSCPresetDef>},
+{"MBZ__2__ADV-GLASS__GDV-MINI", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMINIPresetDef>},
+{"MBZ__2__ADV-GLASS__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVNTSCPresetDef>},
+{"MBZ__2__ADV-GLASS__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVPresetDef>},
+{"MBZ__2__ADV-GLASS__LCD-GRID", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__LCDGRIDPresetDef>},
+{"MBZ__2__ADV-GLASS__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__MEGATRONNTSCPresetDef>},
+{"MBZ__2__ADV-GLASS__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__MEGATRONPresetDef>},
+{"MBZ__2__ADV-NO-REFLECT-SUPER-XBR__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVNTSCPresetDef>},
+{"MBZ__2__ADV-NO-REFLECT-SUPER-XBR__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVPresetDef>},
+{"MBZ__2__ADV-NO-REFLECT__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVNTSCPresetDef>},
+{"MBZ__2__ADV-NO-REFLECT__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVPresetDef>},
+{"MBZ__2__ADV-NO-REFLECT__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__MEGATRONNTSCPresetDef>},
+{"MBZ__2__ADV-NO-REFLECT__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__MEGATRONPresetDef>},
+{"MBZ__2__ADV-SCREEN-ONLY-NO-TUBE-FX__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYNOTUBEFX__GDVPresetDef>},
+{"MBZ__2__ADV-SCREEN-ONLY-SUPER-XBR__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVNTSCPresetDef>},
+{"MBZ__2__ADV-SCREEN-ONLY-SUPER-XBR__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVPresetDef>},
+{"MBZ__2__ADV-SCREEN-ONLY__GDV-MINI-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMININTSCPresetDef>},
+{"MBZ__2__ADV-SCREEN-ONLY__GDV-MINI", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMINIPresetDef>},
+{"MBZ__2__ADV-SCREEN-ONLY__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVNTSCPresetDef>},
+{"MBZ__2__ADV-SCREEN-ONLY__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVPresetDef>},
+{"MBZ__2__ADV-SCREEN-ONLY__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__MEGATRONNTSCPresetDef>},
+{"MBZ__2__ADV-SCREEN-ONLY__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__MEGATRONPresetDef>},
+{"MBZ__3__STD-GLASS-SUPER-XBR__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVNTSCPresetDef>},
+{"MBZ__3__STD-GLASS-SUPER-XBR__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVPresetDef>},
+{"MBZ__3__STD-GLASS__GDV-MINI-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMININTSCPresetDef>},
+{"MBZ__3__STD-GLASS__GDV-MINI", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMINIPresetDef>},
+{"MBZ__3__STD-GLASS__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVNTSCPresetDef>},
+{"MBZ__3__STD-GLASS__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVPresetDef>},
+{"MBZ__3__STD-GLASS__LCD-GRID", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__LCDGRIDPresetDef>},
+{"MBZ__3__STD-GLASS__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__MEGATRONNTSCPresetDef>},
+{"MBZ__3__STD-GLASS__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__MEGATRONPresetDef>},
+{"MBZ__3__STD-GLASS__PASSTHROUGH", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__PASSTHROUGHPresetDef>},
+{"MBZ__3__STD-NO-TUBE-FX__PASSTHROUGH", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDNOTUBEFX__PASSTHROUGHPresetDef>},
+{"MBZ__3__STD-SUPER-XBR__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVNTSCPresetDef>},
+{"MBZ__3__STD-SUPER-XBR__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVPresetDef>},
+{"MBZ__3__STD__EASYMODE", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__EASYMODEPresetDef>},
+{"MBZ__3__STD__GDV-MINI-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMININTSCPresetDef>},
+{"MBZ__3__STD__GDV-MINI", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMINIPresetDef>},
+{"MBZ__3__STD__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVNTSCPresetDef>},
+{"MBZ__3__STD__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVPresetDef>},
+{"MBZ__3__STD__LCD-GRID", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__LCDGRIDPresetDef>},
+{"MBZ__3__STD__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__MEGATRONNTSCPresetDef>},
+{"MBZ__3__STD__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__MEGATRONPresetDef>},
+{"MBZ__3__STD__PASSTHROUGH", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__PASSTHROUGHPresetDef>},
+{"MBZ__4__STD-NO-REFLECT-NO-TUBE-FX__PASSTHROUGH", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTNOTUBEFX__PASSTHROUGHPresetDef>},
+{"MBZ__4__STD-NO-REFLECT-SUPER-XBR__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVNTSCPresetDef>},
+{"MBZ__4__STD-NO-REFLECT-SUPER-XBR__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVPresetDef>},
+{"MBZ__4__STD-NO-REFLECT__EASYMODE", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__EASYMODEPresetDef>},
+{"MBZ__4__STD-NO-REFLECT__GDV-MINI-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMININTSCPresetDef>},
+{"MBZ__4__STD-NO-REFLECT__GDV-MINI", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMINIPresetDef>},
+{"MBZ__4__STD-NO-REFLECT__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVNTSCPresetDef>},
+{"MBZ__4__STD-NO-REFLECT__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVPresetDef>},
+{"MBZ__4__STD-NO-REFLECT__LCD-GRID", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__LCDGRIDPresetDef>},
+{"MBZ__4__STD-NO-REFLECT__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__MEGATRONNTSCPresetDef>},
+{"MBZ__4__STD-NO-REFLECT__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__MEGATRONPresetDef>},
+{"MBZ__4__STD-NO-REFLECT__PASSTHROUGH", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__PASSTHROUGHPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY-NO-TUBE-FX__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYNOTUBEFX__GDVPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY-NO-TUBE-FX__PASSTHROUGH", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYNOTUBEFX__PASSTHROUGHPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY-SUPER-XBR__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVNTSCPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY-SUPER-XBR__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY__EASYMODE", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__EASYMODEPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY__GDV-MINI-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMININTSCPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY__GDV-MINI", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMINIPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVNTSCPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY__LCD-GRID", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__LCDGRIDPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__MEGATRONNTSCPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__MEGATRONPresetDef>},
+{"MBZ__4__STD-SCREEN-ONLY__PASSTHROUGH", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__PASSTHROUGHPresetDef>},
+{"MBZ__5__POTATO-SUPER-XBR__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVNTSCPresetDef>},
+{"MBZ__5__POTATO-SUPER-XBR__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVPresetDef>},
+{"MBZ__5__POTATO__EASYMODE", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__EASYMODEPresetDef>},
+{"MBZ__5__POTATO__GDV-MINI-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMININTSCPresetDef>},
+{"MBZ__5__POTATO__GDV-MINI", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMINIPresetDef>},
+{"MBZ__5__POTATO__GDV-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVNTSCPresetDef>},
+{"MBZ__5__POTATO__GDV", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVPresetDef>},
+{"MBZ__5__POTATO__LCD-GRID", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__LCDGRIDPresetDef>},
+{"MBZ__5__POTATO__MEGATRON-NTSC", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__MEGATRONNTSCPresetDef>},
+{"MBZ__5__POTATO__MEGATRON", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__MEGATRONPresetDef>},
+{"MBZ__5__POTATO__PASSTHROUGH", "bezel/Mega_Bezel_Base", 0.0f, CreatePreset<BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__PASSTHROUGHPresetDef>},
+{"MegaBezel_ADV-GLASS", "bezel", 0.0f, CreatePreset<BezelMega_BezelPresetsMegaBezel_ADVGLASSPresetDef>},
+{"MegaBezel_ADV-NO-REFLECT", "bezel", 0.0f, CreatePreset<BezelMega_BezelPresetsMegaBezel_ADVNOREFLECTPresetDef>},
+{"MegaBezel_ADV", "bezel", 0.0f, CreatePreset<BezelMega_BezelPresetsMegaBezel_ADVPresetDef>},
+{"MegaBezel_POTATO", "bezel", 0.0f, CreatePreset<BezelMega_BezelPresetsMegaBezel_POTATOPresetDef>},
+{"MegaBezel_SMOOTH-ADV-GLASS", "bezel", 0.0f, CreatePreset<BezelMega_BezelPresetsMegaBezel_SMOOTHADVGLASSPresetDef>},
+{"MegaBezel_SMOOTH-ADV", "bezel", 0.0f, CreatePreset<BezelMega_BezelPresetsMegaBezel_SMOOTHADVPresetDef>},
+{"MegaBezel_STD-GLASS", "bezel", 0.0f, CreatePreset<BezelMega_BezelPresetsMegaBezel_STDGLASSPresetDef>},
+{"MegaBezel_STD-NO-REFLECT", "bezel", 0.0f, CreatePreset<BezelMega_BezelPresetsMegaBezel_STDNOREFLECTPresetDef>},
+{"MegaBezel_STD", "bezel", 0.0f, CreatePreset<BezelMega_BezelPresetsMegaBezel_STDPresetDef>},
+{"koko-ambi-crt", "bezel/uborder", 0.0f, CreatePreset<BezelUborderKokoAmbiCrtPresetDef>},
+{"uborder-bezel-reflections", "bezel/uborder", 0.0f, CreatePreset<BezelUborderUborderBezelReflectionsPresetDef>},
+{"uborder-koko-ambi", "bezel/uborder", 0.0f, CreatePreset<BezelUborderUborderKokoAmbiPresetDef>},
+{"bilinear", "stock", 0.0f, CreatePreset<StockBilinearPresetDef>},
+{"dual_filter_2_pass", "blurs", 0.0f, CreatePreset<BlursDual_filter_2_passPresetDef>},
+{"dual_filter_4_pass", "blurs", 0.0f, CreatePreset<BlursDual_filter_4_passPresetDef>},
+{"dual_filter_6_pass", "blurs", 0.0f, CreatePreset<BlursDual_filter_6_passPresetDef>},
+{"dual_filter_bloom", "blurs", 0.0f, CreatePreset<BlursDual_filter_bloomPresetDef>},
+{"dual_filter_bloom_fast", "blurs", 0.0f, CreatePreset<BlursDual_filter_bloom_fastPresetDef>},
+{"dual_filter_bloom_fastest", "blurs", 0.0f, CreatePreset<BlursDual_filter_bloom_fastestPresetDef>},
+{"gaussian_blur-sharp", "blurs", 0.0f, CreatePreset<BlursGaussian_blurSharpPresetDef>},
+{"gaussian_blur", "blurs", 0.0f, CreatePreset<BlursGaussian_blurPresetDef>},
+{"gaussian_blur_2_pass-sharp", "blurs", 0.0f, CreatePreset<BlursGaussian_blur_2_passSharpPresetDef>},
+{"gaussian_blur_2_pass", "blurs", 0.0f, CreatePreset<BlursGaussian_blur_2_passPresetDef>},
+{"gauss_4tap", "blurs", 0.0f, CreatePreset<BlursGauss_4tapPresetDef>},
+{"gizmo-composite-blur", "blurs", 0.0f, CreatePreset<BlursGizmoCompositeBlurPresetDef>},
+{"kawase_blur_5pass", "blurs", 0.0f, CreatePreset<BlursKawase_blur_5passPresetDef>},
+{"kawase_blur_9pass", "blurs", 0.0f, CreatePreset<BlursKawase_blur_9passPresetDef>},
+{"kawase_glow", "blurs", 0.0f, CreatePreset<BlursKawase_glowPresetDef>},
+{"sharpsmoother", "blurs", 0.0f, CreatePreset<BlursSharpsmootherPresetDef>},
+{"smart-blur", "blurs", 0.0f, CreatePreset<BlursSmartBlurPresetDef>},
+{"ambient-glow", "border", 0.0f, CreatePreset<BorderAmbientGlowPresetDef>},
+{"autocrop-koko", "border", 0.0f, CreatePreset<BorderAutocropKokoPresetDef>},
+{"average_fill", "border", 0.0f, CreatePreset<BorderAverage_fillPresetDef>},
+{"bigblur", "border", 0.0f, CreatePreset<BorderBigblurPresetDef>},
+{"blur_fill", "border", 0.0f, CreatePreset<BorderBlur_fillPresetDef>},
+{"blur_fill_stronger_blur", "border", 0.0f, CreatePreset<BorderBlur_fill_stronger_blurPresetDef>},
+{"blur_fill_weaker_blur", "border", 0.0f, CreatePreset<BorderBlur_fill_weaker_blurPresetDef>},
+{"effect-border-iq", "border", 0.0f, CreatePreset<BorderEffectBorderIqPresetDef>},
+{"gameboy-player-crt-easymode", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerCrtEasymodePresetDef>},
+{"gameboy-player-crt-geom-1x", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerCrtGeom1xPresetDef>},
+{"gameboy-player-crt-royale", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerCrtRoyalePresetDef>},
+{"gameboy-player-gba-color+crt-easymode", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerGbaColorCrtEasymodePresetDef>},
+{"gameboy-player-gba-color", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerGbaColorPresetDef>},
+{"gameboy-player-tvout+interlacing", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerTvoutInterlacingPresetDef>},
+{"gameboy-player-tvout-gba-color+interlacing", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerTvoutGbaColorInterlacingPresetDef>},
+{"gameboy-player-tvout-gba-color", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerTvoutGbaColorPresetDef>},
+{"gameboy-player-tvout", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerTvoutPresetDef>},
+{"gameboy-player", "border/gameboy-player", 0.0f, CreatePreset<BorderGameboyPlayerGameboyPlayerPresetDef>},
+{"handheld-nebula-gb+crt-consumer", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGbCrtConsumerPresetDef>},
+{"handheld-nebula-gb+dot", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGbDotPresetDef>},
+{"handheld-nebula-gb+lcd-grid-v2", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGbLcdGridV2PresetDef>},
+{"handheld-nebula-gb", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGbPresetDef>},
+{"handheld-nebula-gba+crt-consumer", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGbaCrtConsumerPresetDef>},
+{"handheld-nebula-gba+dot", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGbaDotPresetDef>},
+{"handheld-nebula-gba+lcd-grid-v2", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGbaLcdGridV2PresetDef>},
+{"handheld-nebula-gba", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGbaPresetDef>},
+{"handheld-nebula-gg+crt-consumer", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGgCrtConsumerPresetDef>},
+{"handheld-nebula-gg+dot", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGgDotPresetDef>},
+{"handheld-nebula-gg+lcd-grid-v2", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGgLcdGridV2PresetDef>},
+{"handheld-nebula-gg", "border/handheld-nebula", 0.0f, CreatePreset<BorderHandheldNebulaHandheldNebulaGgPresetDef>},
+{"imgborder", "border", 0.0f, CreatePreset<BorderImgborderPresetDef>},
+{"lightgun-border", "border", 0.0f, CreatePreset<BorderLightgunBorderPresetDef>},
+{"sgb+crt-easymode", "border/sgb", 0.0f, CreatePreset<BorderSgbSgbCrtEasymodePresetDef>},
+{"sgb-crt-geom-1x", "border/sgb", 0.0f, CreatePreset<BorderSgbSgbCrtGeom1xPresetDef>},
+{"sgb-crt-royale", "border/sgb", 0.0f, CreatePreset<BorderSgbSgbCrtRoyalePresetDef>},
+{"sgb-gbc-color-tvout+interlacing", "border/sgb", 0.0f, CreatePreset<BorderSgbSgbGbcColorTvoutInterlacingPresetDef>},
+{"sgb-gbc-color", "border/sgb", 0.0f, CreatePreset<BorderSgbSgbGbcColorPresetDef>},
+{"sgb-tvout+interlacing", "border/sgb", 0.0f, CreatePreset<BorderSgbSgbTvoutInterlacingPresetDef>},
+{"sgb", "border/sgb", 0.0f, CreatePreset<BorderSgbSgbPresetDef>},
+{"sgba-gba-color", "border/sgba", 0.0f, CreatePreset<BorderSgbaSgbaGbaColorPresetDef>},
+{"sgba-tvout+interlacing", "border/sgba", 0.0f, CreatePreset<BorderSgbaSgbaTvoutInterlacingPresetDef>},
+{"sgba-tvout-gba-color+interlacing", "border/sgba", 0.0f, CreatePreset<BorderSgbaSgbaTvoutGbaColorInterlacingPresetDef>},
+{"sgba", "border/sgba", 0.0f, CreatePreset<BorderSgbaSgbaPresetDef>},
+{"advcartoon", "cel", 0.0f, CreatePreset<CelAdvcartoonPresetDef>},
+{"MMJ_Cel_Shader", "cel", 0.0f, CreatePreset<CelMMJ_Cel_ShaderPresetDef>},
+{"MMJ_Cel_Shader_MP", "cel", 0.0f, CreatePreset<CelMMJ_Cel_Shader_MPPresetDef>},
+{"advanced_crt_whkrmrgks0", "crt", 0.0f, CreatePreset<CrtAdvanced_crt_whkrmrgks0PresetDef>},
+{"cathode-retro_no-signal", "crt", 0.0f, CreatePreset<CrtCathodeRetro_noSignalPresetDef>},
+{"crt-1tap-bloom", "crt", 0.0f, CreatePreset<CrtCrt1tapBloomPresetDef>},
+{"crt-1tap-bloom_fast", "crt", 0.0f, CreatePreset<CrtCrt1tapBloom_fastPresetDef>},
+{"crt-1tap", "crt", 0.0f, CreatePreset<CrtCrt1tapPresetDef>},
+{"crt-aperture", "crt", 0.0f, CreatePreset<CrtCrtAperturePresetDef>},
+{"crt-blurPi-sharp", "crt", 0.0f, CreatePreset<CrtCrtBlurPiSharpPresetDef>},
+{"crt-blurPi-soft", "crt", 0.0f, CreatePreset<CrtCrtBlurPiSoftPresetDef>},
+{"crt-caligari", "crt", 0.0f, CreatePreset<CrtCrtCaligariPresetDef>},
+{"crt-cgwg-fast", "crt", 0.0f, CreatePreset<CrtCrtCgwgFastPresetDef>},
+{"crt-consumer", "crt", 0.0f, CreatePreset<CrtCrtConsumerPresetDef>},
+{"crt-Cyclon", "crt", 0.0f, CreatePreset<CrtCrtCyclonPresetDef>},
+{"crt-easymode-halation", "crt", 0.0f, CreatePreset<CrtCrtEasymodeHalationPresetDef>},
+{"crt-easymode", "crt", 0.0f, CreatePreset<CrtCrtEasymodePresetDef>},
+{"crt-frutbunn", "crt", 0.0f, CreatePreset<CrtCrtFrutbunnPresetDef>},
+{"crt-gdv-mini-ultra-trinitron", "crt", 0.0f, CreatePreset<CrtCrtGdvMiniUltraTrinitronPresetDef>},
+{"crt-gdv-mini", "crt", 0.0f, CreatePreset<CrtCrtGdvMiniPresetDef>},
+{"crt-geom-deluxe", "crt", 0.0f, CreatePreset<CrtCrtGeomDeluxePresetDef>},
+{"crt-geom-mini", "crt", 0.0f, CreatePreset<CrtCrtGeomMiniPresetDef>},
+{"crt-geom-tate", "crt", 0.0f, CreatePreset<CrtCrtGeomTatePresetDef>},
+{"crt-geom", "crt", 0.0f, CreatePreset<CrtCrtGeomPresetDef>},
+{"crt-guest-advanced-fast", "crt", 0.0f, CreatePreset<CrtCrtGuestAdvancedFastPresetDef>},
+{"crt-guest-advanced-fastest", "crt", 0.0f, CreatePreset<CrtCrtGuestAdvancedFastestPresetDef>},
+{"crt-guest-advanced-hd", "crt", 0.0f, CreatePreset<CrtCrtGuestAdvancedHdPresetDef>},
+{"crt-guest-advanced-ntsc", "crt", 0.0f, CreatePreset<CrtCrtGuestAdvancedNtscPresetDef>},
+{"crt-guest-advanced", "crt", 0.0f, CreatePreset<CrtCrtGuestAdvancedPresetDef>},
+{"crt-hyllian-3d", "crt", 0.0f, CreatePreset<CrtCrtHyllian3dPresetDef>},
+{"crt-hyllian-fast", "crt", 0.0f, CreatePreset<CrtCrtHyllianFastPresetDef>},
+{"crt-hyllian-ntsc-rainbow", "crt", 0.0f, CreatePreset<CrtCrtHyllianNtscRainbowPresetDef>},
+{"crt-hyllian-ntsc", "crt", 0.0f, CreatePreset<CrtCrtHyllianNtscPresetDef>},
+{"crt-hyllian-sinc-composite", "crt", 0.0f, CreatePreset<CrtCrtHyllianSincCompositePresetDef>},
+{"crt-hyllian", "crt", 0.0f, CreatePreset<CrtCrtHyllianPresetDef>},
+{"crt-interlaced-halation", "crt", 0.0f, CreatePreset<CrtCrtInterlacedHalationPresetDef>},
+{"crt-lottes-fast", "crt", 0.0f, CreatePreset<CrtCrtLottesFastPresetDef>},
+{"crt-lottes-multipass-glow", "crt", 0.0f, CreatePreset<CrtCrtLottesMultipassGlowPresetDef>},
+{"crt-lottes-multipass", "crt", 0.0f, CreatePreset<CrtCrtLottesMultipassPresetDef>},
+{"crt-lottes", "crt", 0.0f, CreatePreset<CrtCrtLottesPresetDef>},
+{"crt-mattias", "crt", 0.0f, CreatePreset<CrtCrtMattiasPresetDef>},
+{"crt-maximus-royale-fast-mode", "crt", 0.0f, CreatePreset<CrtCrtMaximusRoyaleFastModePresetDef>},
+{"crt-maximus-royale-half-res-mode", "crt", 0.0f, CreatePreset<CrtCrtMaximusRoyaleHalfResModePresetDef>},
+{"crt-maximus-royale", "crt", 0.0f, CreatePreset<CrtCrtMaximusRoyalePresetDef>},
+{"crt-nes-mini", "crt", 0.0f, CreatePreset<CrtCrtNesMiniPresetDef>},
+{"crt-nobody", "crt", 0.0f, CreatePreset<CrtCrtNobodyPresetDef>},
+{"crt-pi", "crt", 0.0f, CreatePreset<CrtCrtPiPresetDef>},
+{"crt-pocket", "crt", 0.0f, CreatePreset<CrtCrtPocketPresetDef>},
+{"crt-potato-BVM", "crt", 0.0f, CreatePreset<CrtCrtPotatoBVMPresetDef>},
+{"crt-potato-cool", "crt", 0.0f, CreatePreset<CrtCrtPotatoCoolPresetDef>},
+{"crt-potato-warm", "crt", 0.0f, CreatePreset<CrtCrtPotatoWarmPresetDef>},
+{"crt-resswitch-glitch-koko", "crt", 0.0f, CreatePreset<CrtCrtResswitchGlitchKokoPresetDef>},
+{"crt-royale-fake-bloom-intel", "crt", 0.0f, CreatePreset<CrtCrtRoyaleFakeBloomIntelPresetDef>},
+{"crt-royale-fake-bloom", "crt", 0.0f, CreatePreset<CrtCrtRoyaleFakeBloomPresetDef>},
+{"crt-royale-fast", "crt", 0.0f, CreatePreset<CrtCrtRoyaleFastPresetDef>},
+{"crt-royale-intel", "crt", 0.0f, CreatePreset<CrtCrtRoyaleIntelPresetDef>},
+{"crt-royale", "crt", 0.0f, CreatePreset<CrtCrtRoyalePresetDef>},
+{"crt-simple", "crt", 0.0f, CreatePreset<CrtCrtSimplePresetDef>},
+{"crt-sines", "crt", 0.0f, CreatePreset<CrtCrtSinesPresetDef>},
+{"crt-slangtest-cubic", "crt", 0.0f, CreatePreset<CrtCrtSlangtestCubicPresetDef>},
+{"crt-slangtest-lanczos", "crt", 0.0f, CreatePreset<CrtCrtSlangtestLanczosPresetDef>},
+{"crt-super-xbr", "crt", 0.0f, CreatePreset<CrtCrtSuperXbrPresetDef>},
+{"crt-torridgristle", "crt", 0.0f, CreatePreset<CrtCrtTorridgristlePresetDef>},
+{"crt-yah.single-pass", "crt", 0.0f, CreatePreset<CrtCrtYahSinglePassPresetDef>},
+{"crt-yah", "crt", 0.0f, CreatePreset<CrtCrtYahPresetDef>},
+{"crt-yo6-flat-trinitron-tv", "crt", 0.0f, CreatePreset<CrtCrtYo6FlatTrinitronTvPresetDef>},
+{"crt-yo6-KV-21CL10B", "crt", 0.0f, CreatePreset<CrtCrtYo6KV21CL10BPresetDef>},
+{"crt-yo6-KV-M1420B-sharp", "crt", 0.0f, CreatePreset<CrtCrtYo6KVM1420BSharpPresetDef>},
+{"crt-yo6-KV-M1420B", "crt", 0.0f, CreatePreset<CrtCrtYo6KVM1420BPresetDef>},
+{"crtglow_gauss", "crt", 0.0f, CreatePreset<CrtCrtglow_gaussPresetDef>},
+{"crtglow_lanczos", "crt", 0.0f, CreatePreset<CrtCrtglow_lanczosPresetDef>},
+{"crtsim", "crt", 0.0f, CreatePreset<CrtCrtsimPresetDef>},
+{"fake-crt-geom-potato", "crt", 0.0f, CreatePreset<CrtFakeCrtGeomPotatoPresetDef>},
+{"fake-crt-geom", "crt", 0.0f, CreatePreset<CrtFakeCrtGeomPresetDef>},
+{"fakelottes", "crt", 0.0f, CreatePreset<CrtFakelottesPresetDef>},
+{"gizmo-crt", "crt", 0.0f, CreatePreset<CrtGizmoCrtPresetDef>},
+{"gizmo-slotmask-crt", "crt", 0.0f, CreatePreset<CrtGizmoSlotmaskCrtPresetDef>},
+{"glow_trails", "crt", 0.0f, CreatePreset<CrtGlow_trailsPresetDef>},
+{"GritsScanlines", "crt", 0.0f, CreatePreset<CrtGritsScanlinesPresetDef>},
+{"gtu-v050", "crt", 0.0f, CreatePreset<CrtGtuV050PresetDef>},
+{"mame_hlsl", "crt", 0.0f, CreatePreset<CrtMame_hlslPresetDef>},
+{"metacrt", "crt", 0.0f, CreatePreset<CrtMetacrtPresetDef>},
+{"newpixie-crt", "crt", 0.0f, CreatePreset<CrtNewpixieCrtPresetDef>},
+{"newpixie-mini", "crt", 0.0f, CreatePreset<CrtNewpixieMiniPresetDef>},
+{"phosphor-persistence", "crt", 0.0f, CreatePreset<CrtPhosphorPersistencePresetDef>},
+{"phosphorlut", "crt", 0.0f, CreatePreset<CrtPhosphorlutPresetDef>},
+{"ray_traced_curvature", "crt", 0.0f, CreatePreset<CrtRay_traced_curvaturePresetDef>},
+{"ray_traced_curvature_append", "crt", 0.0f, CreatePreset<CrtRay_traced_curvature_appendPresetDef>},
+{"simple-crt-fxaa", "crt", 0.0f, CreatePreset<CrtSimpleCrtFxaaPresetDef>},
+{"simple-crt", "crt", 0.0f, CreatePreset<CrtSimpleCrtPresetDef>},
+{"tvout-tweaks", "crt", 0.0f, CreatePreset<CrtTvoutTweaksPresetDef>},
+{"vector-glow-alt-render", "crt", 0.0f, CreatePreset<CrtVectorGlowAltRenderPresetDef>},
+{"vector-glow", "crt", 0.0f, CreatePreset<CrtVectorGlowPresetDef>},
+{"vt220", "crt", 0.0f, CreatePreset<CrtVt220PresetDef>},
+{"yee64", "crt", 0.0f, CreatePreset<CrtYee64PresetDef>},
+{"yeetron", "crt", 0.0f, CreatePreset<CrtYeetronPresetDef>},
+{"zfast-crt-composite", "crt", 0.0f, CreatePreset<CrtZfastCrtCompositePresetDef>},
+{"zfast-crt-curvature", "crt", 0.0f, CreatePreset<CrtZfastCrtCurvaturePresetDef>},
+{"zfast-crt-geo", "crt", 0.0f, CreatePreset<CrtZfastCrtGeoPresetDef>},
+{"zfast-crt-hdmask", "crt", 0.0f, CreatePreset<CrtZfastCrtHdmaskPresetDef>},
+{"zfast-crt", "crt", 0.0f, CreatePreset<CrtZfastCrtPresetDef>},
+{"deblur-luma", "deblur", 0.0f, CreatePreset<DeblurDeblurLumaPresetDef>},
+{"deblur", "deblur", 0.0f, CreatePreset<DeblurDeblurPresetDef>},
+{"bilateral-2p", "denoisers", 0.0f, CreatePreset<DenoisersBilateral2pPresetDef>},
+{"bilateral", "denoisers", 0.0f, CreatePreset<DenoisersBilateralPresetDef>},
+{"crt-fast-bilateral-super-xbr", "denoisers", 0.0f, CreatePreset<DenoisersCrtFastBilateralSuperXbrPresetDef>},
+{"fast-bilateral", "denoisers", 0.0f, CreatePreset<DenoisersFastBilateralPresetDef>},
+{"median_3x3", "denoisers", 0.0f, CreatePreset<DenoisersMedian_3x3PresetDef>},
+{"median_5x5", "denoisers", 0.0f, CreatePreset<DenoisersMedian_5x5PresetDef>},
+{"slow-bilateral", "denoisers", 0.0f, CreatePreset<DenoisersSlowBilateralPresetDef>},
+{"bayer-matrix-dithering", "dithering", 0.0f, CreatePreset<DitheringBayerMatrixDitheringPresetDef>},
+{"bayer_4x4", "dithering", 0.0f, CreatePreset<DitheringBayer_4x4PresetDef>},
+{"blue_noise", "dithering", 0.0f, CreatePreset<DitheringBlue_noisePresetDef>},
+{"blue_noise_dynamic_4Bit", "dithering", 0.0f, CreatePreset<DitheringBlue_noise_dynamic_4BitPresetDef>},
+{"blue_noise_dynamic_monochrome", "dithering", 0.0f, CreatePreset<DitheringBlue_noise_dynamic_monochromePresetDef>},
+{"cbod_v1", "dithering", 0.0f, CreatePreset<DitheringCbod_v1PresetDef>},
+{"checkerboard-dedither", "dithering", 0.0f, CreatePreset<DitheringCheckerboardDeditherPresetDef>},
+{"g-sharp_resampler", "dithering", 0.0f, CreatePreset<DitheringGSharp_resamplerPresetDef>},
+{"gdapt", "dithering", 0.0f, CreatePreset<DitheringGdaptPresetDef>},
+{"gendither", "dithering", 0.0f, CreatePreset<DitheringGenditherPresetDef>},
+{"jinc2-dedither", "dithering", 0.0f, CreatePreset<DitheringJinc2DeditherPresetDef>},
+{"mdapt", "dithering", 0.0f, CreatePreset<DitheringMdaptPresetDef>},
+{"ps1-dedither-boxblur", "dithering", 0.0f, CreatePreset<DitheringPs1DeditherBoxblurPresetDef>},
+{"ps1-dedither-comparison", "dithering", 0.0f, CreatePreset<DitheringPs1DeditherComparisonPresetDef>},
+{"ps1-dither", "dithering", 0.0f, CreatePreset<DitheringPs1DitherPresetDef>},
+{"sgenpt-mix-multipass", "dithering", 0.0f, CreatePreset<DitheringSgenptMixMultipassPresetDef>},
+{"sgenpt-mix", "dithering", 0.0f, CreatePreset<DitheringSgenptMixPresetDef>},
+{"cleanEdge-scale", "edge-smoothing/cleanEdge", 0.0f, CreatePreset<EdgeSmoothingCleanEdgeCleanEdgeScalePresetDef>},
+{"3-point", "edge-smoothing/ddt", 0.0f, CreatePreset<EdgeSmoothingDdt3PointPresetDef>},
+{"cut", "edge-smoothing/ddt", 0.0f, CreatePreset<EdgeSmoothingDdtCutPresetDef>},
+{"ddt-extended", "edge-smoothing/ddt", 0.0f, CreatePreset<EdgeSmoothingDdtDdtExtendedPresetDef>},
+{"ddt-jinc-linear", "edge-smoothing/ddt", 0.0f, CreatePreset<EdgeSmoothingDdtDdtJincLinearPresetDef>},
+{"ddt-jinc", "edge-smoothing/ddt", 0.0f, CreatePreset<EdgeSmoothingDdtDdtJincPresetDef>},
+{"ddt-xbr-lv1", "edge-smoothing/ddt", 0.0f, CreatePreset<EdgeSmoothingDdtDdtXbrLv1PresetDef>},
+{"ddt", "edge-smoothing/ddt", 0.0f, CreatePreset<EdgeSmoothingDdtDdtPresetDef>},
+{"2xsai-fix-pixel-shift", "edge-smoothing/eagle", 0.0f, CreatePreset<EdgeSmoothingEagle2xsaiFixPixelShiftPresetDef>},
+{"2xsai", "edge-smoothing/eagle", 0.0f, CreatePreset<EdgeSmoothingEagle2xsaiPresetDef>},
+{"super-2xsai-fix-pixel-shift", "edge-smoothing/eagle", 0.0f, CreatePreset<EdgeSmoothingEagleSuper2xsaiFixPixelShiftPresetDef>},
+{"super-2xsai", "edge-smoothing/eagle", 0.0f, CreatePreset<EdgeSmoothingEagleSuper2xsaiPresetDef>},
+{"supereagle", "edge-smoothing/eagle", 0.0f, CreatePreset<EdgeSmoothingEagleSupereaglePresetDef>},
+{"fsr-easu", "edge-smoothing/fsr", 0.0f, CreatePreset<EdgeSmoothingFsrFsrEasuPresetDef>},
+{"fsr", "edge-smoothing/fsr", 0.0f, CreatePreset<EdgeSmoothingFsrFsrPresetDef>},
+{"smaa+fsr", "edge-smoothing/fsr", 0.0f, CreatePreset<EdgeSmoothingFsrSmaaFsrPresetDef>},
+{"hq2x-halphon", "edge-smoothing/hqx", 0.0f, CreatePreset<EdgeSmoothingHqxHq2xHalphonPresetDef>},
+{"hq2x", "edge-smoothing/hqx", 0.0f, CreatePreset<EdgeSmoothingHqxHq2xPresetDef>},
+{"hq3x", "edge-smoothing/hqx", 0.0f, CreatePreset<EdgeSmoothingHqxHq3xPresetDef>},
+{"hq4x", "edge-smoothing/hqx", 0.0f, CreatePreset<EdgeSmoothingHqxHq4xPresetDef>},
+{"fast-bilateral-nedi", "edge-smoothing/nedi", 0.0f, CreatePreset<EdgeSmoothingNediFastBilateralNediPresetDef>},
+{"nedi-hybrid-sharper", "edge-smoothing/nedi", 0.0f, CreatePreset<EdgeSmoothingNediNediHybridSharperPresetDef>},
+{"nedi-hybrid", "edge-smoothing/nedi", 0.0f, CreatePreset<EdgeSmoothingNediNediHybridPresetDef>},
+{"nedi-sharper", "edge-smoothing/nedi", 0.0f, CreatePreset<EdgeSmoothingNediNediSharperPresetDef>},
+{"nedi", "edge-smoothing/nedi", 0.0f, CreatePreset<EdgeSmoothingNediNediPresetDef>},
+{"bilateral-variant", "edge-smoothing/nedi/presets", 0.0f, CreatePreset<EdgeSmoothingNediPresetsBilateralVariantPresetDef>},
+{"bilateral-variant2", "edge-smoothing/nedi/presets", 0.0f, CreatePreset<EdgeSmoothingNediPresetsBilateralVariant2PresetDef>},
+{"bilateral-variant3", "edge-smoothing/nedi/presets", 0.0f, CreatePreset<EdgeSmoothingNediPresetsBilateralVariant3PresetDef>},
+{"bilateral-variant4", "edge-smoothing/nedi/presets", 0.0f, CreatePreset<EdgeSmoothingNediPresetsBilateralVariant4PresetDef>},
+{"bilateral-variant5", "edge-smoothing/nedi/presets", 0.0f, CreatePreset<EdgeSmoothingNediPresetsBilateralVariant5PresetDef>},
+{"bilateral-variant6", "edge-smoothing/nedi/presets", 0.0f, CreatePreset<EdgeSmoothingNediPresetsBilateralVariant6PresetDef>},
+{"bilateral-variant7", "edge-smoothing/nedi/presets", 0.0f, CreatePreset<EdgeSmoothingNediPresetsBilateralVariant7PresetDef>},
+{"nnedi3-nns16-2x-luma", "edge-smoothing/nnedi3", 0.0f, CreatePreset<EdgeSmoothingNnedi3Nnedi3Nns162xLumaPresetDef>},
+{"nnedi3-nns16-2x-rgb", "edge-smoothing/nnedi3", 0.0f, CreatePreset<EdgeSmoothingNnedi3Nnedi3Nns162xRgbPresetDef>},
+{"nnedi3-nns16-4x-luma", "edge-smoothing/nnedi3", 0.0f, CreatePreset<EdgeSmoothingNnedi3Nnedi3Nns164xLumaPresetDef>},
+{"nnedi3-nns32-2x-rgb-nns32-4x-luma", "edge-smoothing/nnedi3", 0.0f, CreatePreset<EdgeSmoothingNnedi3Nnedi3Nns322xRgbNns324xLumaPresetDef>},
+{"nnedi3-nns32-4x-rgb", "edge-smoothing/nnedi3", 0.0f, CreatePreset<EdgeSmoothingNnedi3Nnedi3Nns324xRgbPresetDef>},
+{"nnedi3-nns64-2x-nns32-4x-nns16-8x-rgb", "edge-smoothing/nnedi3", 0.0f, CreatePreset<EdgeSmoothingNnedi3Nnedi3Nns642xNns324xNns168xRgbPresetDef>},
+{"nnedi3-nns64-2x-nns32-4x-rgb", "edge-smoothing/nnedi3", 0.0f, CreatePreset<EdgeSmoothingNnedi3Nnedi3Nns642xNns324xRgbPresetDef>},
+{"omniscale-legacy", "edge-smoothing/omniscale", 0.0f, CreatePreset<EdgeSmoothingOmniscaleOmniscaleLegacyPresetDef>},
+{"omniscale", "edge-smoothing/omniscale", 0.0f, CreatePreset<EdgeSmoothingOmniscaleOmniscalePresetDef>},
+{"sabr-hybrid-deposterize", "edge-smoothing/sabr", 0.0f, CreatePreset<EdgeSmoothingSabrSabrHybridDeposterizePresetDef>},
+{"sabr", "edge-smoothing/sabr", 0.0f, CreatePreset<EdgeSmoothingSabrSabrPresetDef>},
+{"scalefx+rAA", "edge-smoothing/scalefx", 0.0f, CreatePreset<EdgeSmoothingScalefxScalefxRAAPresetDef>},
+{"scalefx-9x", "edge-smoothing/scalefx", 0.0f, CreatePreset<EdgeSmoothingScalefxScalefx9xPresetDef>},
+{"scalefx-hybrid", "edge-smoothing/scalefx", 0.0f, CreatePreset<EdgeSmoothingScalefxScalefxHybridPresetDef>},
+{"scalefx", "edge-smoothing/scalefx", 0.0f, CreatePreset<EdgeSmoothingScalefxScalefxPresetDef>},
+{"2xScaleHQ", "edge-smoothing/scalehq", 0.0f, CreatePreset<EdgeSmoothingScalehq2xScaleHQPresetDef>},
+{"4xScaleHQ", "edge-smoothing/scalehq", 0.0f, CreatePreset<EdgeSmoothingScalehq4xScaleHQPresetDef>},
+{"epx", "edge-smoothing/scalenx", 0.0f, CreatePreset<EdgeSmoothingScalenxEpxPresetDef>},
+{"mmpx", "edge-smoothing/scalenx", 0.0f, CreatePreset<EdgeSmoothingScalenxMmpxPresetDef>},
+{"scale2x", "edge-smoothing/scalenx", 0.0f, CreatePreset<EdgeSmoothingScalenxScale2xPresetDef>},
+{"scale2xplus", "edge-smoothing/scalenx", 0.0f, CreatePreset<EdgeSmoothingScalenxScale2xplusPresetDef>},
+{"scale2xSFX", "edge-smoothing/scalenx", 0.0f, CreatePreset<EdgeSmoothingScalenxScale2xSFXPresetDef>},
+{"scale3x", "edge-smoothing/scalenx", 0.0f, CreatePreset<EdgeSmoothingScalenxScale3xPresetDef>},
+{"hybrid-jinc2-xbr-lv2", "edge-smoothing/xbr", 0.0f, CreatePreset<EdgeSmoothingXbrHybridJinc2XbrLv2PresetDef>},
+{"super-xbr-fast", "edge-smoothing/xbr", 0.0f, CreatePreset<EdgeSmoothingXbrSuperXbrFastPresetDef>},
+{"super-xbr", "edge-smoothing/xbr", 0.0f, CreatePreset<EdgeSmoothingXbrSuperXbrPresetDef>},
+{"xbr-lv2-sharp", "edge-smoothing/xbr", 0.0f, CreatePreset<EdgeSmoothingXbrXbrLv2SharpPresetDef>},
+{"xbr-lv2", "edge-smoothing/xbr", 0.0f, CreatePreset<EdgeSmoothingXbrXbrLv2PresetDef>},
+{"xbr-lv3-sharp", "edge-smoothing/xbr", 0.0f, CreatePreset<EdgeSmoothingXbrXbrLv3SharpPresetDef>},
+{"xbr-lv3", "edge-smoothing/xbr", 0.0f, CreatePreset<EdgeSmoothingXbrXbrLv3PresetDef>},
+{"2xbrz-linear", "edge-smoothing/xbrz", 0.0f, CreatePreset<EdgeSmoothingXbrz2xbrzLinearPresetDef>},
+{"4xbrz-linear", "edge-smoothing/xbrz", 0.0f, CreatePreset<EdgeSmoothingXbrz4xbrzLinearPresetDef>},
+{"5xbrz-linear", "edge-smoothing/xbrz", 0.0f, CreatePreset<EdgeSmoothingXbrz5xbrzLinearPresetDef>},
+{"6xbrz-linear", "edge-smoothing/xbrz", 0.0f, CreatePreset<EdgeSmoothingXbrz6xbrzLinearPresetDef>},
+{"xbrz-freescale-multipass", "edge-smoothing/xbrz", 0.0f, CreatePreset<EdgeSmoothingXbrzXbrzFreescaleMultipassPresetDef>},
+{"xbrz-freescale", "edge-smoothing/xbrz", 0.0f, CreatePreset<EdgeSmoothingXbrzXbrzFreescalePresetDef>},
+{"2xsal-level2-crt", "edge-smoothing/xsal", 0.0f, CreatePreset<EdgeSmoothingXsal2xsalLevel2CrtPresetDef>},
+{"2xsal", "edge-smoothing/xsal", 0.0f, CreatePreset<EdgeSmoothingXsal2xsalPresetDef>},
+{"4xsal-level2-crt", "edge-smoothing/xsal", 0.0f, CreatePreset<EdgeSmoothingXsal4xsalLevel2CrtPresetDef>},
+{"4xsal-level2-hq", "edge-smoothing/xsal", 0.0f, CreatePreset<EdgeSmoothingXsal4xsalLevel2HqPresetDef>},
+{"4xsal-level2", "edge-smoothing/xsal", 0.0f, CreatePreset<EdgeSmoothingXsal4xsalLevel2PresetDef>},
+{"4xsoft", "edge-smoothing/xsoft", 0.0f, CreatePreset<EdgeSmoothingXsoft4xsoftPresetDef>},
+{"4xsoftSdB", "edge-smoothing/xsoft", 0.0f, CreatePreset<EdgeSmoothingXsoft4xsoftSdBPresetDef>},
+{"film-grain", "film", 0.0f, CreatePreset<FilmFilmGrainPresetDef>},
+{"technicolor", "film", 0.0f, CreatePreset<FilmTechnicolorPresetDef>},
+{"3dfx_4x1", "gpu", 0.0f, CreatePreset<Gpu3dfx_4x1PresetDef>},
+{"powervr2", "gpu", 0.0f, CreatePreset<GpuPowervr2PresetDef>},
+{"agb001", "handheld", 0.0f, CreatePreset<HandheldAgb001PresetDef>},
+{"ags001", "handheld", 0.0f, CreatePreset<HandheldAgs001PresetDef>},
+{"authentic_gbc", "handheld", 0.0f, CreatePreset<HandheldAuthentic_gbcPresetDef>},
+{"authentic_gbc_fast", "handheld", 0.0f, CreatePreset<HandheldAuthentic_gbc_fastPresetDef>},
+{"authentic_gbc_single_pass", "handheld", 0.0f, CreatePreset<HandheldAuthentic_gbc_single_passPresetDef>},
+{"bevel", "handheld", 0.0f, CreatePreset<HandheldBevelPresetDef>},
+{"dslite-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModDsliteColorPresetDef>},
+{"gba-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModGbaColorPresetDef>},
+{"gbc-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModGbcColorPresetDef>},
+{"gbc-gambatte-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModGbcGambatteColorPresetDef>},
+{"gbMicro-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModGbMicroColorPresetDef>},
+{"nds-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModNdsColorPresetDef>},
+{"NSO-gba-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModNSOGbaColorPresetDef>},
+{"NSO-gbc-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModNSOGbcColorPresetDef>},
+{"palm-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModPalmColorPresetDef>},
+{"psp-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModPspColorPresetDef>},
+{"sp101-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModSp101ColorPresetDef>},
+{"SwitchOLED-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModSwitchOLEDColorPresetDef>},
+{"vba-color", "handheld/color-mod", 0.0f, CreatePreset<HandheldColorModVbaColorPresetDef>},
+{"dmg", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderDmgPresetDef>},
+{"gb-dmg-alt", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbDmgAltPresetDef>},
+{"gb-light-alt", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbLightAltPresetDef>},
+{"gb-pocket-alt", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbPocketAltPresetDef>},
+{"gb-pocket", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbPocketPresetDef>},
+{"gba-agb001-color-motionblur", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbaAgb001ColorMotionblurPresetDef>},
+{"gba-ags001-color-motionblur", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbaAgs001ColorMotionblurPresetDef>},
+{"gba-lcd-grid-v2", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbaLcdGridV2PresetDef>},
+{"gba", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbaPresetDef>},
+{"gbc-lcd-grid-v2", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbcLcdGridV2PresetDef>},
+{"gbc", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGbcPresetDef>},
+{"gg", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderGgPresetDef>},
+{"ngpc", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderNgpcPresetDef>},
+{"psp", "handheld/console-border", 0.0f, CreatePreset<HandheldConsoleBorderPspPresetDef>},
+{"dot", "handheld", 0.0f, CreatePreset<HandheldDotPresetDef>},
+{"ds-hybrid-sabr", "handheld", 0.0f, CreatePreset<HandheldDsHybridSabrPresetDef>},
+{"ds-hybrid-scalefx", "handheld", 0.0f, CreatePreset<HandheldDsHybridScalefxPresetDef>},
+{"gameboy-advance-dot-matrix", "handheld", 0.0f, CreatePreset<HandheldGameboyAdvanceDotMatrixPresetDef>},
+{"gameboy-color-dot-matrix-white-bg", "handheld", 0.0f, CreatePreset<HandheldGameboyColorDotMatrixWhiteBgPresetDef>},
+{"gameboy-color-dot-matrix", "handheld", 0.0f, CreatePreset<HandheldGameboyColorDotMatrixPresetDef>},
+{"gameboy-dark-mode", "handheld", 0.0f, CreatePreset<HandheldGameboyDarkModePresetDef>},
+{"gameboy-light-mode", "handheld", 0.0f, CreatePreset<HandheldGameboyLightModePresetDef>},
+{"gameboy-light", "handheld", 0.0f, CreatePreset<HandheldGameboyLightPresetDef>},
+{"gameboy-pocket-high-contrast", "handheld", 0.0f, CreatePreset<HandheldGameboyPocketHighContrastPresetDef>},
+{"gameboy-pocket", "handheld", 0.0f, CreatePreset<HandheldGameboyPocketPresetDef>},
+{"gameboy", "handheld", 0.0f, CreatePreset<HandheldGameboyPresetDef>},
+{"gb-palette-dmg", "handheld", 0.0f, CreatePreset<HandheldGbPaletteDmgPresetDef>},
+{"gb-palette-light", "handheld", 0.0f, CreatePreset<HandheldGbPaletteLightPresetDef>},
+{"gb-palette-pocket", "handheld", 0.0f, CreatePreset<HandheldGbPalettePocketPresetDef>},
+{"gbc-dev", "handheld", 0.0f, CreatePreset<HandheldGbcDevPresetDef>},
+{"lcd-grid-v2", "handheld", 0.0f, CreatePreset<HandheldLcdGridV2PresetDef>},
+{"lcd-grid", "handheld", 0.0f, CreatePreset<HandheldLcdGridPresetDef>},
+{"lcd-shader", "handheld", 0.0f, CreatePreset<HandheldLcdShaderPresetDef>},
+{"lcd1x", "handheld", 0.0f, CreatePreset<HandheldLcd1xPresetDef>},
+{"lcd1x_nds", "handheld", 0.0f, CreatePreset<HandheldLcd1x_ndsPresetDef>},
+{"lcd1x_psp", "handheld", 0.0f, CreatePreset<HandheldLcd1x_pspPresetDef>},
+{"lcd3x", "handheld", 0.0f, CreatePreset<HandheldLcd3xPresetDef>},
+{"retro-tiles", "handheld", 0.0f, CreatePreset<HandheldRetroTilesPresetDef>},
+{"retro-v2", "handheld", 0.0f, CreatePreset<HandheldRetroV2PresetDef>},
+{"retro-v3", "handheld", 0.0f, CreatePreset<HandheldRetroV3PresetDef>},
+{"sameboy-lcd", "handheld", 0.0f, CreatePreset<HandheldSameboyLcdPresetDef>},
+{"simpletex_lcd-4k", "handheld", 0.0f, CreatePreset<HandheldSimpletex_lcd4kPresetDef>},
+{"simpletex_lcd", "handheld", 0.0f, CreatePreset<HandheldSimpletex_lcdPresetDef>},
+{"simpletex_lcd_720p", "handheld", 0.0f, CreatePreset<HandheldSimpletex_lcd_720pPresetDef>},
+{"zfast-lcd", "handheld", 0.0f, CreatePreset<HandheldZfastLcdPresetDef>},
+{"b-spline-4-taps-fast", "interpolation", 0.0f, CreatePreset<InterpolationBSpline4TapsFastPresetDef>},
+{"b-spline-4-taps", "interpolation", 0.0f, CreatePreset<InterpolationBSpline4TapsPresetDef>},
+{"b-spline-fast", "interpolation", 0.0f, CreatePreset<InterpolationBSplineFastPresetDef>},
+{"bicubic-5-taps", "interpolation", 0.0f, CreatePreset<InterpolationBicubic5TapsPresetDef>},
+{"bicubic-6-taps-fast", "interpolation", 0.0f, CreatePreset<InterpolationBicubic6TapsFastPresetDef>},
+{"bicubic-fast", "interpolation", 0.0f, CreatePreset<InterpolationBicubicFastPresetDef>},
+{"bicubic", "interpolation", 0.0f, CreatePreset<InterpolationBicubicPresetDef>},
+{"catmull-rom-4-taps", "interpolation", 0.0f, CreatePreset<InterpolationCatmullRom4TapsPresetDef>},
+{"catmull-rom-5-taps", "interpolation", 0.0f, CreatePreset<InterpolationCatmullRom5TapsPresetDef>},
+{"catmull-rom-6-taps-fast", "interpolation", 0.0f, CreatePreset<InterpolationCatmullRom6TapsFastPresetDef>},
+{"catmull-rom-fast", "interpolation", 0.0f, CreatePreset<InterpolationCatmullRomFastPresetDef>},
+{"catmull-rom", "interpolation", 0.0f, CreatePreset<InterpolationCatmullRomPresetDef>},
+{"cubic-gamma-correct", "interpolation", 0.0f, CreatePreset<InterpolationCubicGammaCorrectPresetDef>},
+{"cubic", "interpolation", 0.0f, CreatePreset<InterpolationCubicPresetDef>},
+{"hann-5-taps", "interpolation", 0.0f, CreatePreset<InterpolationHann5TapsPresetDef>},
+{"hermite", "interpolation", 0.0f, CreatePreset<InterpolationHermitePresetDef>},
+{"jinc2-sharp", "interpolation", 0.0f, CreatePreset<InterpolationJinc2SharpPresetDef>},
+{"jinc2-sharper", "interpolation", 0.0f, CreatePreset<InterpolationJinc2SharperPresetDef>},
+{"jinc2", "interpolation", 0.0f, CreatePreset<InterpolationJinc2PresetDef>},
+{"lanczos2-5-taps", "interpolation", 0.0f, CreatePreset<InterpolationLanczos25TapsPresetDef>},
+{"lanczos2-6-taps-fast", "interpolation", 0.0f, CreatePreset<InterpolationLanczos26TapsFastPresetDef>},
+{"lanczos2-fast", "interpolation", 0.0f, CreatePreset<InterpolationLanczos2FastPresetDef>},
+{"lanczos2", "interpolation", 0.0f, CreatePreset<InterpolationLanczos2PresetDef>},
+{"lanczos3-fast", "interpolation", 0.0f, CreatePreset<InterpolationLanczos3FastPresetDef>},
+{"lanczos4", "interpolation", 0.0f, CreatePreset<InterpolationLanczos4PresetDef>},
+{"lanczos6", "interpolation", 0.0f, CreatePreset<InterpolationLanczos6PresetDef>},
+{"lanczos8", "interpolation", 0.0f, CreatePreset<InterpolationLanczos8PresetDef>},
+{"b-spline-fast", "interpolation/linear-gamma-presets", 0.0f, CreatePreset<InterpolationLinearGammaPresetsBSplineFastPresetDef>},
+{"bicubic-fast", "interpolation/linear-gamma-presets", 0.0f, CreatePreset<InterpolationLinearGammaPresetsBicubicFastPresetDef>},
+{"catmull-rom-fast", "interpolation/linear-gamma-presets", 0.0f, CreatePreset<InterpolationLinearGammaPresetsCatmullRomFastPresetDef>},
+{"lanczos2-fast", "interpolation/linear-gamma-presets", 0.0f, CreatePreset<InterpolationLinearGammaPresetsLanczos2FastPresetDef>},
+{"lanczos3-fast", "interpolation/linear-gamma-presets", 0.0f, CreatePreset<InterpolationLinearGammaPresetsLanczos3FastPresetDef>},
+{"spline16-fast", "interpolation/linear-gamma-presets", 0.0f, CreatePreset<InterpolationLinearGammaPresetsSpline16FastPresetDef>},
+{"spline36-fast", "interpolation/linear-gamma-presets", 0.0f, CreatePreset<InterpolationLinearGammaPresetsSpline36FastPresetDef>},
+{"quilez", "interpolation", 0.0f, CreatePreset<InterpolationQuilezPresetDef>},
+{"spline100", "interpolation", 0.0f, CreatePreset<InterpolationSpline100PresetDef>},
+{"spline144", "interpolation", 0.0f, CreatePreset<InterpolationSpline144PresetDef>},
+{"spline16-fast", "interpolation", 0.0f, CreatePreset<InterpolationSpline16FastPresetDef>},
+{"spline256", "interpolation", 0.0f, CreatePreset<InterpolationSpline256PresetDef>},
+{"spline36-fast", "interpolation", 0.0f, CreatePreset<InterpolationSpline36FastPresetDef>},
+{"spline64", "interpolation", 0.0f, CreatePreset<InterpolationSpline64PresetDef>},
+{"linear-gamma-correct", "linear", 0.0f, CreatePreset<LinearLinearGammaCorrectPresetDef>},
+{"accessibility_mods", "misc", 0.0f, CreatePreset<MiscAccessibility_modsPresetDef>},
+{"anti-flicker", "misc", 0.0f, CreatePreset<MiscAntiFlickerPresetDef>},
+{"ascii", "misc", 0.0f, CreatePreset<MiscAsciiPresetDef>},
+{"bead", "misc", 0.0f, CreatePreset<MiscBeadPresetDef>},
+{"bob-deinterlacing", "misc", 0.0f, CreatePreset<MiscBobDeinterlacingPresetDef>},
+{"chroma", "misc", 0.0f, CreatePreset<MiscChromaPresetDef>},
+{"chromaticity", "misc", 0.0f, CreatePreset<MiscChromaticityPresetDef>},
+{"cmyk-halftone-dot", "misc", 0.0f, CreatePreset<MiscCmykHalftoneDotPresetDef>},
+{"cocktail-cabinet", "misc", 0.0f, CreatePreset<MiscCocktailCabinetPresetDef>},
+{"color-mangler", "misc", 0.0f, CreatePreset<MiscColorManglerPresetDef>},
+{"colorimetry", "misc", 0.0f, CreatePreset<MiscColorimetryPresetDef>},
+{"convergence", "misc", 0.0f, CreatePreset<MiscConvergencePresetDef>},
+{"deband", "misc", 0.0f, CreatePreset<MiscDebandPresetDef>},
+{"deinterlace", "misc", 0.0f, CreatePreset<MiscDeinterlacePresetDef>},
+{"edge-detect", "misc", 0.0f, CreatePreset<MiscEdgeDetectPresetDef>},
+{"ega", "misc", 0.0f, CreatePreset<MiscEgaPresetDef>},
+{"geom-append", "misc", 0.0f, CreatePreset<MiscGeomAppendPresetDef>},
+{"geom", "misc", 0.0f, CreatePreset<MiscGeomPresetDef>},
+{"glass", "misc", 0.0f, CreatePreset<MiscGlassPresetDef>},
+{"grade-no-LUT", "misc", 0.0f, CreatePreset<MiscGradeNoLUTPresetDef>},
+{"grade", "misc", 0.0f, CreatePreset<MiscGradePresetDef>},
+{"half_res", "misc", 0.0f, CreatePreset<MiscHalf_resPresetDef>},
+{"image-adjustment", "misc", 0.0f, CreatePreset<MiscImageAdjustmentPresetDef>},
+{"img_mod", "misc", 0.0f, CreatePreset<MiscImg_modPresetDef>},
+{"interlacing", "misc", 0.0f, CreatePreset<MiscInterlacingPresetDef>},
+{"natural-vision", "misc", 0.0f, CreatePreset<MiscNaturalVisionPresetDef>},
+{"night-mode", "misc", 0.0f, CreatePreset<MiscNightModePresetDef>},
+{"ntsc-colors", "misc", 0.0f, CreatePreset<MiscNtscColorsPresetDef>},
+{"patchy-color", "misc", 0.0f, CreatePreset<MiscPatchyColorPresetDef>},
+{"relief", "misc", 0.0f, CreatePreset<MiscReliefPresetDef>},
+{"retro-palettes", "misc", 0.0f, CreatePreset<MiscRetroPalettesPresetDef>},
+{"simple_color_controls", "misc", 0.0f, CreatePreset<MiscSimple_color_controlsPresetDef>},
+{"ss-gamma-ramp", "misc", 0.0f, CreatePreset<MiscSsGammaRampPresetDef>},
+{"test-pattern-append", "misc", 0.0f, CreatePreset<MiscTestPatternAppendPresetDef>},
+{"test-pattern-prepend", "misc", 0.0f, CreatePreset<MiscTestPatternPrependPresetDef>},
+{"tonemapping", "misc", 0.0f, CreatePreset<MiscTonemappingPresetDef>},
+{"white_point", "misc", 0.0f, CreatePreset<MiscWhite_pointPresetDef>},
+{"yiq-hue-adjustment", "misc", 0.0f, CreatePreset<MiscYiqHueAdjustmentPresetDef>},
+{"motion_interpolation", "motion-interpolation", 0.0f, CreatePreset<MotionInterpolationMotion_interpolationPresetDef>},
+{"braid-rewind", "motionblur", 0.0f, CreatePreset<MotionblurBraidRewindPresetDef>},
+{"feedback", "motionblur", 0.0f, CreatePreset<MotionblurFeedbackPresetDef>},
+{"mix_frames", "motionblur", 0.0f, CreatePreset<MotionblurMix_framesPresetDef>},
+{"mix_frames_smart", "motionblur", 0.0f, CreatePreset<MotionblurMix_frames_smartPresetDef>},
+{"motionblur-blue", "motionblur", 0.0f, CreatePreset<MotionblurMotionblurBluePresetDef>},
+{"motionblur-color", "motionblur", 0.0f, CreatePreset<MotionblurMotionblurColorPresetDef>},
+{"motionblur-simple", "motionblur", 0.0f, CreatePreset<MotionblurMotionblurSimplePresetDef>},
+{"response-time", "motionblur", 0.0f, CreatePreset<MotionblurResponseTimePresetDef>},
+{"nearest", "stock", 0.0f, CreatePreset<StockNearestPresetDef>},
+{"cgwg-famicom-geom", "nes_raw_palette", 0.0f, CreatePreset<Nes_raw_paletteCgwgFamicomGeomPresetDef>},
+{"gtu-famicom", "nes_raw_palette", 0.0f, CreatePreset<Nes_raw_paletteGtuFamicomPresetDef>},
+{"ntsc-nes", "nes_raw_palette", 0.0f, CreatePreset<Nes_raw_paletteNtscNesPresetDef>},
+{"pal-r57shell-raw", "nes_raw_palette", 0.0f, CreatePreset<Nes_raw_palettePalR57shellRawPresetDef>},
+{"patchy-mesen-raw-palette", "nes_raw_palette", 0.0f, CreatePreset<Nes_raw_palettePatchyMesenRawPalettePresetDef>},
+{"artifact-colors", "ntsc", 0.0f, CreatePreset<NtscArtifactColorsPresetDef>},
+{"blargg", "ntsc", 0.0f, CreatePreset<NtscBlarggPresetDef>},
+{"mame-ntsc", "ntsc", 0.0f, CreatePreset<NtscMameNtscPresetDef>},
+{"ntsc-256px-composite-scanline", "ntsc", 0.0f, CreatePreset<NtscNtsc256pxCompositeScanlinePresetDef>},
+{"ntsc-256px-composite", "ntsc", 0.0f, CreatePreset<NtscNtsc256pxCompositePresetDef>},
+{"ntsc-256px-svideo-scanline", "ntsc", 0.0f, CreatePreset<NtscNtsc256pxSvideoScanlinePresetDef>},
+{"ntsc-256px-svideo", "ntsc", 0.0f, CreatePreset<NtscNtsc256pxSvideoPresetDef>},
+{"ntsc-320px-composite-scanline", "ntsc", 0.0f, CreatePreset<NtscNtsc320pxCompositeScanlinePresetDef>},
+{"ntsc-320px-composite", "ntsc", 0.0f, CreatePreset<NtscNtsc320pxCompositePresetDef>},
+{"ntsc-320px-svideo-scanline", "ntsc", 0.0f, CreatePreset<NtscNtsc320pxSvideoScanlinePresetDef>},
+{"ntsc-320px-svideo", "ntsc", 0.0f, CreatePreset<NtscNtsc320pxSvideoPresetDef>},
+{"ntsc-adaptive-4x", "ntsc", 0.0f, CreatePreset<NtscNtscAdaptive4xPresetDef>},
+{"ntsc-adaptive-old-4x", "ntsc", 0.0f, CreatePreset<NtscNtscAdaptiveOld4xPresetDef>},
+{"ntsc-adaptive-old", "ntsc", 0.0f, CreatePreset<NtscNtscAdaptiveOldPresetDef>},
+{"ntsc-adaptive-tate", "ntsc", 0.0f, CreatePreset<NtscNtscAdaptiveTatePresetDef>},
+{"ntsc-adaptive", "ntsc", 0.0f, CreatePreset<NtscNtscAdaptivePresetDef>},
+{"ntsc-blastem", "ntsc", 0.0f, CreatePreset<NtscNtscBlastemPresetDef>},
+{"ntsc-md-rainbows", "ntsc", 0.0f, CreatePreset<NtscNtscMdRainbowsPresetDef>},
+{"ntsc-mini", "ntsc", 0.0f, CreatePreset<NtscNtscMiniPresetDef>},
+{"ntsc-simple", "ntsc", 0.0f, CreatePreset<NtscNtscSimplePresetDef>},
+{"ntsc-xot", "ntsc", 0.0f, CreatePreset<NtscNtscXotPresetDef>},
+{"patchy-blastem", "ntsc", 0.0f, CreatePreset<NtscPatchyBlastemPresetDef>},
+{"patchy-genplusgx", "ntsc", 0.0f, CreatePreset<NtscPatchyGenplusgxPresetDef>},
+{"patchy-snes", "ntsc", 0.0f, CreatePreset<NtscPatchySnesPresetDef>},
+{"tiny_ntsc", "ntsc", 0.0f, CreatePreset<NtscTiny_ntscPresetDef>},
+{"pal-r57shell-moire-only", "pal", 0.0f, CreatePreset<PalPalR57shellMoireOnlyPresetDef>},
+{"pal-r57shell", "pal", 0.0f, CreatePreset<PalPalR57shellPresetDef>},
+{"pal-singlepass", "pal", 0.0f, CreatePreset<PalPalSinglepassPresetDef>},
+{"aann", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingAannPresetDef>},
+{"bandlimit-pixel", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingBandlimitPixelPresetDef>},
+{"bilinear-adjustable", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingBilinearAdjustablePresetDef>},
+{"box_filter_aa_xform", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingBox_filter_aa_xformPresetDef>},
+{"cleanEdge-rotate", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingCleanEdgeRotatePresetDef>},
+{"controlled_sharpness", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingControlled_sharpnessPresetDef>},
+{"edge1pixel", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingEdge1pixelPresetDef>},
+{"edgeNpixels", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingEdgeNpixelsPresetDef>},
+{"grid-blend-hybrid", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingGridBlendHybridPresetDef>},
+{"pixellate", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingPixellatePresetDef>},
+{"pixel_aa", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingPixel_aaPresetDef>},
+{"pixel_aa_fast", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingPixel_aa_fastPresetDef>},
+{"pixel_aa_single_pass", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingPixel_aa_single_passPresetDef>},
+{"pixel_aa_xform", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingPixel_aa_xformPresetDef>},
+{"sharp-bilinear-2x-prescale", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingSharpBilinear2xPrescalePresetDef>},
+{"sharp-bilinear-scanlines", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingSharpBilinearScanlinesPresetDef>},
+{"sharp-bilinear-simple", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingSharpBilinearSimplePresetDef>},
+{"sharp-bilinear", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingSharpBilinearPresetDef>},
+{"sharp-shimmerless", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingSharpShimmerlessPresetDef>},
+{"smootheststep", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingSmootheststepPresetDef>},
+{"smuberstep", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingSmuberstepPresetDef>},
+{"soft-pixel-art", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingSoftPixelArtPresetDef>},
+{"uniform-nearest", "pixel-art-scaling", 0.0f, CreatePreset<PixelArtScalingUniformNearestPresetDef>},
+{"dual-bloom-filter-aa-lv2-fsr-gamma-ramp-glass", "presets/blurs", 0.0f, CreatePreset<PresetsBlursDualBloomFilterAaLv2FsrGammaRampGlassPresetDef>},
+{"dual-bloom-filter-aa-lv2-fsr-gamma-ramp", "presets/blurs", 0.0f, CreatePreset<PresetsBlursDualBloomFilterAaLv2FsrGammaRampPresetDef>},
+{"dual-bloom-filter-aa-lv2-fsr", "presets/blurs", 0.0f, CreatePreset<PresetsBlursDualBloomFilterAaLv2FsrPresetDef>},
+{"gizmo-composite-blur-aa-lv2-fsr-gamma-ramp-gsharp-resampler", "presets/blurs", 0.0f, CreatePreset<PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampGsharpResamplerPresetDef>},
+{"gizmo-composite-blur-aa-lv2-fsr-gamma-ramp", "presets/blurs", 0.0f, CreatePreset<PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampPresetDef>},
+{"gizmo-composite-blur-aa-lv2-fsr-gsharp-resampler", "presets/blurs", 0.0f, CreatePreset<PresetsBlursGizmoCompositeBlurAaLv2FsrGsharpResamplerPresetDef>},
+{"gizmo-composite-blur-aa-lv2-fsr", "presets/blurs", 0.0f, CreatePreset<PresetsBlursGizmoCompositeBlurAaLv2FsrPresetDef>},
+{"kawase-glow-bspline-4taps-fsr-gamma-ramp-tonemapping", "presets/blurs", 0.0f, CreatePreset<PresetsBlursKawaseGlowBspline4tapsFsrGammaRampTonemappingPresetDef>},
+{"smartblur-bspline-4taps-fsr-gamma-ramp-vhs", "presets/blurs", 0.0f, CreatePreset<PresetsBlursSmartblurBspline4tapsFsrGammaRampVhsPresetDef>},
+{"smartblur-bspline-4taps-fsr-gamma-ramp", "presets/blurs", 0.0f, CreatePreset<PresetsBlursSmartblurBspline4tapsFsrGammaRampPresetDef>},
+{"smartblur-bspline-4taps-fsr", "presets/blurs", 0.0f, CreatePreset<PresetsBlursSmartblurBspline4tapsFsrPresetDef>},
+{"crt-geom-simple", "presets", 0.0f, CreatePreset<PresetsCrtGeomSimplePresetDef>},
+{"crt-hyllian-sinc-smartblur-sgenpt", "presets", 0.0f, CreatePreset<PresetsCrtHyllianSincSmartblurSgenptPresetDef>},
+{"crt-hyllian-smartblur-sgenpt", "presets", 0.0f, CreatePreset<PresetsCrtHyllianSmartblurSgenptPresetDef>},
+{"crt-lottes-multipass-interlaced-glow", "presets", 0.0f, CreatePreset<PresetsCrtLottesMultipassInterlacedGlowPresetDef>},
+{"composite-glow", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpCompositeGlowPresetDef>},
+{"composite", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpCompositePresetDef>},
+{"svideo-ntsc_x4-glow", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpSvideoNtsc_x4GlowPresetDef>},
+{"svideo-ntsc_x4", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpSvideoNtsc_x4PresetDef>},
+{"svideo-ntsc_x5-glow", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpSvideoNtsc_x5GlowPresetDef>},
+{"svideo-ntsc_x5", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpSvideoNtsc_x5PresetDef>},
+{"svideo-ntsc_x6-glow", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpSvideoNtsc_x6GlowPresetDef>},
+{"svideo-ntsc_x6", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpSvideoNtsc_x6PresetDef>},
+{"tate-composite-glow", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpTateCompositeGlowPresetDef>},
+{"tate-composite", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpTateCompositePresetDef>},
+{"tate-svideo-ntsc_x4-glow", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpTateSvideoNtsc_x4GlowPresetDef>},
+{"tate-svideo-ntsc_x4", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpTateSvideoNtsc_x4PresetDef>},
+{"tate-svideo-ntsc_x5-glow", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpTateSvideoNtsc_x5GlowPresetDef>},
+{"tate-svideo-ntsc_x5", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpTateSvideoNtsc_x5PresetDef>},
+{"tate-svideo-ntsc_x6-glow", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpTateSvideoNtsc_x6GlowPresetDef>},
+{"tate-svideo-ntsc_x6", "presets/crt-ntsc-sharp", 0.0f, CreatePreset<PresetsCrtNtscSharpTateSvideoNtsc_x6PresetDef>},
+{"c64-monitor", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalC64MonitorPresetDef>},
+{"crt-geom-deluxe-ntsc-adaptive", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalCrtGeomDeluxeNtscAdaptivePresetDef>},
+{"crt-royale-fast-ntsc-composite", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalCrtRoyaleFastNtscCompositePresetDef>},
+{"crt-royale-ntsc-composite", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalCrtRoyaleNtscCompositePresetDef>},
+{"crt-royale-ntsc-svideo", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalCrtRoyaleNtscSvideoPresetDef>},
+{"crt-royale-pal-r57shell", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalCrtRoyalePalR57shellPresetDef>},
+{"crtglow_gauss_ntsc", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalCrtglow_gauss_ntscPresetDef>},
+{"fakelottes-ntsc-composite", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalFakelottesNtscCompositePresetDef>},
+{"fakelottes-ntsc-svideo", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalFakelottesNtscSvideoPresetDef>},
+{"my_old_tv", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalMy_old_tvPresetDef>},
+{"ntsc-phosphorlut", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalNtscPhosphorlutPresetDef>},
+{"ntsclut-phosphorlut", "presets/crt-plus-signal", 0.0f, CreatePreset<PresetsCrtPlusSignalNtsclutPhosphorlutPresetDef>},
+{"crt-potato-colorimetry-convergence", "presets/crt-potato", 0.0f, CreatePreset<PresetsCrtPotatoCrtPotatoColorimetryConvergencePresetDef>},
+{"crt-royale-downsample", "presets", 0.0f, CreatePreset<PresetsCrtRoyaleDownsamplePresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture-genesis-rainbow-effect", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture-genesis", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisPresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture-psx", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePsxPresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture-snes", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureSnesPresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask-genesis-rainbow-effect", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask-genesis", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask-psx", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask-snes", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPresetDef>},
+{"crt-royale-fast-ntsc-rf-slotmask-nes", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastNtscRfSlotmaskNesPresetDef>},
+{"crt-royale-fast-rgb-aperture", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastRgbAperturePresetDef>},
+{"crt-royale-fast-rgb-slot", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyaleFastRgbSlotPresetDef>},
+{"crt-royale-pvm-ntsc-composite-genesis-rainbow-effect", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef>},
+{"crt-royale-pvm-ntsc-composite-genesis", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisPresetDef>},
+{"crt-royale-pvm-ntsc-composite-psx", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePsxPresetDef>},
+{"crt-royale-pvm-ntsc-composite-snes", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeSnesPresetDef>},
+{"crt-royale-pvm-ntsc-composite", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePresetDef>},
+{"crt-royale-pvm-rgb-blend", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyalePvmRgbBlendPresetDef>},
+{"crt-royale-pvm-rgb-shmup", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyalePvmRgbShmupPresetDef>},
+{"crt-royale-pvm-rgb", "presets/crt-royale-fast/4k", 0.0f, CreatePreset<PresetsCrtRoyaleFast4kCrtRoyalePvmRgbPresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture-genesis-rainbow-effect", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture-genesis", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisPresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture-psx", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePsxPresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture-snes", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureSnesPresetDef>},
+{"crt-royale-fast-ntsc-composite-aperture", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask-genesis-rainbow-effect", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask-genesis", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask-psx", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask-snes", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef>},
+{"crt-royale-fast-ntsc-composite-slotmask", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPresetDef>},
+{"crt-royale-fast-ntsc-rf-slotmask-nes", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastNtscRfSlotmaskNesPresetDef>},
+{"crt-royale-fast-rgb-aperture", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastRgbAperturePresetDef>},
+{"crt-royale-fast-rgb-slot", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyaleFastRgbSlotPresetDef>},
+{"crt-royale-pvm-ntsc-composite-genesis-rainbow-effect", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef>},
+{"crt-royale-pvm-ntsc-composite-genesis", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisPresetDef>},
+{"crt-royale-pvm-ntsc-composite-psx", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePsxPresetDef>},
+{"crt-royale-pvm-ntsc-composite-snes", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeSnesPresetDef>},
+{"crt-royale-pvm-ntsc-composite", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePresetDef>},
+{"crt-royale-pvm-rgb-blend", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyalePvmRgbBlendPresetDef>},
+{"crt-royale-pvm-rgb-shmup", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyalePvmRgbShmupPresetDef>},
+{"crt-royale-pvm-rgb", "presets/crt-royale-fast", 0.0f, CreatePreset<PresetsCrtRoyaleFastCrtRoyalePvmRgbPresetDef>},
+{"crt-royale-kurozumi", "presets", 0.0f, CreatePreset<PresetsCrtRoyaleKurozumiPresetDef>},
+{"crt-royale-smooth", "presets", 0.0f, CreatePreset<PresetsCrtRoyaleSmoothPresetDef>},
+{"crt-royale-xm29plus", "presets", 0.0f, CreatePreset<PresetsCrtRoyaleXm29plusPresetDef>},
+{"crtsim-grungy", "presets", 0.0f, CreatePreset<PresetsCrtsimGrungyPresetDef>},
+{"drez-8x-fsr-aa-lv2-bspline-4taps", "presets/downsample", 0.0f, CreatePreset<PresetsDownsampleDrez8xFsrAaLv2Bspline4tapsPresetDef>},
+{"fsr-aa-lv2-bspline-4taps-ntsc-colors", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2Bspline4tapsNtscColorsPresetDef>},
+{"fsr-aa-lv2-bspline-4taps", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2Bspline4tapsPresetDef>},
+{"fsr-aa-lv2-deblur", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2DeblurPresetDef>},
+{"fsr-aa-lv2-glass", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2GlassPresetDef>},
+{"fsr-aa-lv2-kawase5blur-ntsc-colors-glass", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2Kawase5blurNtscColorsGlassPresetDef>},
+{"fsr-aa-lv2-kawase5blur-ntsc-colors", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2Kawase5blurNtscColorsPresetDef>},
+{"fsr-aa-lv2-median3x3-glass", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2Median3x3GlassPresetDef>},
+{"fsr-aa-lv2-median3x3-ntsc-colors-glass", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2Median3x3NtscColorsGlassPresetDef>},
+{"fsr-aa-lv2-median3x3-ntsc-colors", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2Median3x3NtscColorsPresetDef>},
+{"fsr-aa-lv2-median3x3", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2Median3x3PresetDef>},
+{"fsr-aa-lv2-naturalvision-glass", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2NaturalvisionGlassPresetDef>},
+{"fsr-aa-lv2-naturalvision-vhs", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2NaturalvisionVhsPresetDef>},
+{"fsr-aa-lv2-naturalvision", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2NaturalvisionPresetDef>},
+{"fsr-aa-lv2-sabr-hybrid-deposterize", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2SabrHybridDeposterizePresetDef>},
+{"fsr-aa-lv2-vhs", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2VhsPresetDef>},
+{"fsr-aa-lv2", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrAaLv2PresetDef>},
+{"fsr-crt-potato-bvm-vhs", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrCrtPotatoBvmVhsPresetDef>},
+{"fsr-crt-potato-bvm", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrCrtPotatoBvmPresetDef>},
+{"fsr-crt-potato-colorimetry-convergence", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrCrtPotatoColorimetryConvergencePresetDef>},
+{"fsr-crt-potato-warm-colorimetry-convergence", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrCrtPotatoWarmColorimetryConvergencePresetDef>},
+{"fsr-crtroyale-xm29plus", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrCrtroyaleXm29plusPresetDef>},
+{"fsr-crtroyale", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrCrtroyalePresetDef>},
+{"fsr-lv2-aa-chromacity-glass", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrLv2AaChromacityGlassPresetDef>},
+{"fsr-smaa-colorimetry-convergence", "presets/fsr", 0.0f, CreatePreset<PresetsFsrFsrSmaaColorimetryConvergencePresetDef>},
+{"gameboy-advance-dot-matrix-sepia", "presets", 0.0f, CreatePreset<PresetsGameboyAdvanceDotMatrixSepiaPresetDef>},
+{"gizmo-crt-curvator", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtCurvatorPresetDef>},
+{"gizmo-crt-megadrive-curvator", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtMegadriveCurvatorPresetDef>},
+{"gizmo-crt-megadrive", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtMegadrivePresetDef>},
+{"gizmo-crt-n64-curvator", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtN64CurvatorPresetDef>},
+{"gizmo-crt-n64", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtN64PresetDef>},
+{"gizmo-crt-psx-curvator", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtPsxCurvatorPresetDef>},
+{"gizmo-crt-psx", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtPsxPresetDef>},
+{"gizmo-crt-snes-4k", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtSnes4kPresetDef>},
+{"gizmo-crt-snes-curvator-4k", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtSnesCurvator4kPresetDef>},
+{"gizmo-crt-snes-dark-curvator", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtSnesDarkCurvatorPresetDef>},
+{"gizmo-crt-snes-dark", "presets/gizmo-crt", 0.0f, CreatePreset<PresetsGizmoCrtGizmoCrtSnesDarkPresetDef>},
+{"agb001-gba-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModAgb001GbaColorMotionblurPresetDef>},
+{"ags001-gba-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModAgs001GbaColorMotionblurPresetDef>},
+{"bandlimit-pixel-gba-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModBandlimitPixelGbaColorPresetDef>},
+{"lcd-grid-v2-dslite-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2DsliteColorMotionblurPresetDef>},
+{"lcd-grid-v2-dslite-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2DsliteColorPresetDef>},
+{"lcd-grid-v2-gba-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2GbaColorMotionblurPresetDef>},
+{"lcd-grid-v2-gba-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2GbaColorPresetDef>},
+{"lcd-grid-v2-gbc-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2GbcColorMotionblurPresetDef>},
+{"lcd-grid-v2-gbc-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2GbcColorPresetDef>},
+{"lcd-grid-v2-gbMicro-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2GbMicroColorMotionblurPresetDef>},
+{"lcd-grid-v2-gbMicro-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2GbMicroColorPresetDef>},
+{"lcd-grid-v2-nds-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2NdsColorMotionblurPresetDef>},
+{"lcd-grid-v2-nds-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2NdsColorPresetDef>},
+{"lcd-grid-v2-palm-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2PalmColorMotionblurPresetDef>},
+{"lcd-grid-v2-palm-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2PalmColorPresetDef>},
+{"lcd-grid-v2-psp-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2PspColorMotionblurPresetDef>},
+{"lcd-grid-v2-psp-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2PspColorPresetDef>},
+{"lcd-grid-v2-sp101-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2Sp101ColorMotionblurPresetDef>},
+{"lcd-grid-v2-sp101-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2Sp101ColorPresetDef>},
+{"lcd-grid-v2-vba-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2VbaColorMotionblurPresetDef>},
+{"lcd-grid-v2-vba-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModLcdGridV2VbaColorPresetDef>},
+{"retro-v2+gba-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModRetroV2GbaColorPresetDef>},
+{"retro-v2+gbc-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModRetroV2GbcColorPresetDef>},
+{"retro-v2+image-adjustment", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModRetroV2ImageAdjustmentPresetDef>},
+{"retro-v2+nds-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModRetroV2NdsColorPresetDef>},
+{"retro-v2+psp-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModRetroV2PspColorPresetDef>},
+{"retro-v2+vba-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModRetroV2VbaColorPresetDef>},
+{"retro-v3-nds-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModRetroV3NdsColorPresetDef>},
+{"sameboy-lcd-gbc-color-motionblur", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModSameboyLcdGbcColorMotionblurPresetDef>},
+{"simpletex_lcd+gba-color-4k", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModSimpletex_lcdGbaColor4kPresetDef>},
+{"simpletex_lcd+gba-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModSimpletex_lcdGbaColorPresetDef>},
+{"simpletex_lcd+gbc-color-4k", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModSimpletex_lcdGbcColor4kPresetDef>},
+{"simpletex_lcd+gbc-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModSimpletex_lcdGbcColorPresetDef>},
+{"simpletex_lcd_720p+gba-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModSimpletex_lcd_720pGbaColorPresetDef>},
+{"simpletex_lcd_720p+gbc-color", "presets/handheld-plus-color-mod", 0.0f, CreatePreset<PresetsHandheldPlusColorModSimpletex_lcd_720pGbcColorPresetDef>},
+{"imgborder-royale-kurozumi", "presets", 0.0f, CreatePreset<PresetsImgborderRoyaleKurozumiPresetDef>},
+{"bspline-4taps-aa-lv2-fsr-gamma-ramp", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationBspline4tapsAaLv2FsrGammaRampPresetDef>},
+{"bspline-4taps-aa-lv2-fsr-powervr", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationBspline4tapsAaLv2FsrPowervrPresetDef>},
+{"bspline-4taps-aa-lv2-fsr", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationBspline4tapsAaLv2FsrPresetDef>},
+{"bspline-4taps-aa-lv2", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationBspline4tapsAaLv2PresetDef>},
+{"bspline-4taps-fsr-vhs", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationBspline4tapsFsrVhsPresetDef>},
+{"lanczos2-5taps-fsr-gamma-ramp-vhs", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationLanczos25tapsFsrGammaRampVhsPresetDef>},
+{"lanczos2-5taps-fsr-gamma-ramp", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationLanczos25tapsFsrGammaRampPresetDef>},
+{"lanczos2-5taps-fsr", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationLanczos25tapsFsrPresetDef>},
+{"spline36-fast-fsr-gamma-ramp-vhs", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationSpline36FastFsrGammaRampVhsPresetDef>},
+{"spline36-fast-fsr-gamma-ramp", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationSpline36FastFsrGammaRampPresetDef>},
+{"spline36-fast-fsr", "presets/interpolation", 0.0f, CreatePreset<PresetsInterpolationSpline36FastFsrPresetDef>},
+{"mdapt+fast-bilateral+super-4xbr+scanlines", "presets", 0.0f, CreatePreset<PresetsMdaptFastBilateralSuper4xbrScanlinesPresetDef>},
+{"nedi-powervr-sharpen", "presets", 0.0f, CreatePreset<PresetsNediPowervrSharpenPresetDef>},
+{"nes-color-decoder+colorimetry+pixellate", "presets", 0.0f, CreatePreset<PresetsNesColorDecoderColorimetryPixellatePresetDef>},
+{"nes-color-decoder+pixellate", "presets", 0.0f, CreatePreset<PresetsNesColorDecoderPixellatePresetDef>},
+{"scalefx+rAA+aa-fast", "presets/scalefx-plus-smoothing", 0.0f, CreatePreset<PresetsScalefxPlusSmoothingScalefxRAAAaFastPresetDef>},
+{"scalefx+rAA+aa", "presets/scalefx-plus-smoothing", 0.0f, CreatePreset<PresetsScalefxPlusSmoothingScalefxRAAAaPresetDef>},
+{"scalefx-aa-fast", "presets/scalefx-plus-smoothing", 0.0f, CreatePreset<PresetsScalefxPlusSmoothingScalefxAaFastPresetDef>},
+{"scalefx-aa", "presets/scalefx-plus-smoothing", 0.0f, CreatePreset<PresetsScalefxPlusSmoothingScalefxAaPresetDef>},
+{"scalefx9-aa-blur-hazy-ntsc-sh1nra358", "presets/scalefx-plus-smoothing", 0.0f, CreatePreset<PresetsScalefxPlusSmoothingScalefx9AaBlurHazyNtscSh1nra358PresetDef>},
+{"scalefx9-aa-blur-hazy-vibrance-sh1nra358", "presets/scalefx-plus-smoothing", 0.0f, CreatePreset<PresetsScalefxPlusSmoothingScalefx9AaBlurHazyVibranceSh1nra358PresetDef>},
+{"xsoft+scalefx-level2aa+sharpsmoother", "presets/scalefx-plus-smoothing", 0.0f, CreatePreset<PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaSharpsmootherPresetDef>},
+{"xsoft+scalefx-level2aa", "presets/scalefx-plus-smoothing", 0.0f, CreatePreset<PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaPresetDef>},
+{"tvout+nes-color-decoder", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNesColorDecoderPresetDef>},
+{"tvout+ntsc-256px-composite", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNtsc256pxCompositePresetDef>},
+{"tvout+ntsc-256px-svideo", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNtsc256pxSvideoPresetDef>},
+{"tvout+ntsc-2phase-composite", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNtsc2phaseCompositePresetDef>},
+{"tvout+ntsc-2phase-svideo", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNtsc2phaseSvideoPresetDef>},
+{"tvout+ntsc-320px-composite", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNtsc320pxCompositePresetDef>},
+{"tvout+ntsc-320px-svideo", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNtsc320pxSvideoPresetDef>},
+{"tvout+ntsc-3phase-composite", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNtsc3phaseCompositePresetDef>},
+{"tvout+ntsc-3phase-svideo", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNtsc3phaseSvideoPresetDef>},
+{"tvout+ntsc-nes", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutNtscNesPresetDef>},
+{"tvout+snes-hires-blend", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutSnesHiresBlendPresetDef>},
+{"tvout-jinc-sharpen", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutJincSharpenPresetDef>},
+{"tvout-pixelsharp", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutPixelsharpPresetDef>},
+{"tvout", "presets/tvout", 0.0f, CreatePreset<PresetsTvoutTvoutPresetDef>},
+{"tvout+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutInterlacingPresetDef>},
+{"tvout+nes-color-decoder+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNesColorDecoderInterlacingPresetDef>},
+{"tvout+ntsc-256px-composite+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNtsc256pxCompositeInterlacingPresetDef>},
+{"tvout+ntsc-256px-svideo+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNtsc256pxSvideoInterlacingPresetDef>},
+{"tvout+ntsc-2phase-composite+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNtsc2phaseCompositeInterlacingPresetDef>},
+{"tvout+ntsc-2phase-svideo+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNtsc2phaseSvideoInterlacingPresetDef>},
+{"tvout+ntsc-320px-composite+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNtsc320pxCompositeInterlacingPresetDef>},
+{"tvout+ntsc-320px-svideo+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNtsc320pxSvideoInterlacingPresetDef>},
+{"tvout+ntsc-3phase-composite+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNtsc3phaseCompositeInterlacingPresetDef>},
+{"tvout+ntsc-3phase-svideo+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNtsc3phaseSvideoInterlacingPresetDef>},
+{"tvout+ntsc-nes+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutNtscNesInterlacingPresetDef>},
+{"tvout-jinc-sharpen+interlacing", "presets/tvout-interlacing", 0.0f, CreatePreset<PresetsTvoutInterlacingTvoutJincSharpenInterlacingPresetDef>},
+{"xbr-lv3-2xsal-lv2-aa-soft", "presets/xbr-xsal", 0.0f, CreatePreset<PresetsXbrXsalXbrLv32xsalLv2AaSoftPresetDef>},
+{"xbr-lv3-2xsal-lv2-aa", "presets/xbr-xsal", 0.0f, CreatePreset<PresetsXbrXsalXbrLv32xsalLv2AaPresetDef>},
+{"xbr-lv3-aa-fast", "presets/xbr-xsal", 0.0f, CreatePreset<PresetsXbrXsalXbrLv3AaFastPresetDef>},
+{"xbr-lv3-aa-soft-fast", "presets/xbr-xsal", 0.0f, CreatePreset<PresetsXbrXsalXbrLv3AaSoftFastPresetDef>},
+{"blendoverlay", "reshade", 0.0f, CreatePreset<ReshadeBlendoverlayPresetDef>},
+{"bloom", "reshade", 0.0f, CreatePreset<ReshadeBloomPresetDef>},
+{"bsnes-gamma-ramp", "reshade", 0.0f, CreatePreset<ReshadeBsnesGammaRampPresetDef>},
+{"FilmGrain", "reshade", 0.0f, CreatePreset<ReshadeFilmGrainPresetDef>},
+{"halftone-print", "reshade", 0.0f, CreatePreset<ReshadeHalftonePrintPresetDef>},
+{"DSLite-2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsDSLite2020PresetDef>},
+{"DSLite-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsDSLiteP3PresetDef>},
+{"DSLite-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsDSLiteSRGBPresetDef>},
+{"GBA-2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBA2020PresetDef>},
+{"GBA-P3-dark", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBAP3DarkPresetDef>},
+{"GBA-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBAP3PresetDef>},
+{"GBA-rec2020-dark", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBARec2020DarkPresetDef>},
+{"GBA-rec2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBARec2020PresetDef>},
+{"GBA-sRGB-dark", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBASRGBDarkPresetDef>},
+{"GBA-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBASRGBPresetDef>},
+{"GBA_GBC-2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBA_GBC2020PresetDef>},
+{"GBA_GBC-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBA_GBCP3PresetDef>},
+{"GBA_GBC-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBA_GBCSRGBPresetDef>},
+{"GBC Dev Colorspace", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBCDevColorspacePresetDef>},
+{"GBC-2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBC2020PresetDef>},
+{"GBC-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBCP3PresetDef>},
+{"GBC-rec2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBCRec2020PresetDef>},
+{"GBC-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBCSRGBPresetDef>},
+{"GBMicro-2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBMicro2020PresetDef>},
+{"GBMicro-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBMicroP3PresetDef>},
+{"GBMicro-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsGBMicroSRGBPresetDef>},
+{"NDS-2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsNDS2020PresetDef>},
+{"NDS-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsNDSP3PresetDef>},
+{"NDS-rec2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsNDSRec2020PresetDef>},
+{"NDS-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsNDSSRGBPresetDef>},
+{"NSO-GBA", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsNSOGBAPresetDef>},
+{"NSO-GBC", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsNSOGBCPresetDef>},
+{"PSP-2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsPSP2020PresetDef>},
+{"PSP-P3(pure-gamma2.2)", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsPSPP3PureGamma22PresetDef>},
+{"PSP-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsPSPP3PresetDef>},
+{"PSP-rec2020(sRGB-gamma2.2)", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsPSPRec2020SRGBGamma22PresetDef>},
+{"PSP-rec2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsPSPRec2020PresetDef>},
+{"PSP-sRGB(sRGB-gamma2.2)", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsPSPSRGBSRGBGamma22PresetDef>},
+{"PSP-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsPSPSRGBPresetDef>},
+{"SP101-2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSP1012020PresetDef>},
+{"SP101-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSP101P3PresetDef>},
+{"SP101-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSP101SRGBPresetDef>},
+{"SwitchOLED-P3(sRGB-gamma2.2)", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSwitchOLEDP3SRGBGamma22PresetDef>},
+{"SwitchOLED-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSwitchOLEDP3PresetDef>},
+{"SwitchOLED-rec2020(sRGB-gamma2.2)", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSwitchOLEDRec2020SRGBGamma22PresetDef>},
+{"SwitchOLED-rec2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSwitchOLEDRec2020PresetDef>},
+{"SwitchOLED-sRGB(sRGB-Gamma2.2)", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSwitchOLEDSRGBSRGBGamma22PresetDef>},
+{"SwitchOLED-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSwitchOLEDSRGBPresetDef>},
+{"SWOLED-2020", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSWOLED2020PresetDef>},
+{"SWOLED-P3", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSWOLEDP3PresetDef>},
+{"SWOLED-sRGB", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsSWOLEDSRGBPresetDef>},
+{"VBA Colorspace", "reshade/handheld-color-LUTs", 0.0f, CreatePreset<ReshadeHandheldColorLUTsVBAColorspacePresetDef>},
+{"lut", "reshade", 0.0f, CreatePreset<ReshadeLutPresetDef>},
+{"magicbloom", "reshade", 0.0f, CreatePreset<ReshadeMagicbloomPresetDef>},
+{"NormalsDisplacement", "reshade", 0.0f, CreatePreset<ReshadeNormalsDisplacementPresetDef>},
+{"RC GDV-NTSC - Arcade - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCArcadeCleanPresetDef>},
+{"RC GDV-NTSC - Arcade - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCArcadeDirtyPresetDef>},
+{"RC GDV-NTSC - Arcade RGB", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCArcadeRGBPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCDOSHighResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCDOSHighResDirtyPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCDOSLowResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCDOSLowResDirtyPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCDreamcastCleanPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCDreamcastDirtyPresetDef>},
+{"RC GDV-NTSC - GBA - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCGBACleanPresetDef>},
+{"RC GDV-NTSC - GBA - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCGBADirtyPresetDef>},
+{"RC GDV-NTSC - Master System - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCMasterSystemCleanPresetDef>},
+{"RC GDV-NTSC - Master System - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCMasterSystemDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCMegaDriveCleanPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCMegaDriveDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive RF 100", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCMegaDriveRF100PresetDef>},
+{"RC GDV-NTSC - Mega Drive RGB 100", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCMegaDriveRGB100PresetDef>},
+{"RC GDV-NTSC - N64", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCN64PresetDef>},
+{"RC GDV-NTSC - NES - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCNESCleanPresetDef>},
+{"RC GDV-NTSC - NES - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCNESDirtyPresetDef>},
+{"RC GDV-NTSC - NES Composite 100", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCNESComposite100PresetDef>},
+{"RC GDV-NTSC - NES RGB 100", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCNESRGB100PresetDef>},
+{"RC GDV-NTSC - PCE Composite 100", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPCEComposite100PresetDef>},
+{"RC GDV-NTSC - PCE RGB 100", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPCERGB100PresetDef>},
+{"RC GDV-NTSC - PCE", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPCEPresetDef>},
+{"RC GDV-NTSC - PlayStation - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPlayStationCleanPresetDef>},
+{"RC GDV-NTSC - PlayStation - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPlayStationDirtyPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 240p", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPlayStationRGB100240pPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 480i", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPlayStationRGB100480iPresetDef>},
+{"RC GDV-NTSC - PS2 - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPS2CleanPresetDef>},
+{"RC GDV-NTSC - PS2 - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPS2DirtyPresetDef>},
+{"RC GDV-NTSC - PS2", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCPS2PresetDef>},
+{"RC GDV-NTSC - Saturn", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCSaturnPresetDef>},
+{"RC GDV-NTSC - SGB - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCSGBCleanPresetDef>},
+{"RC GDV-NTSC - SGB - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCSGBDirtyPresetDef>},
+{"RC GDV-NTSC - SNES - Clean", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCSNESCleanPresetDef>},
+{"RC GDV-NTSC - SNES - Dirty", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCSNESDirtyPresetDef>},
+{"RC GDV-NTSC - SNES RF 100", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCSNESRF100PresetDef>},
+{"RC GDV-NTSC - SNES RGB 100", "retro-crisis/1080p-Curved", 0.0f, CreatePreset<RetroCrisis1080pCurvedRCGDVNTSCSNESRGB100PresetDef>},
+{"RC GDV-NTSC - Arcade - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCArcadeCleanPresetDef>},
+{"RC GDV-NTSC - Arcade - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCArcadeDirtyPresetDef>},
+{"RC GDV-NTSC - Arcade RGB", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCArcadeRGBPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCDOSHighResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCDOSHighResDirtyPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCDOSLowResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCDOSLowResDirtyPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCDreamcastCleanPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCDreamcastDirtyPresetDef>},
+{"RC GDV-NTSC - GBA - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCGBACleanPresetDef>},
+{"RC GDV-NTSC - GBA - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCGBADirtyPresetDef>},
+{"RC GDV-NTSC - Master System - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCMasterSystemCleanPresetDef>},
+{"RC GDV-NTSC - Master System - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCMasterSystemDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCMegaDriveCleanPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCMegaDriveDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive RF 100", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCMegaDriveRF100PresetDef>},
+{"RC GDV-NTSC - Mega Drive RGB 100", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCMegaDriveRGB100PresetDef>},
+{"RC GDV-NTSC - N64", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCN64PresetDef>},
+{"RC GDV-NTSC - NES - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCNESCleanPresetDef>},
+{"RC GDV-NTSC - NES - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCNESDirtyPresetDef>},
+{"RC GDV-NTSC - NES Composite 100", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCNESComposite100PresetDef>},
+{"RC GDV-NTSC - NES RGB 100", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCNESRGB100PresetDef>},
+{"RC GDV-NTSC - PCE Composite 100", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPCEComposite100PresetDef>},
+{"RC GDV-NTSC - PCE RGB 100", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPCERGB100PresetDef>},
+{"RC GDV-NTSC - PCE", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPCEPresetDef>},
+{"RC GDV-NTSC - PlayStation - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPlayStationCleanPresetDef>},
+{"RC GDV-NTSC - PlayStation - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPlayStationDirtyPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 240p", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPlayStationRGB100240pPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 480i", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPlayStationRGB100480iPresetDef>},
+{"RC GDV-NTSC - PS2 - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPS2CleanPresetDef>},
+{"RC GDV-NTSC - PS2 - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPS2DirtyPresetDef>},
+{"RC GDV-NTSC - PS2", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCPS2PresetDef>},
+{"RC GDV-NTSC - Saturn", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCSaturnPresetDef>},
+{"RC GDV-NTSC - SGB - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCSGBCleanPresetDef>},
+{"RC GDV-NTSC - SGB - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCSGBDirtyPresetDef>},
+{"RC GDV-NTSC - SNES - Clean", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCSNESCleanPresetDef>},
+{"RC GDV-NTSC - SNES - Dirty", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCSNESDirtyPresetDef>},
+{"RC GDV-NTSC - SNES RF 100", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCSNESRF100PresetDef>},
+{"RC GDV-NTSC - SNES RGB 100", "retro-crisis/1080p-Flat", 0.0f, CreatePreset<RetroCrisis1080pFlatRCGDVNTSCSNESRGB100PresetDef>},
+{"RC GDV-NTSC - Arcade - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCArcadeCleanPresetDef>},
+{"RC GDV-NTSC - Arcade - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCArcadeDirtyPresetDef>},
+{"RC GDV-NTSC - Arcade RGB", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCArcadeRGBPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCDOSHighResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCDOSHighResDirtyPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCDOSLowResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCDOSLowResDirtyPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCDreamcastCleanPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCDreamcastDirtyPresetDef>},
+{"RC GDV-NTSC - GBA - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCGBACleanPresetDef>},
+{"RC GDV-NTSC - GBA - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCGBADirtyPresetDef>},
+{"RC GDV-NTSC - Master System - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCMasterSystemCleanPresetDef>},
+{"RC GDV-NTSC - Master System - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCMasterSystemDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCMegaDriveCleanPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCMegaDriveDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive RF 100", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCMegaDriveRF100PresetDef>},
+{"RC GDV-NTSC - Mega Drive RGB 100", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCMegaDriveRGB100PresetDef>},
+{"RC GDV-NTSC - N64", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCN64PresetDef>},
+{"RC GDV-NTSC - NES - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCNESCleanPresetDef>},
+{"RC GDV-NTSC - NES - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCNESDirtyPresetDef>},
+{"RC GDV-NTSC - NES Composite 100", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCNESComposite100PresetDef>},
+{"RC GDV-NTSC - NES RGB 100", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCNESRGB100PresetDef>},
+{"RC GDV-NTSC - PCE Composite 100", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPCEComposite100PresetDef>},
+{"RC GDV-NTSC - PCE RGB 100", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPCERGB100PresetDef>},
+{"RC GDV-NTSC - PCE", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPCEPresetDef>},
+{"RC GDV-NTSC - PlayStation - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPlayStationCleanPresetDef>},
+{"RC GDV-NTSC - PlayStation - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPlayStationDirtyPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 240p", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPlayStationRGB100240pPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 480i", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPlayStationRGB100480iPresetDef>},
+{"RC GDV-NTSC - PS2 - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPS2CleanPresetDef>},
+{"RC GDV-NTSC - PS2 - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPS2DirtyPresetDef>},
+{"RC GDV-NTSC - PS2", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCPS2PresetDef>},
+{"RC GDV-NTSC - Saturn", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCSaturnPresetDef>},
+{"RC GDV-NTSC - SGB - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCSGBCleanPresetDef>},
+{"RC GDV-NTSC - SGB - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCSGBDirtyPresetDef>},
+{"RC GDV-NTSC - SNES - Clean", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCSNESCleanPresetDef>},
+{"RC GDV-NTSC - SNES - Dirty", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCSNESDirtyPresetDef>},
+{"RC GDV-NTSC - SNES RF 100", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCSNESRF100PresetDef>},
+{"RC GDV-NTSC - SNES RGB 100", "retro-crisis/1440p-Curved", 0.0f, CreatePreset<RetroCrisis1440pCurvedRCGDVNTSCSNESRGB100PresetDef>},
+{"RC GDV-NTSC - Arcade - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCArcadeCleanPresetDef>},
+{"RC GDV-NTSC - Arcade - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCArcadeDirtyPresetDef>},
+{"RC GDV-NTSC - Arcade RGB", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCArcadeRGBPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCDOSHighResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCDOSHighResDirtyPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCDOSLowResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCDOSLowResDirtyPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCDreamcastCleanPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCDreamcastDirtyPresetDef>},
+{"RC GDV-NTSC - GBA - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCGBACleanPresetDef>},
+{"RC GDV-NTSC - GBA - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCGBADirtyPresetDef>},
+{"RC GDV-NTSC - Master System - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCMasterSystemCleanPresetDef>},
+{"RC GDV-NTSC - Master System - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCMasterSystemDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCMegaDriveCleanPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCMegaDriveDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive RF 100", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCMegaDriveRF100PresetDef>},
+{"RC GDV-NTSC - Mega Drive RGB 100", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCMegaDriveRGB100PresetDef>},
+{"RC GDV-NTSC - N64", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCN64PresetDef>},
+{"RC GDV-NTSC - NES - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCNESCleanPresetDef>},
+{"RC GDV-NTSC - NES - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCNESDirtyPresetDef>},
+{"RC GDV-NTSC - NES Composite 100", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCNESComposite100PresetDef>},
+{"RC GDV-NTSC - NES RGB 100", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCNESRGB100PresetDef>},
+{"RC GDV-NTSC - PCE Composite 100", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPCEComposite100PresetDef>},
+{"RC GDV-NTSC - PCE RGB 100", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPCERGB100PresetDef>},
+{"RC GDV-NTSC - PCE", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPCEPresetDef>},
+{"RC GDV-NTSC - PlayStation - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPlayStationCleanPresetDef>},
+{"RC GDV-NTSC - PlayStation - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPlayStationDirtyPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 240p", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPlayStationRGB100240pPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 480i", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPlayStationRGB100480iPresetDef>},
+{"RC GDV-NTSC - PS2 - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPS2CleanPresetDef>},
+{"RC GDV-NTSC - PS2 - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPS2DirtyPresetDef>},
+{"RC GDV-NTSC - PS2", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCPS2PresetDef>},
+{"RC GDV-NTSC - Saturn", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCSaturnPresetDef>},
+{"RC GDV-NTSC - SGB - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCSGBCleanPresetDef>},
+{"RC GDV-NTSC - SGB - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCSGBDirtyPresetDef>},
+{"RC GDV-NTSC - SNES - Clean", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCSNESCleanPresetDef>},
+{"RC GDV-NTSC - SNES - Dirty", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCSNESDirtyPresetDef>},
+{"RC GDV-NTSC - SNES RF 100", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCSNESRF100PresetDef>},
+{"RC GDV-NTSC - SNES RGB 100", "retro-crisis/1440p-Flat", 0.0f, CreatePreset<RetroCrisis1440pFlatRCGDVNTSCSNESRGB100PresetDef>},
+{"RC GDV-NTSC - Arcade - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCArcadeCleanPresetDef>},
+{"RC GDV-NTSC - Arcade - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCArcadeDirtyPresetDef>},
+{"RC GDV-NTSC - Arcade RGB", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCArcadeRGBPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCDOSHighResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCDOSHighResDirtyPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCDOSLowResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCDOSLowResDirtyPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCDreamcastCleanPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCDreamcastDirtyPresetDef>},
+{"RC GDV-NTSC - GBA - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCGBACleanPresetDef>},
+{"RC GDV-NTSC - GBA - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCGBADirtyPresetDef>},
+{"RC GDV-NTSC - Master System - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCMasterSystemCleanPresetDef>},
+{"RC GDV-NTSC - Master System - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCMasterSystemDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCMegaDriveCleanPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCMegaDriveDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive RF 100", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCMegaDriveRF100PresetDef>},
+{"RC GDV-NTSC - Mega Drive RGB 100", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCMegaDriveRGB100PresetDef>},
+{"RC GDV-NTSC - N64", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCN64PresetDef>},
+{"RC GDV-NTSC - NES - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCNESCleanPresetDef>},
+{"RC GDV-NTSC - NES - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCNESDirtyPresetDef>},
+{"RC GDV-NTSC - NES Composite 100", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCNESComposite100PresetDef>},
+{"RC GDV-NTSC - NES RGB 100", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCNESRGB100PresetDef>},
+{"RC GDV-NTSC - PCE Composite 100", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPCEComposite100PresetDef>},
+{"RC GDV-NTSC - PCE RGB 100", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPCERGB100PresetDef>},
+{"RC GDV-NTSC - PCE", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPCEPresetDef>},
+{"RC GDV-NTSC - PlayStation - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPlayStationCleanPresetDef>},
+{"RC GDV-NTSC - PlayStation - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPlayStationDirtyPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 240p", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPlayStationRGB100240pPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 480i", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPlayStationRGB100480iPresetDef>},
+{"RC GDV-NTSC - PS2 - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPS2CleanPresetDef>},
+{"RC GDV-NTSC - PS2 - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPS2DirtyPresetDef>},
+{"RC GDV-NTSC - PS2", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCPS2PresetDef>},
+{"RC GDV-NTSC - Saturn", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCSaturnPresetDef>},
+{"RC GDV-NTSC - SGB - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCSGBCleanPresetDef>},
+{"RC GDV-NTSC - SGB - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCSGBDirtyPresetDef>},
+{"RC GDV-NTSC - SNES - Clean", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCSNESCleanPresetDef>},
+{"RC GDV-NTSC - SNES - Dirty", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCSNESDirtyPresetDef>},
+{"RC GDV-NTSC - SNES RF 100", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCSNESRF100PresetDef>},
+{"RC GDV-NTSC - SNES RGB 100", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCSNESRGB100PresetDef>},
+{"RC GDV-NTSC - VHS 1080p - Curved", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCVHS1080pCurvedPresetDef>},
+{"RC GDV-NTSC - VHS 2160p - Curved", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCVHS2160pCurvedPresetDef>},
+{"RC GDV-NTSC - VHS 240p - Curved", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCVHS240pCurvedPresetDef>},
+{"RC GDV-NTSC - VHS 360p - Curved", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCVHS360pCurvedPresetDef>},
+{"RC GDV-NTSC - VHS 480p - Curved", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCVHS480pCurvedPresetDef>},
+{"RC GDV-NTSC - VHS 720p - Curved", "retro-crisis/4K-Curved", 0.0f, CreatePreset<RetroCrisis4KCurvedRCGDVNTSCVHS720pCurvedPresetDef>},
+{"RC GDV-NTSC - Arcade - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCArcadeCleanPresetDef>},
+{"RC GDV-NTSC - Arcade - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCArcadeDirtyPresetDef>},
+{"RC GDV-NTSC - Arcade RGB", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCArcadeRGBPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCDOSHighResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCDOSHighResDirtyPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCDOSLowResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCDOSLowResDirtyPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCDreamcastCleanPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCDreamcastDirtyPresetDef>},
+{"RC GDV-NTSC - GBA - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCGBACleanPresetDef>},
+{"RC GDV-NTSC - GBA - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCGBADirtyPresetDef>},
+{"RC GDV-NTSC - Master System - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCMasterSystemCleanPresetDef>},
+{"RC GDV-NTSC - Master System - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCMasterSystemDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCMegaDriveCleanPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCMegaDriveDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive RF 100", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCMegaDriveRF100PresetDef>},
+{"RC GDV-NTSC - Mega Drive RGB 100", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCMegaDriveRGB100PresetDef>},
+{"RC GDV-NTSC - N64", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCN64PresetDef>},
+{"RC GDV-NTSC - NES - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCNESCleanPresetDef>},
+{"RC GDV-NTSC - NES - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCNESDirtyPresetDef>},
+{"RC GDV-NTSC - NES Composite 100", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCNESComposite100PresetDef>},
+{"RC GDV-NTSC - NES RGB 100", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCNESRGB100PresetDef>},
+{"RC GDV-NTSC - PCE Composite 100", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPCEComposite100PresetDef>},
+{"RC GDV-NTSC - PCE RGB 100", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPCERGB100PresetDef>},
+{"RC GDV-NTSC - PCE", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPCEPresetDef>},
+{"RC GDV-NTSC - PlayStation - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPlayStationCleanPresetDef>},
+{"RC GDV-NTSC - PlayStation - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPlayStationDirtyPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 240p", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPlayStationRGB100240pPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 480i", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPlayStationRGB100480iPresetDef>},
+{"RC GDV-NTSC - PS2 - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPS2CleanPresetDef>},
+{"RC GDV-NTSC - PS2 - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPS2DirtyPresetDef>},
+{"RC GDV-NTSC - PS2", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCPS2PresetDef>},
+{"RC GDV-NTSC - Saturn", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCSaturnPresetDef>},
+{"RC GDV-NTSC - SGB - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCSGBCleanPresetDef>},
+{"RC GDV-NTSC - SGB - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCSGBDirtyPresetDef>},
+{"RC GDV-NTSC - SNES - Clean", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCSNESCleanPresetDef>},
+{"RC GDV-NTSC - SNES - Dirty", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCSNESDirtyPresetDef>},
+{"RC GDV-NTSC - SNES RF 100", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCSNESRF100PresetDef>},
+{"RC GDV-NTSC - SNES RGB 100", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCSNESRGB100PresetDef>},
+{"RC GDV-NTSC - VHS 1080p", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCVHS1080pPresetDef>},
+{"RC GDV-NTSC - VHS 2160p", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCVHS2160pPresetDef>},
+{"RC GDV-NTSC - VHS 240p", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCVHS240pPresetDef>},
+{"RC GDV-NTSC - VHS 360p", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCVHS360pPresetDef>},
+{"RC GDV-NTSC - VHS 480p", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCVHS480pPresetDef>},
+{"RC GDV-NTSC - VHS 720p", "retro-crisis/4K-Flat", 0.0f, CreatePreset<RetroCrisis4KFlatRCGDVNTSCVHS720pPresetDef>},
+{"RC GDV-NTSC - Arcade - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCArcadeCleanPresetDef>},
+{"RC GDV-NTSC - Arcade - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCArcadeDirtyPresetDef>},
+{"RC GDV-NTSC - Arcade RGB", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCArcadeRGBPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCDOSHighResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - High Res - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCDOSHighResDirtyPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCDOSLowResCleanPresetDef>},
+{"RC GDV-NTSC - DOS - Low Res - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCDOSLowResDirtyPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCDreamcastCleanPresetDef>},
+{"RC GDV-NTSC - Dreamcast - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCDreamcastDirtyPresetDef>},
+{"RC GDV-NTSC - GBA - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCGBACleanPresetDef>},
+{"RC GDV-NTSC - GBA - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCGBADirtyPresetDef>},
+{"RC GDV-NTSC - Master System - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCMasterSystemCleanPresetDef>},
+{"RC GDV-NTSC - Master System - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCMasterSystemDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCMegaDriveCleanPresetDef>},
+{"RC GDV-NTSC - Mega Drive - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCMegaDriveDirtyPresetDef>},
+{"RC GDV-NTSC - Mega Drive RF 100", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCMegaDriveRF100PresetDef>},
+{"RC GDV-NTSC - Mega Drive RGB 100", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCMegaDriveRGB100PresetDef>},
+{"RC GDV-NTSC - N64", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCN64PresetDef>},
+{"RC GDV-NTSC - NES - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCNESCleanPresetDef>},
+{"RC GDV-NTSC - NES - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCNESDirtyPresetDef>},
+{"RC GDV-NTSC - NES Composite 100", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCNESComposite100PresetDef>},
+{"RC GDV-NTSC - NES RGB 100", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCNESRGB100PresetDef>},
+{"RC GDV-NTSC - PCE Composite 100", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPCEComposite100PresetDef>},
+{"RC GDV-NTSC - PCE RGB 100", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPCERGB100PresetDef>},
+{"RC GDV-NTSC - PCE", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPCEPresetDef>},
+{"RC GDV-NTSC - PlayStation - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPlayStationCleanPresetDef>},
+{"RC GDV-NTSC - PlayStation - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPlayStationDirtyPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 240p", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPlayStationRGB100240pPresetDef>},
+{"RC GDV-NTSC - PlayStation RGB 100 - 480i", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPlayStationRGB100480iPresetDef>},
+{"RC GDV-NTSC - PS2 - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPS2CleanPresetDef>},
+{"RC GDV-NTSC - PS2 - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPS2DirtyPresetDef>},
+{"RC GDV-NTSC - PS2", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCPS2PresetDef>},
+{"RC GDV-NTSC - Saturn", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCSaturnPresetDef>},
+{"RC GDV-NTSC - SGB - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCSGBCleanPresetDef>},
+{"RC GDV-NTSC - SGB - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCSGBDirtyPresetDef>},
+{"RC GDV-NTSC - SNES - Clean", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCSNESCleanPresetDef>},
+{"RC GDV-NTSC - SNES - Dirty", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCSNESDirtyPresetDef>},
+{"RC GDV-NTSC - SNES RF 100", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCSNESRF100PresetDef>},
+{"RC GDV-NTSC - SNES RGB 100", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCSNESRGB100PresetDef>},
+{"RC GDV-NTSC - VHS 1080p", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCVHS1080pPresetDef>},
+{"RC GDV-NTSC - VHS 2160p", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCVHS2160pPresetDef>},
+{"RC GDV-NTSC - VHS 240p", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCVHS240pPresetDef>},
+{"RC GDV-NTSC - VHS 360p", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCVHS360pPresetDef>},
+{"RC GDV-NTSC - VHS 480p", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCVHS480pPresetDef>},
+{"RC GDV-NTSC - VHS 720p", "retro-crisis/720p-Steam-Deck", 0.0f, CreatePreset<RetroCrisis720pSteamDeckRCGDVNTSCVHS720pPresetDef>},
+{"integer-scaling-scanlines", "scanlines", 0.0f, CreatePreset<ScanlinesIntegerScalingScanlinesPresetDef>},
+{"ossc", "scanlines", 0.0f, CreatePreset<ScanlinesOsscPresetDef>},
+{"ossc_slot", "scanlines", 0.0f, CreatePreset<ScanlinesOssc_slotPresetDef>},
+{"res-independent-scanlines", "scanlines", 0.0f, CreatePreset<ScanlinesResIndependentScanlinesPresetDef>},
+{"scanline-fract", "scanlines", 0.0f, CreatePreset<ScanlinesScanlineFractPresetDef>},
+{"scanline", "scanlines", 0.0f, CreatePreset<ScanlinesScanlinePresetDef>},
+{"scanlines-rere", "scanlines", 0.0f, CreatePreset<ScanlinesScanlinesRerePresetDef>},
+{"scanlines-sine-abs", "scanlines", 0.0f, CreatePreset<ScanlinesScanlinesSineAbsPresetDef>},
+{"adaptive-sharpen-multipass", "sharpen", 0.0f, CreatePreset<SharpenAdaptiveSharpenMultipassPresetDef>},
+{"adaptive-sharpen", "sharpen", 0.0f, CreatePreset<SharpenAdaptiveSharpenPresetDef>},
+{"Anime4k", "sharpen", 0.0f, CreatePreset<SharpenAnime4kPresetDef>},
+{"cheap-sharpen", "sharpen", 0.0f, CreatePreset<SharpenCheapSharpenPresetDef>},
+{"rca_sharpen", "sharpen", 0.0f, CreatePreset<SharpenRca_sharpenPresetDef>},
+{"super-xbr-super-res", "sharpen", 0.0f, CreatePreset<SharpenSuperXbrSuperResPresetDef>},
+{"01-u-normal-rf", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p011080pCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p021080pCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p031080pCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p041080pCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p051080pCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p061080pCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p071080pCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p081080pCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p091080pCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p101080pCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p111080pCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p121080pCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p131080pCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p141080pCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p151080pCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p161080pCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p171080pCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p181080pCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p191080pCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p201080pCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p211080pCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p221080pCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p231080pCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p241080pCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p251080pCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p261080pCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p271080pCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p281080pCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p291080pCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p301080pCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p311080pCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p321080pCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p331080pCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p341080pCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p351080pCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p361080pCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p371080pCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p381080pCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p391080pCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p401080pCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p411080pCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p421080pCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p431080pCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p441080pCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/aperture-grille/curved-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1080p451080pCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p011440pCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p021440pCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p031440pCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p041440pCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p051440pCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p061440pCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p071440pCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p081440pCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p091440pCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p101440pCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p111440pCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p121440pCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p131440pCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p141440pCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p151440pCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p161440pCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p171440pCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p181440pCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p191440pCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p201440pCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p211440pCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p221440pCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p231440pCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p241440pCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p251440pCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p261440pCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p271440pCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p281440pCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p291440pCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p301440pCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p311440pCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p321440pCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p331440pCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p341440pCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p351440pCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p361440pCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p371440pCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p381440pCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p391440pCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p401440pCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p411440pCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p421440pCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p431440pCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p441440pCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/aperture-grille/curved-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen1440p451440pCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k014kCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k024kCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k034kCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k044kCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k054kCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k064kCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k074kCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k084kCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k094kCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k104kCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k114kCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k124kCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k134kCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k144kCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k154kCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k164kCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k174kCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k184kCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k194kCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k204kCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k214kCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k224kCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k234kCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k244kCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k254kCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k264kCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k274kCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k284kCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k294kCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k304kCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k314kCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k324kCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k334kCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k344kCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k354kCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k364kCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k374kCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k384kCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k394kCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k404kCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k414kCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k424kCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k434kCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k444kCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/aperture-grille/curved-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleCurvedScreen4k454kCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p011080pCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p021080pCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p031080pCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p041080pCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p051080pCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p061080pCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p071080pCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p081080pCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p091080pCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p101080pCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p111080pCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p121080pCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p131080pCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p141080pCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p151080pCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p161080pCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p171080pCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p181080pCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p191080pCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p201080pCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p211080pCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p221080pCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p231080pCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p241080pCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p251080pCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p261080pCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p271080pCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p281080pCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p291080pCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p301080pCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p311080pCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p321080pCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p331080pCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p341080pCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p351080pCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p361080pCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p371080pCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p381080pCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p391080pCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p401080pCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p411080pCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p421080pCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p431080pCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p441080pCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/aperture-grille/flat-screen/1080p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1080p451080pCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p011440pCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p021440pCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p031440pCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p041440pCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p051440pCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p061440pCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p071440pCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p081440pCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p091440pCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p101440pCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p111440pCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p121440pCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p131440pCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p141440pCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p151440pCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p161440pCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p171440pCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p181440pCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p191440pCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p201440pCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p211440pCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p221440pCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p231440pCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p241440pCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p251440pCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p261440pCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p271440pCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p281440pCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p291440pCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p301440pCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p311440pCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p321440pCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p331440pCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p341440pCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p351440pCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p361440pCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p371440pCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p381440pCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p391440pCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p401440pCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p411440pCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p421440pCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p431440pCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p441440pCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/aperture-grille/flat-screen/1440p", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen1440p451440pCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k014kCrtGuestAdvancedHdApertureGrilleUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k024kCrtGuestAdvancedHdApertureGrilleUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k034kCrtGuestAdvancedHdApertureGrilleUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k044kCrtGuestAdvancedHdApertureGrilleUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k054kCrtGuestAdvancedHdApertureGrilleUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k064kCrtGuestAdvancedHdApertureGrilleUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k074kCrtGuestAdvancedHdApertureGrilleUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k084kCrtGuestAdvancedHdApertureGrilleUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k094kCrtGuestAdvancedHdApertureGrilleUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k104kCrtGuestAdvancedHdApertureGrilleUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k114kCrtGuestAdvancedHdApertureGrilleUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k124kCrtGuestAdvancedHdApertureGrilleUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k134kCrtGuestAdvancedHdApertureGrilleUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k144kCrtGuestAdvancedHdApertureGrilleUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k154kCrtGuestAdvancedHdApertureGrilleUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k164kCrtGuestAdvancedHdApertureGrilleJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k174kCrtGuestAdvancedHdApertureGrilleJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k184kCrtGuestAdvancedHdApertureGrilleJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k194kCrtGuestAdvancedHdApertureGrilleJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k204kCrtGuestAdvancedHdApertureGrilleJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k214kCrtGuestAdvancedHdApertureGrilleJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k224kCrtGuestAdvancedHdApertureGrilleJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k234kCrtGuestAdvancedHdApertureGrilleJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k244kCrtGuestAdvancedHdApertureGrilleJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k254kCrtGuestAdvancedHdApertureGrilleJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k264kCrtGuestAdvancedHdApertureGrilleJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k274kCrtGuestAdvancedHdApertureGrilleJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k284kCrtGuestAdvancedHdApertureGrilleJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k294kCrtGuestAdvancedHdApertureGrilleJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k304kCrtGuestAdvancedHdApertureGrilleJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k314kCrtGuestAdvancedHdApertureGrillePalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k324kCrtGuestAdvancedHdApertureGrillePalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k334kCrtGuestAdvancedHdApertureGrillePalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k344kCrtGuestAdvancedHdApertureGrillePalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k354kCrtGuestAdvancedHdApertureGrillePalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k364kCrtGuestAdvancedHdApertureGrillePalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k374kCrtGuestAdvancedHdApertureGrillePalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k384kCrtGuestAdvancedHdApertureGrillePalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k394kCrtGuestAdvancedHdApertureGrillePalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k404kCrtGuestAdvancedHdApertureGrillePalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k414kCrtGuestAdvancedHdApertureGrillePalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k424kCrtGuestAdvancedHdApertureGrillePalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k434kCrtGuestAdvancedHdApertureGrillePalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k444kCrtGuestAdvancedHdApertureGrillePalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/aperture-grille/flat-screen/4k", 0.0f, CreatePreset<SonkunApertureGrilleFlatScreen4k454kCrtGuestAdvancedHdApertureGrillePalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p011080pCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p021080pCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p031080pCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p041080pCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p051080pCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p061080pCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p071080pCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p081080pCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p091080pCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p101080pCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p111080pCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p121080pCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p131080pCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p141080pCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p151080pCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p161080pCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p171080pCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p181080pCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p191080pCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p201080pCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p211080pCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p221080pCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p231080pCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p241080pCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p251080pCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p261080pCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p271080pCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p281080pCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p291080pCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p301080pCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p311080pCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p321080pCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p331080pCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p341080pCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p351080pCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p361080pCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p371080pCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p381080pCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p391080pCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p401080pCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p411080pCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p421080pCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p431080pCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p441080pCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/shadow-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1080p451080pCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p011440pCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p021440pCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p031440pCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p041440pCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p051440pCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p061440pCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p071440pCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p081440pCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p091440pCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p101440pCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p111440pCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p121440pCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p131440pCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p141440pCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p151440pCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p161440pCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p171440pCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p181440pCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p191440pCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p201440pCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p211440pCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p221440pCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p231440pCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p241440pCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p251440pCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p261440pCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p271440pCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p281440pCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p291440pCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p301440pCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p311440pCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p321440pCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p331440pCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p341440pCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p351440pCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p361440pCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p371440pCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p381440pCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p391440pCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p401440pCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p411440pCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p421440pCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p431440pCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p441440pCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/shadow-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen1440p451440pCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k014kCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k024kCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k034kCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k044kCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k054kCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k064kCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k074kCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k084kCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k094kCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k104kCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k114kCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k124kCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k134kCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k144kCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k154kCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k164kCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k174kCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k184kCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k194kCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k204kCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k214kCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k224kCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k234kCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k244kCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k254kCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k264kCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k274kCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k284kCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k294kCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k304kCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k314kCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k324kCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k334kCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k344kCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k354kCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k364kCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k374kCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k384kCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k394kCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k404kCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k414kCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k424kCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k434kCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k444kCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/shadow-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskCurvedScreen4k454kCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p011080pCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p021080pCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p031080pCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p041080pCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p051080pCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p061080pCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p071080pCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p081080pCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p091080pCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p101080pCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p111080pCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p121080pCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p131080pCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p141080pCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p151080pCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p161080pCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p171080pCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p181080pCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p191080pCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p201080pCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p211080pCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p221080pCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p231080pCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p241080pCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p251080pCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p261080pCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p271080pCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p281080pCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p291080pCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p301080pCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p311080pCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p321080pCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p331080pCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p341080pCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p351080pCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p361080pCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p371080pCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p381080pCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p391080pCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p401080pCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p411080pCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p421080pCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p431080pCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p441080pCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/shadow-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1080p451080pCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p011440pCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p021440pCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p031440pCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p041440pCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p051440pCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p061440pCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p071440pCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p081440pCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p091440pCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p101440pCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p111440pCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p121440pCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p131440pCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p141440pCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p151440pCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p161440pCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p171440pCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p181440pCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p191440pCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p201440pCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p211440pCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p221440pCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p231440pCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p241440pCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p251440pCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p261440pCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p271440pCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p281440pCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p291440pCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p301440pCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p311440pCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p321440pCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p331440pCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p341440pCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p351440pCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p361440pCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p371440pCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p381440pCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p391440pCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p401440pCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p411440pCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p421440pCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p431440pCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p441440pCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/shadow-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen1440p451440pCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k014kCrtGuestAdvancedHdShadowMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k024kCrtGuestAdvancedHdShadowMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k034kCrtGuestAdvancedHdShadowMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k044kCrtGuestAdvancedHdShadowMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k054kCrtGuestAdvancedHdShadowMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k064kCrtGuestAdvancedHdShadowMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k074kCrtGuestAdvancedHdShadowMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k084kCrtGuestAdvancedHdShadowMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k094kCrtGuestAdvancedHdShadowMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k104kCrtGuestAdvancedHdShadowMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k114kCrtGuestAdvancedHdShadowMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k124kCrtGuestAdvancedHdShadowMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k134kCrtGuestAdvancedHdShadowMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k144kCrtGuestAdvancedHdShadowMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k154kCrtGuestAdvancedHdShadowMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k164kCrtGuestAdvancedHdShadowMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k174kCrtGuestAdvancedHdShadowMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k184kCrtGuestAdvancedHdShadowMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k194kCrtGuestAdvancedHdShadowMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k204kCrtGuestAdvancedHdShadowMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k214kCrtGuestAdvancedHdShadowMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k224kCrtGuestAdvancedHdShadowMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k234kCrtGuestAdvancedHdShadowMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k244kCrtGuestAdvancedHdShadowMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k254kCrtGuestAdvancedHdShadowMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k264kCrtGuestAdvancedHdShadowMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k274kCrtGuestAdvancedHdShadowMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k284kCrtGuestAdvancedHdShadowMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k294kCrtGuestAdvancedHdShadowMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k304kCrtGuestAdvancedHdShadowMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k314kCrtGuestAdvancedHdShadowMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k324kCrtGuestAdvancedHdShadowMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k334kCrtGuestAdvancedHdShadowMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k344kCrtGuestAdvancedHdShadowMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k354kCrtGuestAdvancedHdShadowMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k364kCrtGuestAdvancedHdShadowMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k374kCrtGuestAdvancedHdShadowMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k384kCrtGuestAdvancedHdShadowMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k394kCrtGuestAdvancedHdShadowMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k404kCrtGuestAdvancedHdShadowMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k414kCrtGuestAdvancedHdShadowMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k424kCrtGuestAdvancedHdShadowMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k434kCrtGuestAdvancedHdShadowMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k444kCrtGuestAdvancedHdShadowMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/shadow-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunShadowMaskFlatScreen4k454kCrtGuestAdvancedHdShadowMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p011080pCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p021080pCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p031080pCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p041080pCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p051080pCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p061080pCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p071080pCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p081080pCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p091080pCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p101080pCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p111080pCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p121080pCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p131080pCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p141080pCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p151080pCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p161080pCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p171080pCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p181080pCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p191080pCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p201080pCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p211080pCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p221080pCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p231080pCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p241080pCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p251080pCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p261080pCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p271080pCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p281080pCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p291080pCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p301080pCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p311080pCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p321080pCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p331080pCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p341080pCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p351080pCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p361080pCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p371080pCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p381080pCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p391080pCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p401080pCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p411080pCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p421080pCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p431080pCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p441080pCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/slot-mask/curved-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1080p451080pCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p011440pCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p021440pCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p031440pCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p041440pCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p051440pCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p061440pCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p071440pCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p081440pCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p091440pCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p101440pCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p111440pCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p121440pCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p131440pCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p141440pCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p151440pCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p161440pCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p171440pCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p181440pCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p191440pCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p201440pCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p211440pCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p221440pCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p231440pCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p241440pCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p251440pCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p261440pCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p271440pCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p281440pCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p291440pCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p301440pCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p311440pCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p321440pCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p331440pCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p341440pCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p351440pCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p361440pCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p371440pCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p381440pCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p391440pCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p401440pCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p411440pCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p421440pCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p431440pCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p441440pCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/slot-mask/curved-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen1440p451440pCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k014kCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k024kCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k034kCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k044kCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k054kCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k064kCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k074kCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k084kCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k094kCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k104kCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k114kCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k124kCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k134kCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k144kCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k154kCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k164kCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k174kCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k184kCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k194kCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k204kCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k214kCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k224kCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k234kCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k244kCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k254kCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k264kCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k274kCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k284kCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k294kCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k304kCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k314kCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k324kCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k334kCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k344kCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k354kCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k364kCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k374kCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k384kCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k394kCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k404kCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k414kCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k424kCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k434kCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k444kCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/slot-mask/curved-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskCurvedScreen4k454kCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p011080pCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p021080pCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p031080pCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p041080pCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p051080pCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p061080pCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p071080pCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p081080pCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p091080pCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p101080pCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p111080pCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p121080pCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p131080pCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p141080pCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p151080pCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p161080pCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p171080pCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p181080pCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p191080pCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p201080pCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p211080pCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p221080pCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p231080pCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p241080pCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p251080pCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p261080pCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p271080pCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p281080pCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p291080pCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p301080pCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p311080pCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p321080pCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p331080pCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p341080pCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p351080pCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p361080pCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p371080pCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p381080pCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p391080pCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p401080pCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p411080pCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p421080pCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p431080pCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p441080pCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/slot-mask/flat-screen/1080p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1080p451080pCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p011440pCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p021440pCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p031440pCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p041440pCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p051440pCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p061440pCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p071440pCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p081440pCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p091440pCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p101440pCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p111440pCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p121440pCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p131440pCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p141440pCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p151440pCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p161440pCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p171440pCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p181440pCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p191440pCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p201440pCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p211440pCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p221440pCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p231440pCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p241440pCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p251440pCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p261440pCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p271440pCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p281440pCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p291440pCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p301440pCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p311440pCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p321440pCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p331440pCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p341440pCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p351440pCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p361440pCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p371440pCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p381440pCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p391440pCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p401440pCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p411440pCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p421440pCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p431440pCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p441440pCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/slot-mask/flat-screen/1440p", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen1440p451440pCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef>},
+{"01-u-normal-rf", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k014kCrtGuestAdvancedHdSlotMaskUNormalRfPresetDef>},
+{"02-u-normal-composite", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k024kCrtGuestAdvancedHdSlotMaskUNormalCompositePresetDef>},
+{"03-u-normal-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k034kCrtGuestAdvancedHdSlotMaskUNormalCompositeRainbowArtifactsPresetDef>},
+{"04-u-normal-s-video", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k044kCrtGuestAdvancedHdSlotMaskUNormalSVideoPresetDef>},
+{"05-u-normal-rgb", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k054kCrtGuestAdvancedHdSlotMaskUNormalRgbPresetDef>},
+{"06-u-warm-rf", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k064kCrtGuestAdvancedHdSlotMaskUWarmRfPresetDef>},
+{"07-u-warm-composite", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k074kCrtGuestAdvancedHdSlotMaskUWarmCompositePresetDef>},
+{"08-u-warm-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k084kCrtGuestAdvancedHdSlotMaskUWarmCompositeRainbowArtifactsPresetDef>},
+{"09-u-warm-s-video", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k094kCrtGuestAdvancedHdSlotMaskUWarmSVideoPresetDef>},
+{"10-u-warm-rgb", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k104kCrtGuestAdvancedHdSlotMaskUWarmRgbPresetDef>},
+{"11-u-cool-rf", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k114kCrtGuestAdvancedHdSlotMaskUCoolRfPresetDef>},
+{"12-u-cool-composite", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k124kCrtGuestAdvancedHdSlotMaskUCoolCompositePresetDef>},
+{"13-u-cool-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k134kCrtGuestAdvancedHdSlotMaskUCoolCompositeRainbowArtifactsPresetDef>},
+{"14-u-cool-s-video", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k144kCrtGuestAdvancedHdSlotMaskUCoolSVideoPresetDef>},
+{"15-u-cool-rgb", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k154kCrtGuestAdvancedHdSlotMaskUCoolRgbPresetDef>},
+{"16-j-normal-rf", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k164kCrtGuestAdvancedHdSlotMaskJNormalRfPresetDef>},
+{"17-j-normal-composite", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k174kCrtGuestAdvancedHdSlotMaskJNormalCompositePresetDef>},
+{"18-j-normal-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k184kCrtGuestAdvancedHdSlotMaskJNormalCompositeRainbowArtifactsPresetDef>},
+{"19-j-normal-s-video", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k194kCrtGuestAdvancedHdSlotMaskJNormalSVideoPresetDef>},
+{"20-j-normal-rgb", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k204kCrtGuestAdvancedHdSlotMaskJNormalRgbPresetDef>},
+{"21-j-warm-rf", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k214kCrtGuestAdvancedHdSlotMaskJWarmRfPresetDef>},
+{"22-j-warm-composite", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k224kCrtGuestAdvancedHdSlotMaskJWarmCompositePresetDef>},
+{"23-j-warm-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k234kCrtGuestAdvancedHdSlotMaskJWarmCompositeRainbowArtifactsPresetDef>},
+{"24-j-warm-s-video", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k244kCrtGuestAdvancedHdSlotMaskJWarmSVideoPresetDef>},
+{"25-j-warm-rgb", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k254kCrtGuestAdvancedHdSlotMaskJWarmRgbPresetDef>},
+{"26-j-cool-rf", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k264kCrtGuestAdvancedHdSlotMaskJCoolRfPresetDef>},
+{"27-j-cool-composite", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k274kCrtGuestAdvancedHdSlotMaskJCoolCompositePresetDef>},
+{"28-j-cool-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k284kCrtGuestAdvancedHdSlotMaskJCoolCompositeRainbowArtifactsPresetDef>},
+{"29-j-cool-s-video", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k294kCrtGuestAdvancedHdSlotMaskJCoolSVideoPresetDef>},
+{"30-j-cool-rgb", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k304kCrtGuestAdvancedHdSlotMaskJCoolRgbPresetDef>},
+{"31-pal-normal-rf", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k314kCrtGuestAdvancedHdSlotMaskPalNormalRfPresetDef>},
+{"32-pal-normal-composite", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k324kCrtGuestAdvancedHdSlotMaskPalNormalCompositePresetDef>},
+{"33-pal-normal-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k334kCrtGuestAdvancedHdSlotMaskPalNormalCompositeRainbowArtifactsPresetDef>},
+{"34-pal-normal-s-video", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k344kCrtGuestAdvancedHdSlotMaskPalNormalSVideoPresetDef>},
+{"35-pal-normal-rgb", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k354kCrtGuestAdvancedHdSlotMaskPalNormalRgbPresetDef>},
+{"36-pal-warm-rf", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k364kCrtGuestAdvancedHdSlotMaskPalWarmRfPresetDef>},
+{"37-pal-warm-composite", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k374kCrtGuestAdvancedHdSlotMaskPalWarmCompositePresetDef>},
+{"38-pal-warm-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k384kCrtGuestAdvancedHdSlotMaskPalWarmCompositeRainbowArtifactsPresetDef>},
+{"39-pal-warm-s-video", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k394kCrtGuestAdvancedHdSlotMaskPalWarmSVideoPresetDef>},
+{"40-pal-warm-rgb", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k404kCrtGuestAdvancedHdSlotMaskPalWarmRgbPresetDef>},
+{"41-pal-cool-rf", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k414kCrtGuestAdvancedHdSlotMaskPalCoolRfPresetDef>},
+{"42-pal-cool-composite", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k424kCrtGuestAdvancedHdSlotMaskPalCoolCompositePresetDef>},
+{"43-pal-cool-composite-rainbow-artifacts", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k434kCrtGuestAdvancedHdSlotMaskPalCoolCompositeRainbowArtifactsPresetDef>},
+{"44-pal-cool-s-video", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k444kCrtGuestAdvancedHdSlotMaskPalCoolSVideoPresetDef>},
+{"45-pal-cool-rgb", "sonkun/slot-mask/flat-screen/4k", 0.0f, CreatePreset<SonkunSlotMaskFlatScreen4k454kCrtGuestAdvancedHdSlotMaskPalCoolRgbPresetDef>},
+{"anaglyph-to-interlaced", "stereoscopic-3d", 0.0f, CreatePreset<Stereoscopic3dAnaglyphToInterlacedPresetDef>},
+{"anaglyph-to-side-by-side", "stereoscopic-3d", 0.0f, CreatePreset<Stereoscopic3dAnaglyphToSideBySidePresetDef>},
+{"fubax_vr", "stereoscopic-3d", 0.0f, CreatePreset<Stereoscopic3dFubax_vrPresetDef>},
+{"shutter-to-anaglyph", "stereoscopic-3d", 0.0f, CreatePreset<Stereoscopic3dShutterToAnaglyphPresetDef>},
+{"shutter-to-side-by-side", "stereoscopic-3d", 0.0f, CreatePreset<Stereoscopic3dShutterToSideBySidePresetDef>},
+{"side-by-side-simple", "stereoscopic-3d", 0.0f, CreatePreset<Stereoscopic3dSideBySideSimplePresetDef>},
+{"side-by-side-to-interlaced", "stereoscopic-3d", 0.0f, CreatePreset<Stereoscopic3dSideBySideToInterlacedPresetDef>},
+{"side-by-side-to-shutter", "stereoscopic-3d", 0.0f, CreatePreset<Stereoscopic3dSideBySideToShutterPresetDef>},
+{"gristleVHS", "vhs", 0.0f, CreatePreset<VhsGristleVHSPresetDef>},
+{"mudlord-pal-vhs", "vhs", 0.0f, CreatePreset<VhsMudlordPalVhsPresetDef>},
+{"ntsc-vcr", "vhs", 0.0f, CreatePreset<VhsNtscVcrPresetDef>},
+{"vhs", "vhs", 0.0f, CreatePreset<VhsVhsPresetDef>},
+{"VHSPro", "vhs", 0.0f, CreatePreset<VhsVHSProPresetDef>},
+{"vhs_and_crt_godot", "vhs", 0.0f, CreatePreset<VhsVhs_and_crt_godotPresetDef>},
+{"vhs_mpalko", "vhs", 0.0f, CreatePreset<VhsVhs_mpalkoPresetDef>},
+{"dilation", "warp", 0.0f, CreatePreset<WarpDilationPresetDef>},
 // %PRESET_CLASS%
 };
 
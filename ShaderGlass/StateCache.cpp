@@ -0,0 +1,163 @@
+/*
+ShaderGlass: shader effect overlay
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "pch.h"
+
+#include "StateCache.h"
+
+static HRESULT hr;
+
+// clang-format off
+static float sVertexBuffer[] = 
+{
+    // Preprocess VB
+    -1.0f, -1.0f, 0.0f, 1.0f, 0.0f, 1.0f,
+    -1.0f, 1.0f,  0.0f, 1.0f, 0.0f, 0.0f,
+    1.0f,  -1.0f, 0.0f, 1.0f, 1.0f, 1.0f,
+    1.0f,  1.0f,  0.0f, 1.0f, 1.0f, 0.0f,
+    // Shader VB
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f
+};
+// clang-format on
+
+static const UINT sVertexStride = 6 * sizeof(float);
+static const UINT sVertexOffset = 0;
+
+// ISGN chunk of a DXBC container, read directly as D3DGetInputSignatureBlob would load the (delay-loaded)
+// compiler; the whole bytecode when there's none
+static std::string InputSignature(const void* byteCode, size_t length)
+{
+    const auto bytes = static_cast<const uint8_t*>(byteCode);
+    if(length >= 32 && memcmp(bytes, "DXBC", 4) == 0)
+    {
+        uint32_t chunkCount;
+        memcpy(&chunkCount, bytes + 28, 4);
+        for(uint32_t c = 0; c < chunkCount && 32 + (c + 1) * 4 <= length; c++)
+        {
+            uint32_t offset, size;
+            memcpy(&offset, bytes + 32 + c * 4, 4);
+            if((size_t)offset + 8 > length)
+                break;
+            memcpy(&size, bytes + offset + 4, 4);
+            if((memcmp(bytes + offset, "ISGN", 4) == 0 || memcmp(bytes + offset, "ISG1", 4) == 0) && (size_t)offset + 8 + size <= length)
+                return std::string((const char*)bytes + offset, size + 8);
+        }
+    }
+    return std::string((const char*)bytes, length);
+}
+
+void StateCache::Initialize(winrt::com_ptr<ID3D11Device> device)
+{
+    Clear();
+    m_device = device;
+
+    D3D11_BUFFER_DESC vertex_buff_descr = {};
+    vertex_buff_descr.ByteWidth         = sizeof(sVertexBuffer);
+    vertex_buff_descr.Usage             = D3D11_USAGE_IMMUTABLE;
+    vertex_buff_descr.BindFlags         = D3D11_BIND_VERTEX_BUFFER;
+    D3D11_SUBRESOURCE_DATA sr_data      = {0};
+    sr_data.pSysMem                     = sVertexBuffer;
+    hr                                  = m_device->CreateBuffer(&vertex_buff_descr, &sr_data, m_vertexBuffer.put());
+    assert(SUCCEEDED(hr));
+}
+
+void StateCache::Clear()
+{
+    ResetBindings();
+    m_inputLayouts.clear();
+    m_samplerStates.clear();
+    m_blendStates.clear();
+    m_vertexBuffer = nullptr;
+    m_device       = nullptr;
+}
+
+ID3D11InputLayout* StateCache::InputLayout(const void* vertexByteCode, size_t vertexLength)
+{
+    // a layout is only tied to the vertex shader by its input signature, which generated shaders have in common
+    auto key = InputSignature(vertexByteCode, vertexLength);
+
+    auto existing = m_inputLayouts.find(key);
+    if(existing != m_inputLayouts.end())
+        return existing->second.get();
+
+    D3D11_INPUT_ELEMENT_DESC inputElementDesc[] = {{"TEXCOORD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+                                                   {"TEXCOORD", 1, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0}};
+
+    winrt::com_ptr<ID3D11InputLayout> inputLayout;
+    hr = m_device->CreateInputLayout(inputElementDesc, ARRAYSIZE(inputElementDesc), vertexByteCode, vertexLength, inputLayout.put());
+    assert(SUCCEEDED(hr));
+    return m_inputLayouts.insert(std::make_pair(std::move(key), inputLayout)).first->second.get();
+}
+
+ID3D11SamplerState* StateCache::SamplerState(const D3D11_SAMPLER_DESC& desc)
+{
+    for(const auto& s : m_samplerStates)
+    {
+        if(memcmp(&s.first, &desc, sizeof(desc)) == 0)
+            return s.second.get();
+    }
+
+    winrt::com_ptr<ID3D11SamplerState> samplerState;
+    hr = m_device->CreateSamplerState(&desc, samplerState.put());
+    assert(SUCCEEDED(hr));
+    m_samplerStates.emplace_back(desc, samplerState);
+    return samplerState.get();
+}
+
+ID3D11BlendState* StateCache::BlendState(const D3D11_BLEND_DESC& desc)
+{
+    for(const auto& b : m_blendStates)
+    {
+        if(memcmp(&b.first, &desc, sizeof(desc)) == 0)
+            return b.second.get();
+    }
+
+    winrt::com_ptr<ID3D11BlendState> blendState;
+    hr = m_device->CreateBlendState(&desc, blendState.put());
+    assert(SUCCEEDED(hr));
+    m_blendStates.emplace_back(desc, blendState);
+    return blendState.get();
+}
+
+void StateCache::ResetBindings()
+{
+    m_inputBound  = false;
+    m_boundLayout = nullptr;
+    memset(m_boundSamplers, 0, sizeof(m_boundSamplers));
+}
+
+void StateCache::BindInput(ID3D11DeviceContext* context, ID3D11InputLayout* inputLayout)
+{
+    // all passes draw from the same quad
+    if(!m_inputBound)
+    {
+        ID3D11Buffer* vertexBuffer[1] = {m_vertexBuffer.get()};
+        context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+        context->IASetVertexBuffers(0, 1, vertexBuffer, &sVertexStride, &sVertexOffset);
+        m_inputBound = true;
+    }
+    if(inputLayout != m_boundLayout)
+    {
+        context->IASetInputLayout(inputLayout);
+        m_boundLayout = inputLayout;
+    }
+}
+
+void StateCache::BindSampler(ID3D11DeviceContext* context, UINT slot, ID3D11SamplerState* sampler)
+{
+    if(slot < ARRAYSIZE(m_boundSamplers))
+    {
+        if(m_boundSamplers[slot] == sampler)
+            return;
+        m_boundSamplers[slot] = sampler;
+    }
+    ID3D11SamplerState* samplers[1] = {sampler};
+    context->PSSetSamplers(slot, 1, samplers);
+}
@@ -0,0 +1,37 @@
+/*
+ShaderGlass: shader effect overlay
+Copyright (C) 2021-2025 mausimus (mausimus.net)
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+// immutable D3D objects shared by all passes: the quad vertex buffer, and input layouts, samplers and blend
+// states created once per distinct descriptor; kept until the device goes so switching presets reuses them.
+// Also remembers what passes have bound during a frame so identical bind calls can be skipped
+class StateCache
+{
+public:
+    void Initialize(winrt::com_ptr<ID3D11Device> device);
+    void Clear();
+
+    ID3D11InputLayout*  InputLayout(const void* vertexByteCode, size_t vertexLength);
+    ID3D11SamplerState* SamplerState(const D3D11_SAMPLER_DESC& desc);
+    ID3D11BlendState*   BlendState(const D3D11_BLEND_DESC& desc);
+
+    // call before the first pass of a frame, bindings made outside passes aren't tracked
+    void ResetBindings();
+    void BindInput(ID3D11DeviceContext* context, ID3D11InputLayout* inputLayout);
+    void BindSampler(ID3D11DeviceContext* context, UINT slot, ID3D11SamplerState* sampler);
+
+private:
+    winrt::com_ptr<ID3D11Device>                                                      m_device {nullptr};
+    winrt::com_ptr<ID3D11Buffer>                                                      m_vertexBuffer {nullptr};
+    std::unordered_map<std::string, winrt::com_ptr<ID3D11InputLayout>>                m_inputLayouts; // by vertex input signature
+    std::vector<std::pair<D3D11_SAMPLER_DESC, winrt::com_ptr<ID3D11SamplerState>>>    m_samplerStates;
+    std::vector<std::pair<D3D11_BLEND_DESC, winrt::com_ptr<ID3D11BlendState>>>        m_blendStates;
+    bool                                                                              m_inputBound {false};
+    ID3D11InputLayout*                                                                m_boundLayout {nullptr};
+    ID3D11SamplerState*                                                               m_boundSamplers[D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT] {};
+};
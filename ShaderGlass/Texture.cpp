@@ -14,6 +14,27 @@ GNU General Public License v3.0
 #include "Texture.h"
 #include "WIC\WICTextureLoader11.h"
 
+// built-in TextureDefs of the same image point at the same data (ShaderGen shares it), so
+// images are decoded once and kept while any preset uses them; views of compressed images
+// differ by mipmap setting
+struct SharedTexture
+{
+    winrt::com_ptr<ID3D11Resource>           resource;
+    winrt::com_ptr<ID3D11ShaderResourceView> view;
+    unsigned                                 users;
+};
+
+static std::map<std::tuple<ID3D11Device*, const uint8_t*, bool>, SharedTexture> sSharedTextures;
+static std::mutex                                                               sSharedMutex;
+
+// DDS header fields used below, offsets from the start of the file
+static const size_t sDDSHeight    = 12;
+static const size_t sDDSWidth     = 16;
+static const size_t sDDSMipLevels = 28;
+static const size_t sDDSFourCC    = 84;
+static const size_t sDDSFormat    = 128;
+static const size_t sDDSData      = 148;
+
 Texture::Texture(TextureDef& textureDef) : m_linear(false), m_mipmap(false), m_repeat(false), m_clamp(false), m_mirror(false), m_textureDef(textureDef)
 {
     m_name = textureDef.PresetParams["name"];
@@ -35,26 +56,127 @@ Texture::Texture(TextureDef& textureDef) : m_linear(false), m_mipmap(false), m_r
 
 void Texture::Create(winrt::com_ptr<ID3D11Device> d3dDevice)
 {
-    auto hr = DirectX::CreateWICTextureFromMemoryEx(d3dDevice.get(),
-                                                    nullptr,
-                                                    m_textureDef.Data,
-                                                    m_textureDef.DataLength,
-                                                    0,
-                                                    D3D11_USAGE_DEFAULT,
-                                                    D3D11_BIND_SHADER_RESOURCE,
-                                                    0,
-                                                    0,
-                                                    DirectX::WIC_LOADER_IGNORE_SRGB | DirectX::WIC_LOADER_FORCE_RGBA32,
-                                                    m_textureResource.put(),
-                                                    m_textureView.put());
+    Release();
+
+    // imported textures own their data, which may be freed and its address reused
+    std::unique_lock lock(sSharedMutex);
+    if(!m_textureDef.Dynamic)
+    {
+        auto shared = sSharedTextures.find(std::make_tuple(d3dDevice.get(), m_textureDef.Data, m_mipmap));
+        if(shared != sSharedTextures.end())
+        {
+            m_textureResource = shared->second.resource;
+            m_textureView     = shared->second.view;
+            m_sharedDevice    = d3dDevice.get();
+            shared->second.users++;
+            return;
+        }
+    }
+
+    auto hr = CreateCompressed(d3dDevice.get());
+    if(FAILED(hr))
+    {
+        hr = DirectX::CreateWICTextureFromMemoryEx(d3dDevice.get(),
+                                                   nullptr,
+                                                   m_textureDef.Data,
+                                                   m_textureDef.DataLength,
+                                                   0,
+                                                   D3D11_USAGE_DEFAULT,
+                                                   D3D11_BIND_SHADER_RESOURCE,
+                                                   0,
+                                                   0,
+                                                   DirectX::WIC_LOADER_IGNORE_SRGB | DirectX::WIC_LOADER_FORCE_RGBA32,
+                                                   m_textureResource.put(),
+                                                   m_textureView.put());
+    }
+
+    if(SUCCEEDED(hr) && !m_textureDef.Dynamic)
+    {
+        sSharedTextures[std::make_tuple(d3dDevice.get(), m_textureDef.Data, m_mipmap)] = SharedTexture {m_textureResource, m_textureView, 1};
+        m_sharedDevice                                                                 = d3dDevice.get();
+    }
+}
+
+// BC1/BC7 DDS with a full mip chain from ShaderGen -compress, uploaded without decoding
+HRESULT Texture::CreateCompressed(ID3D11Device* d3dDevice)
+{
+    const auto data = m_textureDef.Data;
+    const auto size = (size_t)m_textureDef.DataLength;
+    if(!data || size < sDDSData || memcmp(data, "DDS ", 4) != 0 || memcmp(data + sDDSFourCC, "DX10", 4) != 0)
+        return E_INVALIDARG;
+
+    uint32_t width, height, mipLevels, format;
+    memcpy(&height, data + sDDSHeight, sizeof(height));
+    memcpy(&width, data + sDDSWidth, sizeof(width));
+    memcpy(&mipLevels, data + sDDSMipLevels, sizeof(mipLevels));
+    memcpy(&format, data + sDDSFormat, sizeof(format));
+
+    const size_t blockSize = format == DXGI_FORMAT_BC1_UNORM ? 8 : (format == DXGI_FORMAT_BC7_UNORM ? 16 : 0);
+    if(blockSize == 0 || width == 0 || height == 0 || mipLevels == 0 || mipLevels > D3D11_REQ_MIP_LEVELS)
+        return E_INVALIDARG;
+
+    std::vector<D3D11_SUBRESOURCE_DATA> levels(mipLevels);
+    size_t                              offset = sDDSData;
+    for(uint32_t i = 0; i < mipLevels; i++)
+    {
+        const size_t pitch     = (std::max(1u, width >> i) + 3) / 4 * blockSize;
+        const size_t levelSize = pitch * ((std::max(1u, height >> i) + 3) / 4);
+        if(offset + levelSize > size)
+            return E_INVALIDARG;
+
+        levels[i].pSysMem     = data + offset;
+        levels[i].SysMemPitch = (UINT)pitch;
+        offset += levelSize;
+    }
+
+    D3D11_TEXTURE2D_DESC desc = {};
+    desc.Width                = width;
+    desc.Height               = height;
+    desc.MipLevels            = mipLevels;
+    desc.ArraySize            = 1;
+    desc.Format               = (DXGI_FORMAT)format;
+    desc.SampleDesc.Count     = 1;
+    desc.Usage                = D3D11_USAGE_DEFAULT;
+    desc.BindFlags            = D3D11_BIND_SHADER_RESOURCE;
+
+    winrt::com_ptr<ID3D11Texture2D> texture;
+    auto                            hr = d3dDevice->CreateTexture2D(&desc, levels.data(), texture.put());
+    if(FAILED(hr))
+        return hr;
+
+    // without mipmap = true only the top level is sampled, same as decoded textures
+    D3D11_SHADER_RESOURCE_VIEW_DESC viewDesc = {};
+    viewDesc.Format                          = desc.Format;
+    viewDesc.ViewDimension                   = D3D11_SRV_DIMENSION_TEXTURE2D;
+    viewDesc.Texture2D.MipLevels             = m_mipmap ? mipLevels : 1;
+    hr                                       = d3dDevice->CreateShaderResourceView(texture.get(), &viewDesc, m_textureView.put());
+    if(FAILED(hr))
+        return hr;
+
+    m_textureResource = texture.as<ID3D11Resource>();
+    return S_OK;
+}
+
+void Texture::Release()
+{
+    if(m_sharedDevice)
+    {
+        std::unique_lock lock(sSharedMutex);
+        auto             shared = sSharedTextures.find(std::make_tuple(m_sharedDevice, m_textureDef.Data, m_mipmap));
+        if(shared != sSharedTextures.end() && --shared->second.users == 0)
+            sSharedTextures.erase(shared);
+        m_sharedDevice = nullptr;
+    }
+    m_textureView     = nullptr;
+    m_textureResource = nullptr;
 }
 
 bool Texture::Get(const std::string& presetParam, std::string& value)
 {
-    auto it = m_textureDef.PresetParams.find(presetParam);
-    if(it != m_textureDef.PresetParams.end())
+    std::string_view presetValue;
+    if(m_textureDef.PresetParams.Get(presetParam, presetValue))
     {
-        value = it->second;
+        value = presetValue;
         return true;
     }
     return false;
@@ -62,6 +184,5 @@ bool Texture::Get(const std::string& presetParam, std::string& value)
 
 Texture::~Texture()
 {
-    m_textureView     = nullptr;
-    m_textureResource = nullptr;
+    Release();
 }
@@ -28,6 +28,13 @@ public:
     void Create(winrt::com_ptr<ID3D11Device> d3dDevice);
     ~Texture();
 
+    Texture(const Texture&)            = delete;
+    Texture& operator=(const Texture&) = delete;
+
 private:
-    bool Get(const std::string& presetParam, std::string& value);
+    bool    Get(const std::string& presetParam, std::string& value);
+    HRESULT CreateCompressed(ID3D11Device* d3dDevice);
+    void    Release();
+
+    ID3D11Device* m_sharedDevice {nullptr}; // set when the decoded image is shared
 };
\ No newline at end of file
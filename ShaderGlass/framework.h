@@ -18,6 +18,8 @@
 #include <iostream>
 #include <sstream>
 #include <mutex>
+#include <atomic>
+#include <functional>
 
 #include <Unknwn.h>
 #include <inspectable.h>